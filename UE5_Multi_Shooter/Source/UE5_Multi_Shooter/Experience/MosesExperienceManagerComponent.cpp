@@ -9,6 +9,7 @@
 #include "UE5_Multi_Shooter/Match/GAS/MosesAbilitySet.h"
 #include "UE5_Multi_Shooter/System/MosesAssetManager.h"
 #include "UE5_Multi_Shooter/System/MosesAuthorityGuards.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesCombatAssetSubsystem.h"
 
 #include "AbilitySystemInterface.h"
 #include "AbilitySystemComponent.h"
@@ -22,6 +23,7 @@
 #include "Interfaces/IPluginManager.h"
 #include "Misc/Paths.h"
 #include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
 
 UMosesExperienceManagerComponent::UMosesExperienceManagerComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -240,7 +242,7 @@ void UMosesExperienceManagerComponent::StartLoadGameFeatures()
 
 	if (Features.Num() == 0)
 	{
-		FinishExperienceLoad();
+		StartLoadCombatAssets();
 		return;
 	}
 
@@ -311,8 +313,45 @@ void UMosesExperienceManagerComponent::OnOneGameFeatureActivated(const UE::GameF
 			return;
 		}
 
+		StartLoadCombatAssets();
+	}
+}
+
+// ============================================================================
+// Load Steps: Combat Asset Residency
+// ============================================================================
+
+void UMosesExperienceManagerComponent::StartLoadCombatAssets()
+{
+	UWorld* World = GetWorld();
+	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	UMosesCombatAssetSubsystem* CombatAssets = GI ? GI->GetSubsystem<UMosesCombatAssetSubsystem>() : nullptr;
+
+	if (!CombatAssets)
+	{
 		FinishExperienceLoad();
+		return;
 	}
+
+	LoadState = EMosesExperienceLoadState::LoadingCombatAssets;
+
+	UE_LOG(LogMosesExp, Warning, TEXT("[EXP] LoadingCombatAssets Id=%s"), *CurrentExperienceId.ToString());
+
+	CombatAssets->RequestResidency(World,
+		FSimpleDelegate::CreateUObject(this, &ThisClass::OnCombatAssetsLoaded, CurrentExperienceId));
+}
+
+void UMosesExperienceManagerComponent::OnCombatAssetsLoaded(FPrimaryAssetId LoadedExperienceId)
+{
+	// stale 방지: 로딩 중 Experience가 바뀐 경우 무시
+	if (LoadedExperienceId != CurrentExperienceId || LoadState != EMosesExperienceLoadState::LoadingCombatAssets)
+	{
+		UE_LOG(LogMosesExp, Warning, TEXT("[EXP] CombatAssetsLoaded STALE Loaded=%s Current=%s -> IGNORE"),
+			*LoadedExperienceId.ToString(), *CurrentExperienceId.ToString());
+		return;
+	}
+
+	FinishExperienceLoad();
 }
 
 // ============================================================================
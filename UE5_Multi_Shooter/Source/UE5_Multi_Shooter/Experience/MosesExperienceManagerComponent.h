@@ -28,6 +28,7 @@ enum class EMosesExperienceLoadState : uint8
 	Unloaded,
 	LoadingAssets,
 	LoadingGameFeatures,
+	LoadingCombatAssets,
 	Loaded,
 	Failed
 };
@@ -43,7 +44,8 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnMosesExperienceLoaded, const UMosesExperi
  * - 서버/클라 모두 동일 루트로:
  *   (1) ExperienceDefinition 로드
  *   (2) GameFeature Load/Activate
- *   (3) READY 브로드캐스트
+ *   (3) 전투 에셋 Residency Set 선로드 (서버)
+ *   (4) READY 브로드캐스트
  *
  * [Experience 전환]
  * - Warmup -> Combat -> Result 처럼 ExperienceId가 바뀌면,
@@ -139,6 +141,16 @@ private:
 	/** 개별 GF Activate 완료 콜백(성공/실패 누적) */
 	void OnOneGameFeatureActivated(const UE::GameFeatures::FResult& Result, FString PluginName);
 
+	/**
+	 * 전투 GE 등 Residency Set 비동기 선로드(UMosesCombatAssetSubsystem)
+	 * - 전투 중 LoadSynchronous로 게임 스레드가 멈추는 것을 방지
+	 * - 완료 시 FinishExperienceLoad
+	 */
+	void StartLoadCombatAssets();
+
+	/** Residency Set 로드 완료 콜백(스테일 체크 후 READY) */
+	void OnCombatAssetsLoaded(FPrimaryAssetId LoadedExperienceId);
+
 	/**
 	 * 최종 READY 확정
 	 * - LoadState=Loaded
@@ -18,7 +18,8 @@ void UAnimNotifyState_MosesZombieAttackWindow::NotifyBegin(
 	}
 
 	AMosesZombieCharacter* Zombie = Cast<AMosesZombieCharacter>(MeshComp->GetOwner());
-	if (!Zombie || !Zombie->HasAuthority())
+	// [MOD] 베이크 타임라인이 윈도우를 구동 중이면 중복 호출 방지
+	if (!Zombie || !Zombie->HasAuthority() || Zombie->IsAttackTimelineActive_Server())
 	{
 		return;
 	}
@@ -40,7 +41,7 @@ void UAnimNotifyState_MosesZombieAttackWindow::NotifyEnd(
 	}
 
 	AMosesZombieCharacter* Zombie = Cast<AMosesZombieCharacter>(MeshComp->GetOwner());
-	if (!Zombie || !Zombie->HasAuthority())
+	if (!Zombie || !Zombie->HasAuthority() || Zombie->IsAttackTimelineActive_Server())
 	{
 		return;
 	}
@@ -10,6 +10,8 @@
  * AnimNotifyState - Zombie melee attack window
  * - Montage 구간 동안만 서버에서 AttackHitBox Collision ON/OFF를 제어한다.
  * - 클라이언트에서도 노티파이가 호출되지만, 실제 판정은 서버만 수행(HasAuthority() Guard).
+ * - [MOD] 서버는 UMosesZombieTypeData가 이 노티파이 구간을 베이크한 타임라인으로 윈도우를 구동한다.
+ *   (데디 서버는 애님 평가 OFF → 이 노티파이는 베이크 소스 + 타임라인 없는 Montage 폴백)
  */
 UCLASS(meta=(DisplayName="Moses Zombie Attack Window"))
 class UE5_MULTI_SHOOTER_API UAnimNotifyState_MosesZombieAttackWindow : public UAnimNotifyState
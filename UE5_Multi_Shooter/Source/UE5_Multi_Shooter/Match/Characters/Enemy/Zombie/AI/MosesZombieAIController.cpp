@@ -7,11 +7,15 @@
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
 #include "Perception/AIPerceptionTypes.h"
+#include "Perception/AISense_Sight.h"
 
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BrainComponent.h"
+#include "Navigation/PathFollowingComponent.h"
 
 #include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerState.h"
 
 AMosesZombieAIController::AMosesZombieAIController()
@@ -123,6 +127,107 @@ void AMosesZombieAIController::ClearTargetActor()
 	BB->ClearValue(BBKey_TargetActor);
 }
 
+void AMosesZombieAIController::StopBehavior_Server()
+{
+	if (!IsServerAI())
+	{
+		return;
+	}
+
+	// LOD 풀 레이트 복구 (Dormant 일시정지 해제 후 정지)
+	ApplyLODTier_Server(EMosesZombieLODTier::Active);
+
+	StopMovement();
+
+	if (UBrainComponent* Brain = GetBrainComponent())
+	{
+		Brain->StopLogic(TEXT("ZombiePool"));
+	}
+
+	// 대기 중 감지 금지 (숨은 좀비가 BB를 건드리지 않게)
+	if (PerceptionComp)
+	{
+		PerceptionComp->SetSenseEnabled(UAISense_Sight::StaticClass(), false);
+	}
+
+	ClearTargetActor();
+}
+
+void AMosesZombieAIController::RestartBehavior_Server()
+{
+	if (!IsServerAI())
+	{
+		return;
+	}
+
+	if (PerceptionComp)
+	{
+		PerceptionComp->SetSenseEnabled(UAISense_Sight::StaticClass(), true);
+	}
+
+	ClearTargetActor();
+	SetupBlackboardAndRunBT();
+}
+
+void AMosesZombieAIController::ApplyLODTier_Server(EMosesZombieLODTier NewTier)
+{
+	if (!IsServerAI() || NewTier == LODTier)
+	{
+		return;
+	}
+
+	const EMosesZombieLODTier OldTier = LODTier;
+	LODTier = NewTier;
+
+	// 1) BT: Dormant만 정지 (깨어나면 멈춘 자리에서 재개)
+	if (UBrainComponent* Brain = GetBrainComponent())
+	{
+		if (NewTier == EMosesZombieLODTier::Dormant)
+		{
+			StopMovement();
+			Brain->PauseLogic(TEXT("ZombieLOD"));
+		}
+		else if (OldTier == EMosesZombieLODTier::Dormant)
+		{
+			Brain->ResumeLogic(TEXT("ZombieLOD"));
+		}
+	}
+
+	// 2) 틱 주기: Controller + PathFollowing + CharacterMovement
+	float TickInterval = 0.0f;
+	switch (NewTier)
+	{
+	case EMosesZombieLODTier::Near:		TickInterval = NearMovementTickInterval; break;
+	case EMosesZombieLODTier::Far:		TickInterval = FarMovementTickInterval; break;
+	case EMosesZombieLODTier::Dormant:	TickInterval = DormantMovementTickInterval; break;
+	default: break;
+	}
+
+	SetActorTickInterval(TickInterval);
+
+	if (UPathFollowingComponent* PathComp = GetPathFollowingComponent())
+	{
+		PathComp->SetComponentTickInterval(TickInterval);
+	}
+
+	if (ACharacter* ControlledCharacter = Cast<ACharacter>(GetPawn()))
+	{
+		if (UCharacterMovementComponent* MoveComp = ControlledCharacter->GetCharacterMovement())
+		{
+			MoveComp->SetComponentTickInterval(TickInterval);
+		}
+	}
+
+	// 3) Perception: 먼 티어는 시야 감지 끔
+	if (PerceptionComp)
+	{
+		PerceptionComp->SetSenseEnabled(UAISense_Sight::StaticClass(), NewTier < PerceptionOffTier);
+	}
+
+	UE_LOG(LogMosesZombie, Verbose, TEXT("[ZAI][SV] LOD %s -> %s Interval=%.3f Pawn=%s"),
+		*UEnum::GetValueAsString(OldTier), *UEnum::GetValueAsString(NewTier), TickInterval, *GetNameSafe(GetPawn()));
+}
+
 void AMosesZombieAIController::HandlePerceptionUpdated(AActor* Actor, FAIStimulus Stimulus)
 {
 	if (!IsServerAI())
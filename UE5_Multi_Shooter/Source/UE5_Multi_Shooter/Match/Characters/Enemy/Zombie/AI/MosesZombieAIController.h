@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Types/MosesZombieLODTypes.h"
 #include "MosesZombieAIController.generated.h"
 
 class UAIPerceptionComponent;
@@ -13,6 +14,8 @@ class UBlackboardComponent;
  * AMosesZombieAIController (Server Authority)
  * - AIPerception(Sight)로 플레이어 감지 -> Blackboard TargetActor 갱신
  * - BehaviorTree 실행 (서버만)
+ * - [ADD] 좀비 풀 재사용: BT 정지/재시작 (컨트롤러는 Possess 유지)
+ * - [ADD] LOD 티어 적용 (UMosesZombieDirectorSubsystem 결정): BT 정지/Perception/이동 틱 주기
  */
 UCLASS()
 class UE5_MULTI_SHOOTER_API AMosesZombieAIController : public AAIController
@@ -22,6 +25,17 @@ class UE5_MULTI_SHOOTER_API AMosesZombieAIController : public AAIController
 public:
 	AMosesZombieAIController();
 
+	/** 티어 변화 시에만 호출 (Director) */
+	void ApplyLODTier_Server(EMosesZombieLODTier NewTier);
+
+	EMosesZombieLODTier GetLODTier() const { return LODTier; }
+
+	/** [ADD] 좀비 풀: 대기 진입 시 BT 정지 (Possess/BT 인스턴스 유지) */
+	void StopBehavior_Server();
+
+	/** [ADD] 좀비 풀: 재사용 시 BB 초기화 + BT 재시작 */
+	void RestartBehavior_Server();
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void OnPossess(APawn* InPawn) override;
@@ -52,4 +66,21 @@ private:
 	/** BB 키 이름 고정 */
 	UPROPERTY(EditDefaultsOnly, Category="Moses|AI")
 	FName BBKey_TargetActor = TEXT("TargetActor");
+
+	/** 티어별 Controller/CharacterMovement/PathFollowing 틱 주기 (Active = 매 프레임) */
+	UPROPERTY(EditDefaultsOnly, Category="Moses|AI|LOD")
+	float NearMovementTickInterval = 1.0f / 30.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Moses|AI|LOD")
+	float FarMovementTickInterval = 0.1f;
+
+	/** Dormant = BT 정지 + 이 주기 (낙하/물리 정리만) */
+	UPROPERTY(EditDefaultsOnly, Category="Moses|AI|LOD")
+	float DormantMovementTickInterval = 0.5f;
+
+	/** Far 이상이면 시야 감지 끔 (Director 일괄 선정이 타겟 담당) */
+	UPROPERTY(EditDefaultsOnly, Category="Moses|AI|LOD")
+	EMosesZombieLODTier PerceptionOffTier = EMosesZombieLODTier::Far;
+
+	EMosesZombieLODTier LODTier = EMosesZombieLODTier::Active;
 };
@@ -0,0 +1,476 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AI/MosesZombieDirectorSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AI/MosesZombieDirectorSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/MosesStats.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/MosesZombieCharacter.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AI/MosesZombieAIController.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Data/MosesZombieTypeData.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesPlayerSpatialHashSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Flag/MosesFlagSpot.h"
+
+#include "BehaviorTree/BlackboardComponent.h"
+#include "Engine/World.h"
+#include "Async/ParallelFor.h"
+
+namespace MosesZombieDirector_Private
+{
+	/** 타겟 없음 거리 (기존 Service 값 유지) */
+	static constexpr float NoTargetDistance = 999999.f;
+
+	/** XY 시야 판정 (sqrt 없음): Dot >= Cos * |D| */
+	FORCEINLINE bool IsInView(float Dot, float PlanarLenSq, float FovCos)
+	{
+		const float RhsSq = FovCos * FovCos * PlanarLenSq;
+		if (FovCos >= 0.0f)
+		{
+			return Dot >= 0.0f && Dot * Dot >= RhsSq;
+		}
+
+		return Dot >= 0.0f || Dot * Dot <= RhsSq;
+	}
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesZombieDirectorSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesZombieDirectorSubsystem::Deinitialize()
+{
+	Agents.Reset();
+	FlagSpots.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UMosesZombieDirectorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMosesZombieDirectorSubsystem, STATGROUP_Tickables);
+}
+
+bool UMosesZombieDirectorSubsystem::IsServer() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+void UMosesZombieDirectorSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!IsServer() || Agents.IsEmpty())
+	{
+		return;
+	}
+
+	TimeUntilNextPass -= DeltaTime;
+	if (TimeUntilNextPass > 0.0f)
+	{
+		return;
+	}
+
+	TimeUntilNextPass = SelectionInterval;
+	RunSelectionPass_Server();
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+void UMosesZombieDirectorSubsystem::RegisterZombie_Server(AMosesZombieCharacter* Zombie, UBlackboardComponent* Blackboard, FName TargetKey, FName DistanceKey, float AcquireRadius)
+{
+	if (!Zombie || !Blackboard || !IsServer())
+	{
+		return;
+	}
+
+	FAgent* Agent = Agents.FindByPredicate([Zombie](const FAgent& Existing)
+	{
+		return Existing.Zombie.Get() == Zombie;
+	});
+
+	if (!Agent)
+	{
+		Agent = &Agents.AddDefaulted_GetRef();
+		Agent->Zombie = Zombie;
+
+		// 새로 들어온 좀비는 다음 틱에 바로 선정
+		TimeUntilNextPass = 0.0f;
+	}
+
+	Agent->Blackboard = Blackboard;
+	Agent->TargetKey = TargetKey;
+	Agent->DistanceKey = DistanceKey;
+	Agent->AcquireRadius = AcquireRadius;
+
+	UE_LOG(LogMosesZombie, Verbose, TEXT("[ZAI][SV] Director Register Zombie=%s R=%.0f Managed=%d"),
+		*GetNameSafe(Zombie), AcquireRadius, Agents.Num());
+}
+
+void UMosesZombieDirectorSubsystem::UnregisterZombie_Server(const AMosesZombieCharacter* Zombie)
+{
+	const int32 Index = Agents.IndexOfByPredicate([Zombie](const FAgent& Existing)
+	{
+		return Existing.Zombie.Get() == Zombie;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		Agents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+}
+
+void UMosesZombieDirectorSubsystem::RegisterFlagSpot_Server(AMosesFlagSpot* FlagSpot)
+{
+	if (!FlagSpot || !IsServer())
+	{
+		return;
+	}
+
+	FlagSpots.AddUnique(FlagSpot);
+}
+
+// ============================================================================
+// Selection Pass
+// ============================================================================
+
+void UMosesZombieDirectorSubsystem::RunSelectionPass_Server()
+{
+	using namespace MosesZombieDirector_Private;
+
+	SCOPE_CYCLE_COUNTER(STAT_MosesZombieTargetSelect);
+
+	UMosesPlayerSpatialHashSubsystem* PlayerHash = GetWorld()->GetSubsystem<UMosesPlayerSpatialHashSubsystem>();
+	if (!PlayerHash)
+	{
+		return;
+	}
+
+	// -------------------------------------------------------------------------
+	// (1) 플레이어 SoA (살아 있는 플레이어 = 공간 해시 등록분, 인덱스 = 해시 엔트리 인덱스)
+	// -------------------------------------------------------------------------
+	PlayerHash->RefreshIfStale_Server();
+
+	const int32 NumPlayers = PlayerHash->GetNumTracked();
+
+	PlayerX.SetNumUninitialized(NumPlayers, EAllowShrinking::No);
+	PlayerY.SetNumUninitialized(NumPlayers, EAllowShrinking::No);
+	PlayerZ.SetNumUninitialized(NumPlayers, EAllowShrinking::No);
+
+	TMap<const AActor*, int32, TInlineSetAllocator<16>> PlayerIndexByActor;
+	for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; ++PlayerIndex)
+	{
+		const FVector& Location = PlayerHash->GetTrackedLocation(PlayerIndex);
+		PlayerX[PlayerIndex] = Location.X;
+		PlayerY[PlayerIndex] = Location.Y;
+		PlayerZ[PlayerIndex] = Location.Z;
+		PlayerIndexByActor.Add(PlayerHash->GetTrackedPawn(PlayerIndex), PlayerIndex);
+	}
+
+	// 점령 중인 깃발 (LOD 승격 기준)
+	ActiveFlagLocations.Reset();
+	for (const TWeakObjectPtr<AMosesFlagSpot>& FlagSpot : FlagSpots)
+	{
+		if (FlagSpot.IsValid() && FlagSpot->IsCapturing())
+		{
+			ActiveFlagLocations.Add(FlagSpot->GetActorLocation());
+		}
+	}
+
+	// -------------------------------------------------------------------------
+	// (2) 좀비 SoA (게임 스레드에서만 UObject 접근, 무효 등록은 먼저 정리)
+	// -------------------------------------------------------------------------
+	Agents.RemoveAll([](const FAgent& Agent)
+	{
+		return !Agent.Zombie.IsValid() || !Agent.Blackboard.IsValid();
+	});
+
+	ZombieX.Reset();
+	ZombieY.Reset();
+	ZombieZ.Reset();
+	ZombieFwdX.Reset();
+	ZombieFwdY.Reset();
+	ZombieRadiusSq.Reset();
+	ZombieFovCos.Reset();
+	ZombieCurTarget.Reset();
+	ZombieThreat.Reset();
+	ZombieLODTier.Reset();
+	SlotAgentIndex.Reset();
+
+	for (int32 AgentIndex = 0; AgentIndex < Agents.Num(); ++AgentIndex)
+	{
+		const FAgent& Agent = Agents[AgentIndex];
+
+		const AMosesZombieCharacter* Zombie = Agent.Zombie.Get();
+		const UBlackboardComponent* BB = Agent.Blackboard.Get();
+		if (Zombie->IsDying_Server())
+		{
+			continue;
+		}
+
+		const FVector Location = Zombie->GetActorLocation();
+		const FVector Forward = Zombie->GetActorForwardVector().GetSafeNormal2D();
+
+		const UMosesZombieTypeData* DA = Zombie->GetZombieTypeData();
+		const float FovDeg = DA ? DA->PeripheralVisionAngleDeg : 70.f;
+
+		const int32* CurTargetIndex = PlayerIndexByActor.Find(Cast<AActor>(BB->GetValueAsObject(Agent.TargetKey)));
+		const int32* ThreatIndex = PlayerIndexByActor.Find(Zombie->GetLastAttackerPawn_Server());
+
+		ZombieX.Add(Location.X);
+		ZombieY.Add(Location.Y);
+		ZombieZ.Add(Location.Z);
+		ZombieFwdX.Add(Forward.X);
+		ZombieFwdY.Add(Forward.Y);
+		ZombieRadiusSq.Add(FMath::Square(Agent.AcquireRadius));
+		ZombieFovCos.Add(FMath::Cos(FMath::DegreesToRadians(FovDeg)));
+		ZombieCurTarget.Add(CurTargetIndex ? *CurTargetIndex : INDEX_NONE);
+		ZombieThreat.Add(ThreatIndex ? *ThreatIndex : INDEX_NONE);
+		ZombieLODTier.Add(Agent.LODTier);
+		SlotAgentIndex.Add(AgentIndex);
+	}
+
+	const int32 NumSlots = SlotAgentIndex.Num();
+
+	SET_DWORD_STAT(STAT_MosesZombieDirectorManaged, Agents.Num());
+
+	if (NumSlots == 0)
+	{
+		return;
+	}
+
+	// -------------------------------------------------------------------------
+	// (3) 커널 (SoA 읽기 전용 → 결과 슬롯, 워커 병렬)
+	// -------------------------------------------------------------------------
+	ResultTarget.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+	ResultDistSq.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+	ResultLODTier.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+
+	PassPlayerHash = PlayerHash;
+
+	ParallelFor(NumSlots, [this](int32 Slot)
+	{
+		SelectTarget(Slot);
+		SelectLODTier(Slot);
+	},
+	NumSlots < MinParallelZombies ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	PassPlayerHash = nullptr;
+
+	// -------------------------------------------------------------------------
+	// (4) BB/LOD 기록 (게임 스레드, 변화가 있을 때만 Object 키/티어 갱신)
+	// -------------------------------------------------------------------------
+	int32 NumDormant = 0;
+
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		FAgent& Agent = Agents[SlotAgentIndex[Slot]];
+		UBlackboardComponent* BB = Agent.Blackboard.Get();
+
+		const EMosesZombieLODTier NewTier = ResultLODTier[Slot];
+		if (NewTier != Agent.LODTier)
+		{
+			if (AMosesZombieAIController* AIC = Cast<AMosesZombieAIController>(Agent.Zombie->GetController()))
+			{
+				AIC->ApplyLODTier_Server(NewTier);
+			}
+
+			Agent.LODTier = NewTier;
+		}
+
+		NumDormant += (NewTier == EMosesZombieLODTier::Dormant) ? 1 : 0;
+
+		const int32 NewTarget = ResultTarget[Slot];
+		if (NewTarget == INDEX_NONE)
+		{
+			if (ZombieCurTarget[Slot] != INDEX_NONE || BB->GetValueAsObject(Agent.TargetKey))
+			{
+				BB->ClearValue(Agent.TargetKey);
+
+				UE_LOG(LogMosesZombie, Verbose, TEXT("[ZAI][SV] TargetCleared Zombie=%s"), *GetNameSafe(Agent.Zombie.Get()));
+			}
+
+			BB->SetValueAsFloat(Agent.DistanceKey, NoTargetDistance);
+			continue;
+		}
+
+		const float Dist = FMath::Sqrt(ResultDistSq[Slot]);
+
+		if (NewTarget != ZombieCurTarget[Slot])
+		{
+			APawn* TargetPawn = PlayerHash->GetTrackedPawn(NewTarget);
+			BB->SetValueAsObject(Agent.TargetKey, TargetPawn);
+
+			UE_LOG(LogMosesZombie, Verbose, TEXT("[ZAI][SV] AcquireTarget Director Dist=%.0f R=%.0f Target=%s Zombie=%s"),
+				Dist, Agent.AcquireRadius, *GetNameSafe(TargetPawn), *GetNameSafe(Agent.Zombie.Get()));
+		}
+
+		BB->SetValueAsFloat(Agent.DistanceKey, Dist);
+	}
+
+	SET_DWORD_STAT(STAT_MosesZombieDormant, NumDormant);
+}
+
+void UMosesZombieDirectorSubsystem::SelectTarget(int32 Slot)
+{
+	using namespace MosesZombieDirector_Private;
+
+	const float ZX = ZombieX[Slot];
+	const float ZY = ZombieY[Slot];
+	const float ZZ = ZombieZ[Slot];
+	const float RadiusSq = ZombieRadiusSq[Slot];
+
+	// 현재 타겟이 반경 안이면 유지 (기존 Service 규칙: 반경 이탈 전까지 교체 없음)
+	const int32 CurTarget = ZombieCurTarget[Slot];
+	if (CurTarget != INDEX_NONE)
+	{
+		const float DX = PlayerX[CurTarget] - ZX;
+		const float DY = PlayerY[CurTarget] - ZY;
+		const float DZ = PlayerZ[CurTarget] - ZZ;
+		const float DistSq = DX * DX + DY * DY + DZ * DZ;
+
+		if (DistSq <= RadiusSq)
+		{
+			ResultTarget[Slot] = CurTarget;
+			ResultDistSq[Slot] = DistSq;
+			return;
+		}
+	}
+
+	const float FwdX = ZombieFwdX[Slot];
+	const float FwdY = ZombieFwdY[Slot];
+	const float FovCos = ZombieFovCos[Slot];
+	const int32 Threat = ZombieThreat[Slot];
+
+	int32 BestTarget = INDEX_NONE;
+	float BestScore = TNumericLimits<float>::Max();
+	float BestDistSq = 0.0f;
+
+	// 후보 = 획득 반경이 걸치는 셀의 플레이어만
+	PassPlayerHash->ForEachPlayerInRadius(FVector(ZX, ZY, ZZ), FMath::Sqrt(RadiusSq), [&](int32 PlayerIndex)
+	{
+		const float DX = PlayerX[PlayerIndex] - ZX;
+		const float DY = PlayerY[PlayerIndex] - ZY;
+		const float DZ = PlayerZ[PlayerIndex] - ZZ;
+
+		const float PlanarLenSq = DX * DX + DY * DY;
+		const float DistSq = PlanarLenSq + DZ * DZ;
+		if (DistSq > RadiusSq)
+		{
+			return;
+		}
+
+		// 뒤에 있어도 반경 안이면 후보 (시야 밖은 점수만 불리)
+		float Score = DistSq;
+		if (!IsInView(FwdX * DX + FwdY * DY, PlanarLenSq, FovCos))
+		{
+			Score *= OutOfViewScoreScale;
+		}
+
+		if (PlayerIndex == Threat)
+		{
+			Score *= ThreatScoreScale;
+		}
+
+		if (Score < BestScore)
+		{
+			BestScore = Score;
+			BestTarget = PlayerIndex;
+			BestDistSq = DistSq;
+		}
+	});
+
+	ResultTarget[Slot] = BestTarget;
+	ResultDistSq[Slot] = BestDistSq;
+}
+
+EMosesZombieLODTier UMosesZombieDirectorSubsystem::TierForDistSq(float DistSq)
+{
+	if (DistSq <= FMath::Square(LODActiveDistance))
+	{
+		return EMosesZombieLODTier::Active;
+	}
+
+	if (DistSq <= FMath::Square(LODNearDistance))
+	{
+		return EMosesZombieLODTier::Near;
+	}
+
+	if (DistSq <= FMath::Square(LODFarDistance))
+	{
+		return EMosesZombieLODTier::Far;
+	}
+
+	return EMosesZombieLODTier::Dormant;
+}
+
+void UMosesZombieDirectorSubsystem::SelectLODTier(int32 Slot)
+{
+	const float ZX = ZombieX[Slot];
+	const float ZY = ZombieY[Slot];
+	const float ZZ = ZombieZ[Slot];
+
+	// 최근접 플레이어 (플레이어 없으면 Dormant)
+	// - 타겟 선정에서 Active 거리 안 플레이어를 이미 찾았으면 그대로 (교전 중 좀비는 추가 순회 없음)
+	// - 아니면 전체 플레이어 순회: 반경 제한 없는 최근접이라 셀 질의 범위가 LOD 거리(수백 셀)까지 커짐
+	float NearestDistSq = TNumericLimits<float>::Max();
+
+	if (ResultTarget[Slot] != INDEX_NONE && ResultDistSq[Slot] <= FMath::Square(LODActiveDistance))
+	{
+		NearestDistSq = ResultDistSq[Slot];
+	}
+	else
+	{
+		const int32 NumPlayers = PlayerX.Num();
+		for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; ++PlayerIndex)
+		{
+			const float DX = PlayerX[PlayerIndex] - ZX;
+			const float DY = PlayerY[PlayerIndex] - ZY;
+			const float DZ = PlayerZ[PlayerIndex] - ZZ;
+
+			NearestDistSq = FMath::Min(NearestDistSq, DX * DX + DY * DY + DZ * DZ);
+		}
+	}
+
+	const EMosesZombieLODTier CurTier = ZombieLODTier[Slot];
+
+	// 승격 즉시 / 강등은 경계를 히스테리시스만큼 넘어야
+	EMosesZombieLODTier NewTier = TierForDistSq(NearestDistSq);
+	if (NewTier > CurTier)
+	{
+		const EMosesZombieLODTier DemoteTier = TierForDistSq(NearestDistSq / FMath::Square(LODHysteresisScale));
+		NewTier = FMath::Max(DemoteTier, CurTier);
+	}
+
+	// 점령 중인 깃발 근처 = 한 단계 승격
+	if (NewTier != EMosesZombieLODTier::Active)
+	{
+		const float FlagRadiusSq = FMath::Square(FlagActivityRadius);
+		const FVector ZombieLocation(ZX, ZY, ZZ);
+
+		for (const FVector& FlagLocation : ActiveFlagLocations)
+		{
+			if (FVector::DistSquared(ZombieLocation, FlagLocation) <= FlagRadiusSq)
+			{
+				NewTier = static_cast<EMosesZombieLODTier>(static_cast<uint8>(NewTier) - 1);
+				break;
+			}
+		}
+	}
+
+	ResultLODTier[Slot] = NewTier;
+}
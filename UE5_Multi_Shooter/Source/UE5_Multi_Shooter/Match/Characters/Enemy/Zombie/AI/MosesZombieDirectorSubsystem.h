@@ -0,0 +1,141 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AI/MosesZombieDirectorSubsystem.h
+// ----------------------------------------------------------------------------
+// Zombie Director (Server)
+// - 좀비별 BT Service 틱(수백 개 흩어진 질의) → 주기당 1회 일괄 타겟 선정
+// - 입력 = SoA (좀비 위치/전방/반경/FOV, 플레이어 위치: UMosesPlayerSpatialHashSubsystem)
+//   · 후보 = 좀비 획득 반경이 걸치는 해시 셀의 플레이어만 (좀비 x 전체 플레이어 순회 없음)
+// - 커널 = 거리 제곱 + FOV(시야 밖 가중) + 위협(마지막 가해자 가중), 좀비 단위 ParallelFor
+//   · 게임 오브젝트 접근 없음 → 워커 스레드 안전
+// - 결과 = 게임 스레드에서 각 좀비 BB(TargetActor / DistanceToTarget)에 한 번에 기록
+// - 등록 = UBTService_MosesZombieUpdateTarget (BecomeRelevant/CeaseRelevant, BB 키/반경 전달)
+// - [ADD] AI LOD = 같은 패스에서 최근접 플레이어 거리 + 깃발 점령 활동으로 티어 결정
+//   · 티어 변화 시에만 AMosesZombieAIController::ApplyLODTier_Server (BT/Perception/이동 틱)
+//   · 승격 즉시, 강등은 히스테리시스 (경계에서 깜빡임 방지)
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Types/MosesZombieLODTypes.h"
+#include "MosesZombieDirectorSubsystem.generated.h"
+
+class AMosesFlagSpot;
+class AMosesZombieCharacter;
+class UBlackboardComponent;
+class UMosesPlayerSpatialHashSubsystem;
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesZombieDirectorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// =========================================================================
+	// Registration (Server)
+	// =========================================================================
+
+	/** 재등록이면 BB/키/반경만 갱신 */
+	void RegisterZombie_Server(AMosesZombieCharacter* Zombie, UBlackboardComponent* Blackboard, FName TargetKey, FName DistanceKey, float AcquireRadius);
+	void UnregisterZombie_Server(const AMosesZombieCharacter* Zombie);
+
+	/** 점령 중인 깃발 주변 좀비는 LOD 한 단계 승격 */
+	void RegisterFlagSpot_Server(AMosesFlagSpot* FlagSpot);
+
+	int32 GetNumManaged() const { return Agents.Num(); }
+
+public:
+	/** 일괄 선정 주기 (기존 Service Interval) */
+	static constexpr float SelectionInterval = 0.3f;
+
+	/** 이 개수 미만 좀비는 단일 스레드 */
+	static constexpr int32 MinParallelZombies = 64;
+
+	/** 시야 밖 후보 점수 배율 (거리 제곱 기준, 1.5배 거리 상당) */
+	static constexpr float OutOfViewScoreScale = 2.25f;
+
+	/** 마지막 가해자 점수 배율 (거리 제곱 기준, 0.5배 거리 상당) */
+	static constexpr float ThreatScoreScale = 0.25f;
+
+	/** LOD 티어 경계 (최근접 플레이어 거리, cm) */
+	static constexpr float LODActiveDistance = 2500.0f;
+	static constexpr float LODNearDistance = 5000.0f;
+	static constexpr float LODFarDistance = 9000.0f;
+
+	/** 강등은 경계 * 이 배율을 넘어야 */
+	static constexpr float LODHysteresisScale = 1.15f;
+
+	/** 점령 중인 깃발에서 이 반경 안이면 승격 */
+	static constexpr float FlagActivityRadius = 3000.0f;
+
+private:
+	void RunSelectionPass_Server();
+
+	/** 순수 계산 (SoA → 결과 슬롯). 좀비 1마리분 */
+	void SelectTarget(int32 Slot);
+
+	/** 순수 계산 (SoA → 결과 슬롯). LOD 티어 */
+	void SelectLODTier(int32 Slot);
+
+	static EMosesZombieLODTier TierForDistSq(float DistSq);
+
+	bool IsServer() const;
+
+private:
+	struct FAgent
+	{
+		TWeakObjectPtr<AMosesZombieCharacter> Zombie;
+		TWeakObjectPtr<UBlackboardComponent> Blackboard;
+		FName TargetKey;
+		FName DistanceKey;
+		float AcquireRadius = 1500.0f;
+
+		/** 마지막으로 컨트롤러에 적용한 티어 (등록 시 = 풀 레이트) */
+		EMosesZombieLODTier LODTier = EMosesZombieLODTier::Active;
+	};
+
+	TArray<FAgent> Agents;
+
+	TArray<TWeakObjectPtr<AMosesFlagSpot>> FlagSpots;
+
+	float TimeUntilNextPass = 0.0f;
+
+	// ---- Pass scratch (SoA, 매 패스 재사용) ----
+	TArray<float> ZombieX;
+	TArray<float> ZombieY;
+	TArray<float> ZombieZ;
+	TArray<float> ZombieFwdX;
+	TArray<float> ZombieFwdY;
+	TArray<float> ZombieRadiusSq;
+	TArray<float> ZombieFovCos;
+	TArray<int32> ZombieCurTarget;
+	TArray<int32> ZombieThreat;
+	TArray<EMosesZombieLODTier> ZombieLODTier;
+
+	/** 슬롯 → Agents 인덱스 (사망/무효 좀비는 슬롯 없음) */
+	TArray<int32> SlotAgentIndex;
+
+	TArray<float> PlayerX;
+	TArray<float> PlayerY;
+	TArray<float> PlayerZ;
+
+	/** 패스 동안만 유효 (커널의 셀 후보 질의, 읽기 전용) */
+	const UMosesPlayerSpatialHashSubsystem* PassPlayerHash = nullptr;
+
+	/** 점령 중인 깃발 위치 */
+	TArray<FVector> ActiveFlagLocations;
+
+	TArray<int32> ResultTarget;
+	TArray<float> ResultDistSq;
+	TArray<EMosesZombieLODTier> ResultLODTier;
+};
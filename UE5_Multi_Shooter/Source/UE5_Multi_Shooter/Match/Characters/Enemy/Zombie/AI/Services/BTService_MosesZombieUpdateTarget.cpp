@@ -1,100 +1,53 @@
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AI/Services/BTService_MosesZombieUpdateTarget.h"
 
-#include "UE5_Multi_Shooter/MosesLogChannels.h"
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/MosesZombieCharacter.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AI/MosesZombieDirectorSubsystem.h"
 
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "GameFramework/Pawn.h"
-#include "GameFramework/PlayerState.h"
 
 UBTService_MosesZombieUpdateTarget::UBTService_MosesZombieUpdateTarget()
 {
 	NodeName = TEXT("Moses Update Target");
-	Interval = 0.3f;
-	RandomDeviation = 0.05f;
-	bNotifyBecomeRelevant = false;
-	bNotifyCeaseRelevant = false;
+
+	// Ÿ  Director ϰ н ->  ƽ  (/)
+	bNotifyTick = false;
+	bNotifyBecomeRelevant = true;
+	bNotifyCeaseRelevant = true;
 }
 
-void UBTService_MosesZombieUpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+UMosesZombieDirectorSubsystem* UBTService_MosesZombieUpdateTarget::ResolveDirector(UBehaviorTreeComponent& OwnerComp, AMosesZombieCharacter*& OutZombie) const
 {
-	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
+	OutZombie = nullptr;
 
 	AAIController* AIC = OwnerComp.GetAIOwner();
-	if (!AIC) return;
+	if (!AIC) return nullptr;
 
 	AMosesZombieCharacter* Zombie = Cast<AMosesZombieCharacter>(AIC->GetPawn());
-	if (!Zombie || !Zombie->HasAuthority()) return;
+	if (!Zombie || !Zombie->HasAuthority()) return nullptr;
 
-	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
-	if (!BB) return;
+	OutZombie = Zombie;
+	return Zombie->GetWorld()->GetSubsystem<UMosesZombieDirectorSubsystem>();
+}
 
-	AActor* CurTarget = Cast<AActor>(BB->GetValueAsObject(BBKey_TargetActor));
+void UBTService_MosesZombieUpdateTarget::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	Super::OnBecomeRelevant(OwnerComp, NodeMemory);
 
-	// 1)  Ÿ ȿϸ Ÿ  + ʹ ָ 
-	auto IsValidPlayerPawn = [](AActor* Actor)->APawn*
-		{
-			APawn* P = Cast<APawn>(Actor);
-			return (P && P->GetPlayerState()) ? P : nullptr;
-		};
+	AMosesZombieCharacter* Zombie = nullptr;
+	UMosesZombieDirectorSubsystem* Director = ResolveDirector(OwnerComp, Zombie);
+	if (!Director) return;
 
-	APawn* CurPawn = IsValidPlayerPawn(CurTarget);
+	Director->RegisterZombie_Server(Zombie, OwnerComp.GetBlackboardComponent(), BBKey_TargetActor, BBKey_DistanceToTarget, AcquireRadius);
+}
 
-	// 2)  Ÿ ų ȿ -> ݰ濡  Ÿ ã
-	if (!CurPawn)
+void UBTService_MosesZombieUpdateTarget::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	AMosesZombieCharacter* Zombie = nullptr;
+	if (UMosesZombieDirectorSubsystem* Director = ResolveDirector(OwnerComp, Zombie))
 	{
-		APawn* BestPawn = nullptr;
-		float BestDist = TNumericLimits<float>::Max();
-
-		UWorld* World = Zombie->GetWorld();
-		if (World)
-		{
-			for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
-			{
-				APlayerController* PC = It->Get();
-				if (!PC) continue;
-
-				APawn* P = PC->GetPawn();
-				if (!P || !P->GetPlayerState()) continue;
-
-				const float Dist = FVector::Dist(Zombie->GetActorLocation(), P->GetActorLocation());
-				if (Dist < BestDist && Dist <= AcquireRadius)
-				{
-					BestDist = Dist;
-					BestPawn = P;
-				}
-			}
-		}
-
-		if (BestPawn)
-		{
-			BB->SetValueAsObject(BBKey_TargetActor, BestPawn);
-			BB->SetValueAsFloat(BBKey_DistanceToTarget, BestDist);
-
-			UE_LOG(LogMosesZombie, Warning, TEXT("[ZAI][SV] AcquireTarget ByRadius Dist=%.0f R=%.0f Target=%s Zombie=%s"),
-				BestDist, AcquireRadius, *GetNameSafe(BestPawn), *GetNameSafe(Zombie));
-		}
-		else
-		{
-			BB->ClearValue(BBKey_TargetActor);
-			BB->SetValueAsFloat(BBKey_DistanceToTarget, 999999.f);
-		}
-
-		return;
+		Director->UnregisterZombie_Server(Zombie);
 	}
 
-	// 3)  Ÿ   (Ÿ )
-	const float Dist = FVector::Dist(Zombie->GetActorLocation(), CurPawn->GetActorLocation());
-	BB->SetValueAsFloat(BBKey_DistanceToTarget, Dist);
-
-	// 4)  ݰ  
-	if (Dist > AcquireRadius)
-	{
-		BB->ClearValue(BBKey_TargetActor);
-		BB->SetValueAsFloat(BBKey_DistanceToTarget, 999999.f);
-
-		UE_LOG(LogMosesZombie, Warning, TEXT("[ZAI][SV] TargetCleared TooFar Dist=%.0f R=%.0f Zombie=%s"),
-			Dist, AcquireRadius, *GetNameSafe(Zombie));
-	}
+	Super::OnCeaseRelevant(OwnerComp, NodeMemory);
 }
@@ -4,10 +4,13 @@
 #include "BehaviorTree/BTService.h"
 #include "BTService_MosesZombieUpdateTarget.generated.h"
 
+class AMosesZombieCharacter;
+class UMosesZombieDirectorSubsystem;
+
 /**
  * BTService - UpdateTarget (Server)
- * - TargetActor 유효성 체크
- * - 너무 멀면 타겟 해제 (MaxChaseDistance)
+ * - 좀비를 UMosesZombieDirectorSubsystem에 등록/해제 (BB 키 + AcquireRadius 전달)
+ * - 타겟 선정/해제/거리 갱신은 Director가 전 좀비 일괄 패스로 BB에 기록 (노드 틱 없음)
  */
 UCLASS()
 class UE5_MULTI_SHOOTER_API UBTService_MosesZombieUpdateTarget : public UBTService
@@ -18,7 +21,11 @@ public:
 	UBTService_MosesZombieUpdateTarget();
 
 protected:
-	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+	virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+	virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+private:
+	UMosesZombieDirectorSubsystem* ResolveDirector(UBehaviorTreeComponent& OwnerComp, AMosesZombieCharacter*& OutZombie) const;
 
 private:
 	UPROPERTY(EditAnywhere, Category="Moses|AI")
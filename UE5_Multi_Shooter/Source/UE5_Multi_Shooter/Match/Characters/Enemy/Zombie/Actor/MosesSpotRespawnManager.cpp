@@ -192,6 +192,7 @@ void AMosesSpotRespawnManager::ExecuteCountdown_Server()
 		*GetNameSafe(PendingRespawnSpot));
 
 	// ✅ STEP3 DoD의 ZOMBIE 로그는 SpawnSpot 내부에서 찍힘
+	// [MOD] 실제 배치는 UMosesZombieSpawnSchedulerSubsystem 큐에서 프레임 예산 단위로 분할
 	PendingRespawnSpot->ServerRespawnSpotZombies();
 
 	PendingRespawnSpot = nullptr;
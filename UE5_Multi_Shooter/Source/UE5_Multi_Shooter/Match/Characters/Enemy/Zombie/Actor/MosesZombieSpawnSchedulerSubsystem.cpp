@@ -0,0 +1,130 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesZombieSpawnSchedulerSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesZombieSpawnSchedulerSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/MosesStats.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesZombieSpawnSpot.h"
+
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesZombieSpawnSchedulerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesZombieSpawnSchedulerSubsystem::Deinitialize()
+{
+	Queue.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UMosesZombieSpawnSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMosesZombieSpawnSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+bool UMosesZombieSpawnSchedulerSubsystem::IsServer() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+void UMosesZombieSpawnSchedulerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Queue.IsEmpty() || !IsServer())
+	{
+		SET_DWORD_STAT(STAT_MosesZombieSpawnQueueDepth, Queue.Num());
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_MosesZombieSpawnProcess);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = FMath::Max(0.0f, SpawnBudgetMs) * 0.001;
+
+	int32 NumProcessed = 0;
+	double MaxLatencyMs = 0.0;
+
+	// FIFO: 앞에서부터 처리, 끝난 만큼 한 번에 제거
+	while (NumProcessed < Queue.Num())
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (NumProcessed >= MinSpawnsPerFrame && (Now - StartTime) >= BudgetSeconds)
+		{
+			break;
+		}
+
+		// 복사 (스폰 중 큐 변경 대비)
+		const FSpawnRequest Request = Queue[NumProcessed];
+		++NumProcessed;
+
+		AMosesZombieSpawnSpot* Spot = Request.Spot.Get();
+		if (!IsValid(Spot))
+		{
+			continue;
+		}
+
+		Spot->ProcessSpawnRequest_Server(Request.RequestIndex);
+
+		MaxLatencyMs = FMath::Max(MaxLatencyMs, (FPlatformTime::Seconds() - Request.EnqueueTime) * 1000.0);
+	}
+
+	Queue.RemoveAt(0, NumProcessed, EAllowShrinking::No);
+
+	SET_DWORD_STAT(STAT_MosesZombieSpawnQueueDepth, Queue.Num());
+	SET_FLOAT_STAT(STAT_MosesZombieSpawnLatencyMs, MaxLatencyMs);
+
+	UE_LOG(LogMosesZombie, Verbose, TEXT("[ZOMBIE][SPAWNQ][SV] Processed=%d Remaining=%d Elapsed=%.2fms MaxLatency=%.1fms"),
+		NumProcessed, Queue.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, MaxLatencyMs);
+}
+
+// ============================================================================
+// Queue
+// ============================================================================
+
+void UMosesZombieSpawnSchedulerSubsystem::EnqueueWave_Server(AMosesZombieSpawnSpot* Spot, int32 NumRequests)
+{
+	if (!Spot || NumRequests <= 0 || !IsServer())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	Queue.Reserve(Queue.Num() + NumRequests);
+	for (int32 RequestIndex = 0; RequestIndex < NumRequests; ++RequestIndex)
+	{
+		FSpawnRequest& Request = Queue.AddDefaulted_GetRef();
+		Request.Spot = Spot;
+		Request.RequestIndex = RequestIndex;
+		Request.EnqueueTime = Now;
+	}
+
+	UE_LOG(LogMosesZombie, Log, TEXT("[ZOMBIE][SPAWNQ][SV] EnqueueWave Spot=%s Count=%d QueueDepth=%d BudgetMs=%.2f"),
+		*GetNameSafe(Spot), NumRequests, Queue.Num(), SpawnBudgetMs);
+}
+
+void UMosesZombieSpawnSchedulerSubsystem::CancelSpot_Server(const AMosesZombieSpawnSpot* Spot)
+{
+	Queue.RemoveAll([Spot](const FSpawnRequest& Request)
+	{
+		return Request.Spot.Get() == Spot;
+	});
+}
@@ -0,0 +1,70 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesZombieSpawnSchedulerSubsystem.h
+// ----------------------------------------------------------------------------
+// Zombie Spawn Scheduler (Server)
+// - 스폰 웨이브(AMosesZombieSpawnSpot)를 좀비 1마리 단위 요청으로 큐잉
+// - 프레임당 예산(ms) 안에서만 처리 → 큰 웨이브도 단일 프레임 스파이크 없음
+//   · 최소 MinSpawnsPerFrame개는 예산과 무관하게 처리 (굶주림 방지)
+// - 예산은 Config(Game) → 서버 프로파일별 ini로 조정
+// - 스폰 포인트 선택(플레이어 시야 밖 우선)은 처리 시점에 Spot이 결정
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MosesZombieSpawnSchedulerSubsystem.generated.h"
+
+class AMosesZombieSpawnSpot;
+
+UCLASS(Config = Game)
+class UE5_MULTI_SHOOTER_API UMosesZombieSpawnSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// =========================================================================
+	// Queue (Server)
+	// =========================================================================
+
+	/** Spot의 좀비 NumRequests마리 요청 (RequestIndex = 0..NumRequests-1) */
+	void EnqueueWave_Server(AMosesZombieSpawnSpot* Spot, int32 NumRequests);
+
+	/** Spot의 대기 요청 제거 (새 웨이브가 이전 웨이브를 대체) */
+	void CancelSpot_Server(const AMosesZombieSpawnSpot* Spot);
+
+	int32 GetQueueDepth() const { return Queue.Num(); }
+
+private:
+	bool IsServer() const;
+
+private:
+	/** 프레임당 스폰 처리 예산 (ms) */
+	UPROPERTY(Config)
+	float SpawnBudgetMs = 2.0f;
+
+	/** 예산을 넘어도 프레임당 최소 처리 개수 */
+	UPROPERTY(Config)
+	int32 MinSpawnsPerFrame = 1;
+
+private:
+	struct FSpawnRequest
+	{
+		TWeakObjectPtr<AMosesZombieSpawnSpot> Spot;
+		int32 RequestIndex = 0;
+
+		/** FPlatformTime::Seconds (지연 통계) */
+		double EnqueueTime = 0.0;
+	};
+
+	TArray<FSpawnRequest> Queue;
+};
@@ -5,10 +5,12 @@
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesZombieSpawnSpot.h"
 
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/MosesZombieCharacter.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesZombieSpawnSchedulerSubsystem.h"
 #include "UE5_Multi_Shooter/MosesLogChannels.h"
 
 #include "Components/SceneComponent.h"
 #include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
 
 AMosesZombieSpawnSpot::AMosesZombieSpawnSpot()
 {
@@ -51,18 +53,77 @@ void AMosesZombieSpawnSpot::CleanupSpawnedZombies_Server()
 
 	int32 Removed = 0;
 
+	// [MOD] Destroy 대신 풀 반납 (액터/컨트롤러/ASC/BT 유지)
 	for (TObjectPtr<AMosesZombieCharacter>& Z : SpawnedZombies)
 	{
 		if (IsValid(Z))
 		{
-			Z->Destroy();
+			Z->DeactivateToPool_Server();
+			PooledZombies.Add(Z);
 			Removed++;
 		}
 	}
 
 	SpawnedZombies.Reset();
 
-	UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV] Cleanup Spot=%s Removed=%d"), *GetNameSafe(this), Removed);
+	UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV] Cleanup Spot=%s Pooled=%d PoolSize=%d"), *GetNameSafe(this), Removed, PooledZombies.Num());
+}
+
+void AMosesZombieSpawnSpot::ReleaseZombie_Server(AMosesZombieCharacter* Zombie)
+{
+	check(HasAuthority());
+
+	if (!IsValid(Zombie) || Zombie->IsPooled())
+	{
+		return;
+	}
+
+	SpawnedZombies.Remove(Zombie);
+
+	Zombie->DeactivateToPool_Server();
+	PooledZombies.Add(Zombie);
+}
+
+AMosesZombieCharacter* AMosesZombieSpawnSpot::AcquireZombie_Server(TSubclassOf<AMosesZombieCharacter> SpawnClass, const FTransform& SpawnTransform)
+{
+	check(HasAuthority());
+
+	// 1) 풀: 같은 클래스 (무효 항목은 정리)
+	for (int32 Index = PooledZombies.Num() - 1; Index >= 0; --Index)
+	{
+		AMosesZombieCharacter* Pooled = PooledZombies[Index].Get();
+		if (!IsValid(Pooled))
+		{
+			PooledZombies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (Pooled->GetClass() != SpawnClass)
+		{
+			continue;
+		}
+
+		PooledZombies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Pooled->ActivateFromPool_Server(SpawnTransform);
+		return Pooled;
+	}
+
+	// 2) 풀 미스: 최초 스폰 (이후 반납으로 풀에 편입)
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	AMosesZombieCharacter* Spawned = World->SpawnActorDeferred<AMosesZombieCharacter>(
+		SpawnClass, SpawnTransform, this, nullptr, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+
+	if (Spawned)
+	{
+		Spawned->FinishSpawning(SpawnTransform);
+	}
+
+	return Spawned;
 }
 
 void AMosesZombieSpawnSpot::CollectSpawnPointsFromChildren_Server()
@@ -143,47 +204,140 @@ void AMosesZombieSpawnSpot::SpawnZombies_Server()
 		return;
 	}
 
+	// [MOD] 새 웨이브: 포인트 사용 초기화 + 이전 대기 요청 대체
+	WavePointUsed.Init(false, SpawnPoints.Num());
+
+	UMosesZombieSpawnSchedulerSubsystem* Scheduler = GetWorld() ? GetWorld()->GetSubsystem<UMosesZombieSpawnSchedulerSubsystem>() : nullptr;
+	if (Scheduler)
+	{
+		Scheduler->CancelSpot_Server(this);
+		Scheduler->EnqueueWave_Server(this, SpawnPoints.Num());
+
+		UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV] Spawn Spot=%s Queued=%d"), *GetNameSafe(this), SpawnPoints.Num());
+		return;
+	}
+
+	// 스케줄러 없음 (비게임 월드) → 즉시
+	for (int32 RequestIndex = 0; RequestIndex < SpawnPoints.Num(); ++RequestIndex)
+	{
+		ProcessSpawnRequest_Server(RequestIndex);
+	}
+
+	UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV] Spawn Spot=%s Spawned=%d"), *GetNameSafe(this), SpawnedZombies.Num());
+}
+
+void AMosesZombieSpawnSpot::ProcessSpawnRequest_Server(int32 RequestIndex)
+{
+	check(HasAuthority());
+
+	if (ZombieClasses.Num() <= 0)
+	{
+		return;
+	}
+
+	const int32 PointIndex = PickSpawnPointIndex_Server();
+	if (PointIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	WavePointUsed[PointIndex] = true;
+
+	USceneComponent* P = SpawnPoints[PointIndex].Get();
+
+	const int32 ClassIdx = (RequestIndex % ZombieClasses.Num());
+	const TSubclassOf<AMosesZombieCharacter> SpawnClass = ZombieClasses[ClassIdx];
+	if (!SpawnClass)
+	{
+		return;
+	}
+
+	const FTransform TM = P->GetComponentTransform();
+
+	AMosesZombieCharacter* Spawned = AcquireZombie_Server(SpawnClass, TM);
+	if (!Spawned)
+	{
+		return;
+	}
+
+	SpawnedZombies.Add(Spawned);
+
+	// ✅ STEP3 DoD 로그 (2종 중 1개)
+	UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV] Spawn Spot=%s Zombie=%s Index=%d Point=%s"),
+		*GetNameSafe(this), *GetNameSafe(Spawned), PointIndex, *GetNameSafe(P));
+}
+
+int32 AMosesZombieSpawnSpot::PickSpawnPointIndex_Server() const
+{
 	UWorld* World = GetWorld();
 	if (!World)
 	{
-		return;
+		return INDEX_NONE;
 	}
 
-	int32 SpawnedCount = 0;
+	// 처리 시점 플레이어 시점 (웨이브가 여러 프레임에 걸치므로 매 요청 갱신)
+	TArray<FVector, TInlineAllocator<16>> ViewLocations;
+	TArray<FVector, TInlineAllocator<16>> ViewDirections;
 
-	for (int32 i = 0; i < SpawnPoints.Num(); ++i)
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
 	{
-		USceneComponent* P = SpawnPoints[i].Get();
-		if (!P)
+		const APlayerController* PC = It->Get();
+		if (!PC || !PC->GetPawn())
 		{
 			continue;
 		}
 
-		const int32 ClassIdx = (i % ZombieClasses.Num());
-		const TSubclassOf<AMosesZombieCharacter> SpawnClass = ZombieClasses[ClassIdx];
-		if (!SpawnClass)
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		ViewLocations.Add(ViewLocation);
+		ViewDirections.Add(ViewRotation.Vector());
+	}
+
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(ViewHalfAngleDeg));
+	const float ViewDistSq = FMath::Square(ViewCheckDistance);
+
+	int32 BestIndex = INDEX_NONE;
+	int32 BestSeenCount = MAX_int32;
+
+	for (int32 PointIndex = 0; PointIndex < SpawnPoints.Num(); ++PointIndex)
+	{
+		const USceneComponent* P = SpawnPoints[PointIndex].Get();
+		if (!P || (WavePointUsed.IsValidIndex(PointIndex) && WavePointUsed[PointIndex]))
 		{
 			continue;
 		}
 
-		const FTransform TM = P->GetComponentTransform();
-
-		AMosesZombieCharacter* Spawned = World->SpawnActorDeferred<AMosesZombieCharacter>(
-			SpawnClass, TM, this, nullptr, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+		const FVector PointLocation = P->GetComponentLocation();
 
-		if (!Spawned)
+		int32 SeenCount = 0;
+		for (int32 ViewIndex = 0; ViewIndex < ViewLocations.Num(); ++ViewIndex)
 		{
-			continue;
+			const FVector ToPoint = PointLocation - ViewLocations[ViewIndex];
+			const float DistSq = ToPoint.SizeSquared();
+			if (DistSq > ViewDistSq || DistSq <= KINDA_SMALL_NUMBER)
+			{
+				continue;
+			}
+
+			if (FVector::DotProduct(ToPoint * FMath::InvSqrt(DistSq), ViewDirections[ViewIndex]) >= CosHalfAngle)
+			{
+				++SeenCount;
+			}
 		}
 
-		Spawned->FinishSpawning(TM);
-		SpawnedZombies.Add(Spawned);
-		SpawnedCount++;
+		if (SeenCount < BestSeenCount)
+		{
+			BestSeenCount = SeenCount;
+			BestIndex = PointIndex;
 
-		// ✅ STEP3 DoD 로그 (2종 중 1개)
-		UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV] Spawn Spot=%s Zombie=%s Index=%d Point=%s"),
-			*GetNameSafe(this), *GetNameSafe(Spawned), i, *GetNameSafe(P));
+			if (SeenCount == 0)
+			{
+				break;
+			}
+		}
 	}
 
-	UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV] Spawn Spot=%s Spawned=%d"), *GetNameSafe(this), SpawnedCount);
+	return BestIndex;
 }
@@ -5,7 +5,11 @@
 // - Server Authority only
 // - SpawnPoints: Root의 자식 SceneComponent 중 이름이 "SP_" 접두사인 것들을
 //   서버 BeginPlay에서 자동 수집 (에디터 배열 수동 입력 금지)
-// - Respawn: 기존 스폰 좀비 제거 후 다시 스폰
+// - Respawn: 기존 스폰 좀비를 풀로 반납 후 풀에서 다시 배치
+//   · [MOD] 풀 = 숨김/충돌 OFF/BT 정지 좀비 재사용 (정상 상태 리스폰은 Spawn/Destroy 없음)
+//   · 풀에 같은 클래스가 없을 때만 SpawnActorDeferred
+// - [ADD] 웨이브 = UMosesZombieSpawnSchedulerSubsystem 큐 (프레임 예산 분할 처리)
+//   · 요청 처리 시점에 남은 포인트 중 플레이어 시야 밖을 우선 선택
 // - Evidence logs:
 //   - [ZOMBIE][SV] CollectSpawnPoints ...
 //   - [ZOMBIE][SV] Spawn Spot=...
@@ -28,10 +32,16 @@ class UE5_MULTI_SHOOTER_API AMosesZombieSpawnSpot : public AActor
 public:
 	AMosesZombieSpawnSpot();
 
-	/** 서버: 스팟 좀비 리스폰(기존 제거 -> 스폰) */
+	/** 서버: 스팟 좀비 리스폰(기존 반납 -> 풀에서 배치) */
 	UFUNCTION(BlueprintCallable, Category = "Zombie|Spawn")
 	void ServerRespawnSpotZombies();
 
+	/** 서버: 사망 정리 끝난 좀비 반납 (AMosesZombieCharacter) */
+	void ReleaseZombie_Server(AMosesZombieCharacter* Zombie);
+
+	/** 서버: 스폰 큐 요청 1건 처리 (UMosesZombieSpawnSchedulerSubsystem) */
+	void ProcessSpawnRequest_Server(int32 RequestIndex);
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -43,6 +53,12 @@ private:
 	void SpawnZombies_Server();
 	void CleanupSpawnedZombies_Server();
 
+	/** 이번 웨이브 미사용 포인트 중 보는 플레이어 수가 가장 적은 것 (동률 = 이름 순) */
+	int32 PickSpawnPointIndex_Server() const;
+
+	/** 풀에서 같은 클래스 꺼내 배치 (없으면 스폰) */
+	AMosesZombieCharacter* AcquireZombie_Server(TSubclassOf<AMosesZombieCharacter> SpawnClass, const FTransform& SpawnTransform);
+
 private:
 	// ---------------------------------------------------------------------
 	// Components
@@ -62,6 +78,14 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Zombie|Spawn", meta = (AllowPrivateAccess = "true"))
 	TArray<TSubclassOf<AMosesZombieCharacter>> ZombieClasses;
 
+	/** 시야 판정: 플레이어 시점 전방 반각 (도) */
+	UPROPERTY(EditDefaultsOnly, Category = "Zombie|Spawn", meta = (AllowPrivateAccess = "true"))
+	float ViewHalfAngleDeg = 55.f;
+
+	/** 시야 판정 거리 (이보다 멀면 보이지 않는 것으로 취급) */
+	UPROPERTY(EditDefaultsOnly, Category = "Zombie|Spawn", meta = (AllowPrivateAccess = "true"))
+	float ViewCheckDistance = 6000.f;
+
 private:
 	// ---------------------------------------------------------------------
 	// Runtime (Server)
@@ -70,7 +94,14 @@ private:
 	UPROPERTY(VisibleInstanceOnly, Category = "Zombie|Spawn", meta = (AllowPrivateAccess = "true"))
 	TArray<TObjectPtr<USceneComponent>> SpawnPoints;
 
-	/** 서버가 스폰한 좀비들(리스폰 시 Destroy) */
+	/** 서버가 배치한 활성 좀비들(리스폰 시 풀로 반납) */
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<AMosesZombieCharacter>> SpawnedZombies;
+
+	/** 현재 웨이브에서 이미 배치된 포인트 (SpawnPoints 인덱스) */
+	TBitArray<> WavePointUsed;
+
+	/** [ADD] 대기 좀비 (숨김/충돌 OFF/BT 정지) */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AMosesZombieCharacter>> PooledZombies;
 };
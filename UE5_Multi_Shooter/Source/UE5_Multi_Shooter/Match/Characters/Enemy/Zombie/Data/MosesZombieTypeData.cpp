@@ -5,6 +5,11 @@
 
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Data/MosesZombieTypeData.h"
 
+#include "UE5_Multi_Shooter/Match/Characters/Animation/AnimNotifies/Enemy/AnimNotifyState_MosesZombieAttackWindow.h"
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+
+#include "Animation/AnimMontage.h"
+
 UMosesZombieTypeData::UMosesZombieTypeData()
 {
 	MaxHP = 100.f;
@@ -17,6 +22,10 @@ UMosesZombieTypeData::UMosesZombieTypeData()
 	DyingMontage = nullptr;
 	DeathDestroyDelaySeconds = 0.f; // 0이면 Montage 길이 기반
 
+	// [ADD] 애님 OFF 손 경로 (R 기본값을 Y 반전해 L)
+	MeleeReach_L.Start.Y = -MeleeReach_R.Start.Y;
+	MeleeReach_L.End.Y = -MeleeReach_R.End.Y;
+
 	// AI defaults
 	SightRadius = 1500.f;
 	LoseSightRadius = 1800.f;
@@ -28,3 +37,101 @@ UMosesZombieTypeData::UMosesZombieTypeData()
 	AttackRange = 200.f;
 	AttackCooldownSeconds = 1.2f;
 }
+
+#if WITH_EDITOR
+void UMosesZombieTypeData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Montage 교체/노티파이 수정 반영 → 다음 조회 때 재베이크
+	AttackTimelines.Reset();
+	bAttackTimelinesBuilt = false;
+}
+#endif
+
+// ============================================================================
+// [ADD] Baked Attack Timeline
+// ============================================================================
+
+const FMosesZombieAttackTimeline* UMosesZombieTypeData::FindAttackTimeline(const UAnimMontage* Montage) const
+{
+	if (!Montage)
+	{
+		return nullptr;
+	}
+
+	if (!bAttackTimelinesBuilt)
+	{
+		BuildAttackTimelines();
+	}
+
+	return AttackTimelines.FindByPredicate([Montage](const FMosesZombieAttackTimeline& Timeline)
+	{
+		return Timeline.Montage == Montage;
+	});
+}
+
+void UMosesZombieTypeData::BuildAttackTimelines() const
+{
+	AttackTimelines.Reset(AttackMontages.Num());
+	bAttackTimelinesBuilt = true;
+
+	for (UAnimMontage* Montage : AttackMontages)
+	{
+		if (!Montage)
+		{
+			continue;
+		}
+
+		// Montage_Play(PlayRate 1.0) 기준 실제 경과 시간 = Montage 시간 / RateScale
+		const float InvRate = 1.f / FMath::Max(Montage->RateScale, KINDA_SMALL_NUMBER);
+
+		FMosesZombieAttackTimeline Timeline;
+		Timeline.Montage = Montage;
+		Timeline.PlayLength = Montage->GetPlayLength() * InvRate;
+
+		for (const FAnimNotifyEvent& NotifyEvent : Montage->Notifies)
+		{
+			const UAnimNotifyState_MosesZombieAttackWindow* Window = Cast<UAnimNotifyState_MosesZombieAttackWindow>(NotifyEvent.NotifyStateClass);
+			if (!Window)
+			{
+				continue;
+			}
+
+			// Add 중 재할당될 수 있으므로 시각을 먼저 계산
+			const float BeginTime = FMath::Clamp(NotifyEvent.GetTriggerTime() * InvRate, 0.f, Timeline.PlayLength);
+			const float EndTime = FMath::Clamp(NotifyEvent.GetEndTriggerTime() * InvRate, BeginTime, Timeline.PlayLength);
+
+			FMosesZombieAttackWindowEvent& Begin = Timeline.Events.AddDefaulted_GetRef();
+			Begin.Time = BeginTime;
+			Begin.Hand = Window->AttackHand;
+			Begin.bEnabled = true;
+			Begin.bResetHitActorsOnBegin = Window->bResetHitActorsOnBegin;
+			Begin.WindowDuration = EndTime - BeginTime;
+
+			FMosesZombieAttackWindowEvent& End = Timeline.Events.AddDefaulted_GetRef();
+			End.Time = EndTime;
+			End.Hand = Window->AttackHand;
+			End.bEnabled = false;
+		}
+
+		// AttackWindow 노티파이 없음 → 타임라인 미등록 (노티파이/시퀀스 경로가 그대로 동작)
+		if (Timeline.Events.Num() == 0)
+		{
+			UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][TIMELINE] Skip Data=%s Montage=%s (No AttackWindow notify on montage, using notify path)"),
+				*GetName(), *GetNameSafe(Montage));
+			continue;
+		}
+
+		// 시간순, 같은 시각이면 닫기 먼저 (연속 윈도우가 바로 닫히지 않게)
+		Timeline.Events.StableSort([](const FMosesZombieAttackWindowEvent& A, const FMosesZombieAttackWindowEvent& B)
+		{
+			return (A.Time != B.Time) ? (A.Time < B.Time) : (!A.bEnabled && B.bEnabled);
+		});
+
+		UE_LOG(LogMosesZombie, Log, TEXT("[ZOMBIE][TIMELINE] Baked Data=%s Montage=%s Length=%.2f Events=%d"),
+			*GetName(), *GetNameSafe(Montage), Timeline.PlayLength, Timeline.Events.Num());
+
+		AttackTimelines.Add(MoveTemp(Timeline));
+	}
+}
@@ -8,6 +8,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Types/MosesZombieAttackTypes.h"
 #include "MosesZombieTypeData.generated.h"
 
 class UAnimMontage;
@@ -25,6 +26,17 @@ class UE5_MULTI_SHOOTER_API UMosesZombieTypeData : public UDataAsset
 public:
 	UMosesZombieTypeData();
 
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// -------------------------
+	// [ADD] Baked Attack Timeline (Server)
+	// - AttackMontages AttackWindow Ƽ̸  ȸ  1ȸ ũ
+	// -  Montage / AttackWindow Ƽ̰  Montage nullptr (Ƽ  )
+	// -------------------------
+	const FMosesZombieAttackTimeline* FindAttackTimeline(const UAnimMontage* Montage) const;
+
 public:
 	// ---- Combat ----
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|Combat")
@@ -83,4 +95,28 @@ public:
 
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|AI|Attack")
 	float AttackCooldownSeconds = 1.2f;
+
+	// -------------------------
+	// [ADD] Server Animation
+	// - true    ޽ ִ ƽ/ OFF
+	// -  /,   ũ ŸӶ(Montage ) 
+	// - OFF      /HitZone   Ŭ ȭ ߳
+	//   (/޽  ʿ  ŸԿ  , ⺻ false)
+	// -------------------------
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|Server")
+	bool bDisableAnimTickOnDedicatedServer = false;
+
+	// [ADD] ִ OFF     ( Ʈ ,    Start  End)
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|Server")
+	FMosesZombieHandReach MeleeReach_L;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|Server")
+	FMosesZombieHandReach MeleeReach_R;
+
+private:
+	void BuildAttackTimelines() const;
+
+private:
+	mutable TArray<FMosesZombieAttackTimeline> AttackTimelines;
+	mutable bool bAttackTimelinesBuilt = false;
 };
@@ -2,6 +2,8 @@
 
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Data/MosesZombieTypeData.h"
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AttributeSet/MosesZombieAttributeSet.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AI/MosesZombieAIController.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesZombieSpawnSpot.h"
 #include "UE5_Multi_Shooter/Match/Characters/Animation/MosesZombieAnimInstance.h"
 
 #include "UE5_Multi_Shooter/Match/GameState/MosesMatchGameState.h"
@@ -9,7 +11,10 @@
 #include "UE5_Multi_Shooter/Match/GAS/Components/MosesAbilitySystemComponent.h"
 #include "UE5_Multi_Shooter/Match/GAS/MosesGameplayTags.h"
 #include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/MosesStats.h"
 #include "UE5_Multi_Shooter/MosesPlayerController.h" 
+#include "UE5_Multi_Shooter/Match/Combat/MosesLagCompensationSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesHitZoneSubsystem.h"
 
 #include "Components/BoxComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -17,6 +22,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Animation/AnimInstance.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 #include "AIController.h"
 
 #include "AbilitySystemComponent.h"
@@ -40,26 +46,21 @@ AMosesZombieCharacter::AMosesZombieCharacter()
 
 	AttributeSet = CreateDefaultSubobject<UMosesZombieAttributeSet>(TEXT("AS_Zombie"));
 
+	// [MOD] 히트박스 = 스윕 형상 (충돌 바디/오버랩 없음, 판정은 윈도우 동안 서버 스윕)
 	AttackHitBox_L = CreateDefaultSubobject<UBoxComponent>(TEXT("AttackHitBox_L"));
 	AttackHitBox_L->SetupAttachment(GetMesh());
 	AttackHitBox_L->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	AttackHitBox_L->SetCollisionObjectType(ECC_WorldDynamic);
-	AttackHitBox_L->SetCollisionResponseToAllChannels(ECR_Ignore);
-	AttackHitBox_L->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-	AttackHitBox_L->SetGenerateOverlapEvents(true);
-	AttackHitBox_L->OnComponentBeginOverlap.AddDynamic(this, &AMosesZombieCharacter::OnAttackHitOverlapBegin);
+	AttackHitBox_L->SetGenerateOverlapEvents(false);
+	AttackHitBox_L->SetCanEverAffectNavigation(false);
 
 	AttackHitBox_R = CreateDefaultSubobject<UBoxComponent>(TEXT("AttackHitBox_R"));
 	AttackHitBox_R->SetupAttachment(GetMesh());
 	AttackHitBox_R->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	AttackHitBox_R->SetCollisionObjectType(ECC_WorldDynamic);
-	AttackHitBox_R->SetCollisionResponseToAllChannels(ECR_Ignore);
-	AttackHitBox_R->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-	AttackHitBox_R->SetGenerateOverlapEvents(true);
-	AttackHitBox_R->OnComponentBeginOverlap.AddDynamic(this, &AMosesZombieCharacter::OnAttackHitOverlapBegin);
+	AttackHitBox_R->SetGenerateOverlapEvents(false);
+	AttackHitBox_R->SetCanEverAffectNavigation(false);
 
-	bAttackHitEnabled_L = false;
-	bAttackHitEnabled_R = false;
+	MeleeHand_L = FMeleeHandSweep();
+	MeleeHand_R = FMeleeHandSweep();
 
 	NextAttackServerTime = 0.0;
 	bIsAttacking_Server = false;
@@ -103,23 +104,191 @@ void AMosesZombieCharacter::BeginPlay()
 		}
 	}
 
-	// 클라 비용 절감(서버만 판정)
-	if (!HasAuthority())
-	{
-		if (AttackHitBox_L) { AttackHitBox_L->SetGenerateOverlapEvents(false); }
-		if (AttackHitBox_R) { AttackHitBox_R->SetGenerateOverlapEvents(false); }
-	}
-
 	if (HasAuthority())
 	{
 		InitializeAttributes_Server();
 		UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV] Spawned Zombie=%s"), *GetName());
+
+		if (UCapsuleComponent* Capsule = GetCapsuleComponent())
+		{
+			CapsuleCollisionDefault = Capsule->GetCollisionEnabled();
+		}
+
+		RegisterHitTargets_Server();
+		ApplyServerAnimationPolicy();
 	}
 
+	RegisterHitZones();
+
 	// spawn 시 dead는 false로 강제 동기화
 	Multicast_SetDeadState(false);
 }
 
+void AMosesZombieCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (HasAuthority() && !bPooled)
+	{
+		UnregisterHitTargets_Server();
+	}
+
+	UnregisterHitZones();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMosesZombieCharacter::RegisterHitTargets_Server()
+{
+	// [ADD] Lag Compensation 히트볼륨 등록(서버): 캡슐 + 메시(Head 본 판정)
+	if (UMosesLagCompensationSubsystem* LagComp = GetWorld() ? GetWorld()->GetSubsystem<UMosesLagCompensationSubsystem>() : nullptr)
+	{
+		LagComp->RegisterTarget_Server(this, GetCapsuleComponent(), GetMesh(), nullptr);
+	}
+}
+
+void AMosesZombieCharacter::UnregisterHitTargets_Server()
+{
+	if (UMosesLagCompensationSubsystem* LagComp = GetWorld() ? GetWorld()->GetSubsystem<UMosesLagCompensationSubsystem>() : nullptr)
+	{
+		LagComp->UnregisterTarget_Server(this);
+	}
+}
+
+void AMosesZombieCharacter::RegisterHitZones()
+{
+	// [MOD] "HitZone.*" 태그 히트박스 1회 스캔 + 메시 테이블은 이 좀비의 HeadBoneName으로 선빌드
+	if (UMosesHitZoneSubsystem* HitZones = GetWorld() ? GetWorld()->GetSubsystem<UMosesHitZoneSubsystem>() : nullptr)
+	{
+		HitZones->RegisterTaggedComponents(this);
+		HitZones->RegisterSkeletalMesh(GetMesh(), HeadBoneName);
+	}
+}
+
+void AMosesZombieCharacter::UnregisterHitZones()
+{
+	if (UMosesHitZoneSubsystem* HitZones = GetWorld() ? GetWorld()->GetSubsystem<UMosesHitZoneSubsystem>() : nullptr)
+	{
+		HitZones->UnregisterActor(this);
+	}
+}
+
+// ============================================================================
+// [ADD] Pool (Server)
+// - 대기 = 숨김 + 충돌 OFF + BT 정지 + 이동 정지 (액터/컨트롤러/ASC/BT 인스턴스 유지)
+//   · 숨김+충돌 OFF → 클라 Relevancy 해제 (대기 중 복제 비용 없음)
+// - 재사용 = 상태 리셋 + InitializeAttributes_Server + 텔레포트 + BT 재시작
+// ============================================================================
+
+void AMosesZombieCharacter::ActivateFromPool_Server(const FTransform& SpawnTransform)
+{
+	check(HasAuthority());
+
+	GetWorldTimerManager().ClearTimer(DeathCleanupTimerHandle);
+	SetLifeSpan(0.f);
+
+	bIsDying_Server = false;
+	bIsAttacking_Server = false;
+	NextAttackServerTime = 0.0;
+	StopAttackTimeline_Server();
+	LastDamageKillerPS = nullptr;
+	bLastDamageHeadshot = false;
+
+	ResetHitActorsThisWindow();
+	SetAttackHitEnabled_Server(EMosesZombieAttackHand::Both, false);
+
+	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
+	{
+		Capsule->SetCollisionEnabled(CapsuleCollisionDefault);
+	}
+
+	SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.Rotator(), false, nullptr, ETeleportType::TeleportPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	bPooled = false;
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->SetComponentTickEnabled(true);
+		MoveComp->SetDefaultMovementMode();
+	}
+
+	InitializeAttributes_Server();
+	RegisterHitTargets_Server();
+
+	Multicast_SetDeadState(false);
+
+	if (AMosesZombieAIController* AIC = Cast<AMosesZombieAIController>(GetController()))
+	{
+		AIC->RestartBehavior_Server();
+	}
+
+	ForceNetUpdate();
+
+	UE_LOG(LogMosesZombie, Log, TEXT("[ZOMBIE][POOL][SV] Activate Zombie=%s Loc=%s"),
+		*GetName(), *SpawnTransform.GetLocation().ToString());
+}
+
+void AMosesZombieCharacter::DeactivateToPool_Server()
+{
+	check(HasAuthority());
+
+	GetWorldTimerManager().ClearTimer(DeathCleanupTimerHandle);
+	SetLifeSpan(0.f);
+
+	bPooled = true;
+	bIsAttacking_Server = false;
+	StopAttackTimeline_Server();
+	SetAttackHitEnabled_Server(EMosesZombieAttackHand::Both, false);
+
+	if (UAnimInstance* AnimInst = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr)
+	{
+		AnimInst->StopAllMontages(0.f);
+	}
+
+	if (AMosesZombieAIController* AIC = Cast<AMosesZombieAIController>(GetController()))
+	{
+		AIC->StopBehavior_Server();
+	}
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->StopMovementImmediately();
+		MoveComp->DisableMovement();
+		MoveComp->SetComponentTickEnabled(false);
+	}
+
+	UnregisterHitTargets_Server();
+
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+
+	ForceNetUpdate();
+
+	UE_LOG(LogMosesZombie, Log, TEXT("[ZOMBIE][POOL][SV] Deactivate Zombie=%s"), *GetName());
+}
+
+void AMosesZombieCharacter::ScheduleDeathCleanup_Server(float DelaySeconds)
+{
+	if (Cast<AMosesZombieSpawnSpot>(GetOwner()))
+	{
+		GetWorldTimerManager().SetTimer(DeathCleanupTimerHandle, this, &AMosesZombieCharacter::HandleDeathCleanupExpired_Server, DelaySeconds, false);
+		return;
+	}
+
+	SetLifeSpan(DelaySeconds);
+}
+
+void AMosesZombieCharacter::HandleDeathCleanupExpired_Server()
+{
+	if (AMosesZombieSpawnSpot* Spot = Cast<AMosesZombieSpawnSpot>(GetOwner()))
+	{
+		Spot->ReleaseZombie_Server(this);
+		return;
+	}
+
+	Destroy();
+}
+
 void AMosesZombieCharacter::OnConstruction(const FTransform& Transform)
 {
 	Super::OnConstruction(Transform);
@@ -285,7 +454,20 @@ void AMosesZombieCharacter::ServerStartAttack()
 		return;
 	}
 
-	if (UAnimInstance* AnimInst = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr)
+	// [MOD] 베이크 타임라인이 있으면 윈도우/종료를 타임라인이 구동 (노티파이/몽타주 종료 델리게이트 불필요)
+	if (const FMosesZombieAttackTimeline* Timeline = ZombieTypeData ? ZombieTypeData->FindAttackTimeline(Montage) : nullptr)
+	{
+		StartAttackTimeline_Server(*Timeline);
+	}
+	else if (IsServerAnimationDisabled())
+	{
+		// 애님 OFF + AttackWindow 없음 → 노티파이/종료 델리게이트가 올 수 없으니 길이만 구동 (공격 종료 보장)
+		FMosesZombieAttackTimeline LengthOnly;
+		LengthOnly.Montage = Montage;
+		LengthOnly.PlayLength = Montage->GetPlayLength() / FMath::Max(Montage->RateScale, KINDA_SMALL_NUMBER);
+		StartAttackTimeline_Server(LengthOnly);
+	}
+	else if (UAnimInstance* AnimInst = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr)
 	{
 		FOnMontageEnded EndDel;
 		EndDel.BindUObject(this, &AMosesZombieCharacter::OnAttackMontageEnded_Server);
@@ -295,12 +477,94 @@ void AMosesZombieCharacter::ServerStartAttack()
 	Multicast_PlayAttackMontage(Montage);
 }
 
-void AMosesZombieCharacter::ServerSetMeleeAttackWindow(EMosesZombieAttackHand Hand, bool bEnabled, bool bResetHitActorsOnBegin)
+// ============================================================================
+// [ADD] Attack Timeline (Server)
+// - 데디 서버는 좀비 메시 애님 틱/평가 OFF → 노티파이 타이밍을 얻을 수 없음
+// - UMosesZombieTypeData가 베이크한 윈도우 이벤트를 타이머 1개로 순서대로 재생
+//   · 타이머가 늦게 와도 경과 시간 기준으로 밀린 이벤트를 한 번에 처리
+// ============================================================================
+
+bool AMosesZombieCharacter::IsServerAnimationDisabled() const
+{
+	return GetNetMode() == NM_DedicatedServer && ZombieTypeData && ZombieTypeData->bDisableAnimTickOnDedicatedServer;
+}
+
+void AMosesZombieCharacter::ApplyServerAnimationPolicy()
+{
+	USkeletalMeshComponent* MeshComp = GetMesh();
+	if (!MeshComp || !IsServerAnimationDisabled())
+	{
+		return;
+	}
+
+	// 렌더링이 없는 데디 서버 → 포즈 틱/본 갱신 없음 (히트박스/헤드 본은 마지막 포즈 기준)
+	MeshComp->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+	MeshComp->SetComponentTickEnabled(false);
+
+	UE_LOG(LogMosesZombie, Log, TEXT("[ZOMBIE][TIMELINE][SV] AnimTick OFF (DedicatedServer) Zombie=%s"), *GetName());
+}
+
+void AMosesZombieCharacter::StartAttackTimeline_Server(const FMosesZombieAttackTimeline& Timeline)
+{
+	StopAttackTimeline_Server();
+
+	ActiveAttackTimeline = Timeline;
+	AttackTimelineNextEvent = 0;
+	AttackTimelineStartTime = GetWorld()->GetTimeSeconds();
+	bAttackTimelineActive_Server = true;
+
+	AdvanceAttackTimeline_Server();
+}
+
+void AMosesZombieCharacter::AdvanceAttackTimeline_Server()
+{
+	if (!bAttackTimelineActive_Server)
+	{
+		return;
+	}
+
+	const float Elapsed = static_cast<float>(GetWorld()->GetTimeSeconds() - AttackTimelineStartTime);
+	const TArray<FMosesZombieAttackWindowEvent, TInlineAllocator<4>>& Events = ActiveAttackTimeline.Events;
+
+	while (AttackTimelineNextEvent < Events.Num() && Events[AttackTimelineNextEvent].Time <= Elapsed)
+	{
+		const FMosesZombieAttackWindowEvent& Event = Events[AttackTimelineNextEvent++];
+		ServerSetMeleeAttackWindow(Event.Hand, Event.bEnabled, Event.bResetHitActorsOnBegin, Event.WindowDuration);
+
+		// 윈도우 처리 중 사망/풀 반납으로 중단됐을 수 있음
+		if (!bAttackTimelineActive_Server)
+		{
+			return;
+		}
+	}
+
+	if (AttackTimelineNextEvent >= Events.Num() && Elapsed >= ActiveAttackTimeline.PlayLength)
+	{
+		StopAttackTimeline_Server();
+		OnAttackMontageEnded_Server(ActiveAttackTimeline.Montage, false);
+		return;
+	}
+
+	const float NextTime = (AttackTimelineNextEvent < Events.Num())
+		? Events[AttackTimelineNextEvent].Time
+		: ActiveAttackTimeline.PlayLength;
+
+	GetWorldTimerManager().SetTimer(AttackTimelineHandle, this, &AMosesZombieCharacter::AdvanceAttackTimeline_Server,
+		FMath::Max(NextTime - Elapsed, KINDA_SMALL_NUMBER), false);
+}
+
+void AMosesZombieCharacter::StopAttackTimeline_Server()
+{
+	bAttackTimelineActive_Server = false;
+	GetWorldTimerManager().ClearTimer(AttackTimelineHandle);
+}
+
+void AMosesZombieCharacter::ServerSetMeleeAttackWindow(EMosesZombieAttackHand Hand, bool bEnabled, bool bResetHitActorsOnBegin, float WindowDuration)
 {
 	UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][HITBOX][SV] Window Hand=%d Enabled=%d Reset=%d L=%d R=%d"),
 		(int32)Hand, bEnabled ? 1 : 0, bResetHitActorsOnBegin ? 1 : 0,
-		AttackHitBox_L ? (int32)AttackHitBox_L->GetCollisionEnabled() : -1,
-		AttackHitBox_R ? (int32)AttackHitBox_R->GetCollisionEnabled() : -1);
+		MeleeHand_L.bEnabled ? 1 : 0,
+		MeleeHand_R.bEnabled ? 1 : 0);
 
 
 	if (!HasAuthority() || bIsDying_Server)
@@ -313,7 +577,7 @@ void AMosesZombieCharacter::ServerSetMeleeAttackWindow(EMosesZombieAttackHand Ha
 		ResetHitActorsThisWindow();
 	}
 
-	SetAttackHitEnabled_Server(Hand, bEnabled);
+	SetAttackHitEnabled_Server(Hand, bEnabled, WindowDuration);
 
 	if (!bEnabled)
 	{
@@ -321,39 +585,160 @@ void AMosesZombieCharacter::ServerSetMeleeAttackWindow(EMosesZombieAttackHand Ha
 	}
 }
 
-void AMosesZombieCharacter::SetAttackHitEnabled_Server(EMosesZombieAttackHand Hand, bool bEnabled)
+void AMosesZombieCharacter::SetAttackHitEnabled_Server(EMosesZombieAttackHand Hand, bool bEnabled, float WindowDuration)
 {
 	if (!HasAuthority())
 	{
 		return;
 	}
 
-	const auto SetOne = [bEnabled](UBoxComponent* Box)
+	if (Hand != EMosesZombieAttackHand::Right)
+	{
+		SetOneHandSweepEnabled_Server(EMosesZombieAttackHand::Left, bEnabled, WindowDuration);
+	}
+	if (Hand != EMosesZombieAttackHand::Left)
+	{
+		SetOneHandSweepEnabled_Server(EMosesZombieAttackHand::Right, bEnabled, WindowDuration);
+	}
+
+	// 스윕 타이머는 윈도우가 하나라도 열려 있을 때만
+	FTimerManager& TimerManager = GetWorldTimerManager();
+	if (MeleeHand_L.bEnabled || MeleeHand_R.bEnabled)
+	{
+		if (!TimerManager.IsTimerActive(MeleeSweepTimerHandle))
 		{
-			if (!Box) { return; }
-			Box->SetCollisionEnabled(bEnabled ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
-		};
+			TimerManager.SetTimer(MeleeSweepTimerHandle, this, &AMosesZombieCharacter::TickMeleeSweep_Server,
+				FMath::Max(0.01f, MeleeSweepInterval), true);
+		}
+	}
+	else
+	{
+		TimerManager.ClearTimer(MeleeSweepTimerHandle);
+	}
+}
+
+// ============================================================================
+// [ADD] Melee Sweep (Server)
+// - 히트박스는 충돌 바디가 없음 → 공격 사이 물리 씬에 움직이는 오버랩 볼륨 없음
+// - 윈도우가 열린 동안만 손 경로(직전 위치 → 현재 위치)를 박스 스윕
+//   · 양손 스윕 결과를 한 번에 모아 처리 (HitActorsThisWindow로 손 간 중복 제거)
+//   · 열릴 때 0 길이 스윕 = 기존 BeginOverlap, 닫힐 때 마지막 구간까지 스윕
+// - [MOD] 애님 OFF(데디)면 손 소켓이 고정 → 타입 데이터 Reach(루트 기준)를
+//   윈도우 경과 비율로 보간한 위치를 손 위치로 사용
+// ============================================================================
+
+void AMosesZombieCharacter::SetOneHandSweepEnabled_Server(EMosesZombieAttackHand Side, bool bEnabled, float WindowDuration)
+{
+	FMeleeHandSweep& Hand = GetMeleeHandSweep(Side);
+	if (Hand.bEnabled == bEnabled)
+	{
+		return;
+	}
+
+	TArray<FHitResult> Hits;
+
+	if (bEnabled)
+	{
+		Hand.WindowStartTime = GetWorld()->GetTimeSeconds();
+		Hand.WindowDuration = WindowDuration;
+
+		FQuat Rotation;
+		FVector HalfExtent;
+		if (!GetHandSweepPose_Server(Side, Hand.LastLocation, Rotation, HalfExtent))
+		{
+			return;
+		}
+
+		SweepHand_Server(Side, Hits);
+	}
+	else if (!bIsDying_Server && !bPooled)
+	{
+		SweepHand_Server(Side, Hits);
+	}
+
+	Hand.bEnabled = bEnabled;
 
-	switch (Hand)
+	for (const FHitResult& Hit : Hits)
 	{
-	case EMosesZombieAttackHand::Left:
-		bAttackHitEnabled_L = bEnabled;
-		SetOne(AttackHitBox_L);
-		break;
-	case EMosesZombieAttackHand::Right:
-		bAttackHitEnabled_R = bEnabled;
-		SetOne(AttackHitBox_R);
-		break;
-	case EMosesZombieAttackHand::Both:
-	default:
-		bAttackHitEnabled_L = bEnabled;
-		bAttackHitEnabled_R = bEnabled;
-		SetOne(AttackHitBox_L);
-		SetOne(AttackHitBox_R);
-		break;
+		TryApplyMeleeHit_Server(Hit.GetActor());
 	}
 }
 
+void AMosesZombieCharacter::TickMeleeSweep_Server()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MosesZombieMeleeSweep);
+
+	if (!HasAuthority() || bIsDying_Server || bPooled)
+	{
+		return;
+	}
+
+	TArray<FHitResult> Hits;
+
+	if (MeleeHand_L.bEnabled)
+	{
+		SweepHand_Server(EMosesZombieAttackHand::Left, Hits);
+	}
+	if (MeleeHand_R.bEnabled)
+	{
+		SweepHand_Server(EMosesZombieAttackHand::Right, Hits);
+	}
+
+	for (const FHitResult& Hit : Hits)
+	{
+		TryApplyMeleeHit_Server(Hit.GetActor());
+	}
+}
+
+bool AMosesZombieCharacter::GetHandSweepPose_Server(EMosesZombieAttackHand Side, FVector& OutLocation, FQuat& OutRotation, FVector& OutHalfExtent) const
+{
+	// 애님 OFF: 포즈 고정 → 루트 기준 Reach를 윈도우 경과 비율로 보간
+	if (IsServerAnimationDisabled())
+	{
+		const FMeleeHandSweep& Hand = GetMeleeHandSweep(Side);
+		const FMosesZombieHandReach& Reach = (Side == EMosesZombieAttackHand::Left) ? ZombieTypeData->MeleeReach_L : ZombieTypeData->MeleeReach_R;
+
+		const float Elapsed = static_cast<float>(GetWorld()->GetTimeSeconds() - Hand.WindowStartTime);
+		const float Alpha = (Hand.WindowDuration > KINDA_SMALL_NUMBER) ? (Elapsed / Hand.WindowDuration) : 1.f;
+
+		OutLocation = FMosesZombieMeleeSweep::GetReachLocation(GetActorTransform(), Reach, Alpha);
+		OutRotation = GetActorQuat();
+		OutHalfExtent = Reach.HalfExtent;
+		return true;
+	}
+
+	const UBoxComponent* Box = (Side == EMosesZombieAttackHand::Left) ? AttackHitBox_L.Get() : AttackHitBox_R.Get();
+	if (!Box)
+	{
+		return false;
+	}
+
+	OutLocation = Box->GetComponentLocation();
+	OutRotation = Box->GetComponentQuat();
+	OutHalfExtent = Box->GetScaledBoxExtent();
+	return true;
+}
+
+void AMosesZombieCharacter::SweepHand_Server(EMosesZombieAttackHand Side, TArray<FHitResult>& OutHits)
+{
+	FVector End;
+	FQuat Rotation;
+	FVector HalfExtent;
+	if (!GetHandSweepPose_Server(Side, End, Rotation, HalfExtent))
+	{
+		return;
+	}
+
+	FMeleeHandSweep& Hand = GetMeleeHandSweep(Side);
+
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(Moses_ZombieMeleeSweep), false, this);
+	FMosesZombieMeleeSweep::SweepBox(GetWorld(), Hand.LastLocation, End, Rotation, HalfExtent, Params, OutHits);
+
+	INC_DWORD_STAT(STAT_MosesZombieMeleeSweepCount);
+
+	Hand.LastLocation = End;
+}
+
 UAbilitySystemComponent* AMosesZombieCharacter::FindASCFromActor_Server(AActor* TargetActor) const
 {
 	if (!HasAuthority() || !TargetActor)
@@ -408,18 +793,8 @@ bool AMosesZombieCharacter::ApplySetByCallerDamageGE_Server(UAbilitySystemCompon
 	return true;
 }
 
-void AMosesZombieCharacter::OnAttackHitOverlapBegin(
-	UPrimitiveComponent* OverlappedComp,
-	AActor* OtherActor,
-	UPrimitiveComponent* /*OtherComp*/,
-	int32 /*OtherBodyIndex*/,
-	bool /*bFromSweep*/,
-	const FHitResult& /*SweepResult*/)
+void AMosesZombieCharacter::TryApplyMeleeHit_Server(AActor* OtherActor)
 {
-	UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][HIT][SV] Overlap Comp=%s Other=%s"),
-		*GetNameSafe(OverlappedComp),
-		*GetNameSafe(OtherActor));
-
 	if (!HasAuthority() || bIsDying_Server)
 	{
 		return;
@@ -430,13 +805,6 @@ void AMosesZombieCharacter::OnAttackHitOverlapBegin(
 		return;
 	}
 
-	const bool bIsLeft = (OverlappedComp == AttackHitBox_L);
-	const bool bIsRight = (OverlappedComp == AttackHitBox_R);
-
-	if (bIsLeft && !bAttackHitEnabled_L) { return; }
-	if (bIsRight && !bAttackHitEnabled_R) { return; }
-	if (!bIsLeft && !bIsRight) { return; }
-
 	const APawn* VictimPawn = Cast<APawn>(OtherActor);
 	if (!VictimPawn || !VictimPawn->GetPlayerState())
 	{
@@ -513,7 +881,7 @@ void AMosesZombieCharacter::HandleDamageAppliedFromGAS_Server(const FGameplayEff
 	const FGameplayEffectContextHandle& Ctx = Data.EffectSpec.GetContext();
 
 	LastDamageKillerPS = ResolveKillerPlayerState_FromEffectContext_Server(Ctx);
-	bLastDamageHeadshot = ResolveHeadshot_FromEffectContext_Server(Ctx);
+	bLastDamageHeadshot = ResolveHeadshot_FromEffectSpec_Server(Data.EffectSpec);
 
 	UE_LOG(LogMosesZombie, Warning,
 		TEXT("[ZOMBIE][SV] TookDamage Zombie=%s Damage=%.1f NewHP=%.1f KillerPS=%s Headshot=%d"),
@@ -529,6 +897,11 @@ void AMosesZombieCharacter::HandleDamageAppliedFromGAS_Server(const FGameplayEff
 	}
 }
 
+APawn* AMosesZombieCharacter::GetLastAttackerPawn_Server() const
+{
+	return LastDamageKillerPS ? LastDamageKillerPS->GetPawn() : nullptr;
+}
+
 AMosesPlayerState* AMosesZombieCharacter::ResolveKillerPlayerState_FromEffectContext_Server(const FGameplayEffectContextHandle& Context) const
 {
 	// 1) 가장 안전: OriginalInstigator -> Pawn -> PlayerState
@@ -552,17 +925,28 @@ AMosesPlayerState* AMosesZombieCharacter::ResolveKillerPlayerState_FromEffectCon
 	return nullptr;
 }
 
-bool AMosesZombieCharacter::ResolveHeadshot_FromEffectContext_Server(const FGameplayEffectContextHandle& Context) const
+bool AMosesZombieCharacter::ResolveHeadshot_FromEffectSpec_Server(const FGameplayEffectSpec& Spec) const
 {
-	// 현재 프로젝트 컨텍스트에 헤드샷 정보 주입이 없으면 false
-	// 확장 시: Context.GetHitResult() 기반 또는 Tag 기반으로 처리
-	const FHitResult* HR = Context.GetHitResult();
-	if (!HR)
+	// [MOD] 1) 히트 시점 HitZone 분류 결과(Hit.Headshot 태그)가 우선
+	if (Spec.GetDynamicAssetTags().HasTagExact(FMosesGameplayTags::Get().Hit_Headshot))
+	{
+		return true;
+	}
+
+	// [MOD] 2) 태그 없는 경로: Context HitResult를 같은 HitZone 테이블로 분류 (하위 본/Head 히트박스 포함)
+	const FHitResult* HR = Spec.GetContext().GetHitResult();
+	if (!HR || HR->GetActor() != this)
 	{
 		return false;
 	}
 
-	return (HR->BoneName == HeadBoneName);
+	UMosesHitZoneSubsystem* HitZones = GetWorld() ? GetWorld()->GetSubsystem<UMosesHitZoneSubsystem>() : nullptr;
+	if (!HitZones)
+	{
+		return (HR->BoneName == HeadBoneName);
+	}
+
+	return HitZones->ClassifyHit(*HR, HeadBoneName) == EMosesHitZone::Head;
 }
 
 void AMosesZombieCharacter::HandleDeath_Server()
@@ -606,19 +990,9 @@ void AMosesZombieCharacter::HandleDeath_Server()
 
 	// 공격/충돌 봉인
 	bIsAttacking_Server = false;
+	StopAttackTimeline_Server();
 	SetAttackHitEnabled_Server(EMosesZombieAttackHand::Both, false);
 
-	if (AttackHitBox_L)
-	{
-		AttackHitBox_L->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		AttackHitBox_L->SetGenerateOverlapEvents(false);
-	}
-	if (AttackHitBox_R)
-	{
-		AttackHitBox_R->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		AttackHitBox_R->SetGenerateOverlapEvents(false);
-	}
-
 	if (UCapsuleComponent* Capsule = GetCapsuleComponent())
 	{
 		Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -646,7 +1020,12 @@ void AMosesZombieCharacter::HandleDeath_Server()
 		UE_LOG(LogMosesZombie, Warning, TEXT("[ZOMBIE][SV][DEATH] PlayDeathMontage Zombie=%s Montage=%s"),
 			*GetName(), *GetNameSafe(DeathMontage));
 
-		if (UAnimInstance* AnimInst = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr)
+		if (IsServerAnimationDisabled())
+		{
+			// [ADD] 서버 애님 OFF → 종료 델리게이트 없음, Montage 길이로 정리 예약
+			ScheduleDeathCleanup_Server(DeathMontage->GetPlayLength() + FMath::Max(0.05f, DestroyDelayAfterDeathMontageSeconds));
+		}
+		else if (UAnimInstance* AnimInst = GetMesh() ? GetMesh()->GetAnimInstance() : nullptr)
 		{
 			FOnMontageEnded EndDel;
 			EndDel.BindUObject(this, &AMosesZombieCharacter::OnDeathMontageEnded_Server);
@@ -663,14 +1042,15 @@ void AMosesZombieCharacter::HandleDeath_Server()
 			DestroyDelayAfterDeathMontageSeconds,
 			*GetName());
 
-		SetLifeSpan(DestroyDelayAfterDeathMontageSeconds);
+		ScheduleDeathCleanup_Server(FMath::Max(0.05f, DestroyDelayAfterDeathMontageSeconds));
 	}
 }
 
 
 void AMosesZombieCharacter::OnDeathMontageEnded_Server(UAnimMontage* Montage, bool bInterrupted)
 {
-	if (!HasAuthority())
+	// [MOD] 풀 반납/재사용으로 끊긴 죽음 몽타주는 무시
+	if (!HasAuthority() || !bIsDying_Server || bPooled)
 	{
 		return;
 	}
@@ -682,14 +1062,15 @@ void AMosesZombieCharacter::OnDeathMontageEnded_Server(UAnimMontage* Montage, bo
 		DestroyDelayAfterDeathMontageSeconds,
 		*GetName());
 
-	// ✅ 요청: “몽타주 끝난 시점부터 5초 뒤 Destroy”
-	SetLifeSpan(FMath::Max(0.05f, DestroyDelayAfterDeathMontageSeconds));
+	// ✅ 요청: “몽타주 끝난 시점부터 5초 뒤 Destroy” ([MOD] 스폰 스팟 소유면 풀 반납)
+	ScheduleDeathCleanup_Server(FMath::Max(0.05f, DestroyDelayAfterDeathMontageSeconds));
 }
 
 
 void AMosesZombieCharacter::Multicast_PlayAttackMontage_Implementation(UAnimMontage* MontageToPlay)
 {
-	if (!MontageToPlay)
+	// [MOD] 서버 애님 OFF면 서버 로컬 재생 생략 (틱 없는 몽타주 인스턴스가 쌓이지 않게)
+	if (!MontageToPlay || IsServerAnimationDisabled())
 	{
 		return;
 	}
@@ -707,13 +1088,14 @@ void AMosesZombieCharacter::ResetHitActorsThisWindow()
 
 bool AMosesZombieCharacter::HasHitActorThisWindow(AActor* Actor) const
 {
-	return (Actor != nullptr) && HitActorsThisWindow.Contains(Actor);
+	return (Actor != nullptr) && HitActorsThisWindow.Contains(TWeakObjectPtr<AActor>(Actor));
 }
 
 void AMosesZombieCharacter::MarkHitActorThisWindow(AActor* Actor)
 {
 	if (Actor)
 	{
-		HitActorsThisWindow.Add(Actor);
+		HitActorsThisWindow.AddUnique(Actor);
+		UE_LOG(LogMosesZombie, Verbose, TEXT("[ZOMBIE][HIT][SV] MeleeHit Victim=%s Zombie=%s"), *GetNameSafe(Actor), *GetName());
 	}
 }
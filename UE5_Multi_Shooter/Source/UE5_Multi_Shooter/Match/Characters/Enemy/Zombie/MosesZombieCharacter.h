@@ -38,35 +38,79 @@ public:
 
 	bool ServerTryStartAttack_FromAI(AActor* TargetActor);
 
+	// [ADD] Zombie Director 입력 (서버)
+	bool IsDying_Server() const { return bIsDying_Server; }
+	APawn* GetLastAttackerPawn_Server() const;
+
+	// [ADD] Pool (Server) - AMosesZombieSpawnSpot 소유 좀비 재사용
+	void ActivateFromPool_Server(const FTransform& SpawnTransform);
+	void DeactivateToPool_Server();
+	bool IsPooled() const { return bPooled; }
+
+	// [ADD] Attack Timeline (Server) - 베이크 타임라인이 윈도우를 구동 중이면 노티파이는 무시
+	bool IsAttackTimelineActive_Server() const { return bAttackTimelineActive_Server; }
+
 public:
 	void ServerStartAttack();
-	void ServerSetMeleeAttackWindow(EMosesZombieAttackHand Hand, bool bEnabled, bool bResetHitActorsOnBegin);
+	void ServerSetMeleeAttackWindow(EMosesZombieAttackHand Hand, bool bEnabled, bool bResetHitActorsOnBegin, float WindowDuration = 0.f);
 	void HandleDamageAppliedFromGAS_Server(const FGameplayEffectModCallbackData& Data, float AppliedDamage, float NewHealth);
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void OnConstruction(const FTransform& Transform) override;
 
 private:
 	void AttachAttackHitBoxesToHandSockets();
 	void InitializeAttributes_Server();
 
+	void RegisterHitTargets_Server();
+	void UnregisterHitTargets_Server();
+
+	// HitZone 등록은 모든 NetMode (클라 예측 분류용), 풀링과 무관하게 BeginPlay~EndPlay
+	void RegisterHitZones();
+	void UnregisterHitZones();
+
+	/** 사망 후 정리: 스폰 스팟 소유면 풀 반납, 아니면 Destroy */
+	void ScheduleDeathCleanup_Server(float DelaySeconds);
+	void HandleDeathCleanupExpired_Server();
+
 	UAnimMontage* PickAttackMontage_Server() const;
 
-	void SetAttackHitEnabled_Server(EMosesZombieAttackHand Hand, bool bEnabled);
+	// [ADD] Attack Timeline (Server) - 애님 평가 없이 베이크된 윈도우 이벤트 재생
+	bool IsServerAnimationDisabled() const;
+	void ApplyServerAnimationPolicy();
+	void StartAttackTimeline_Server(const FMosesZombieAttackTimeline& Timeline);
+	void AdvanceAttackTimeline_Server();
+	void StopAttackTimeline_Server();
+
+	void SetAttackHitEnabled_Server(EMosesZombieAttackHand Hand, bool bEnabled, float WindowDuration = 0.f);
+
+	// [ADD] Melee Sweep (Server) - 윈도우가 열린 동안만 손 경로를 따라 박스 스윕
+	struct FMeleeHandSweep
+	{
+		bool bEnabled = false;
+
+		/** 직전 스윕 끝 위치 (다음 스윕 시작점) */
+		FVector LastLocation = FVector::ZeroVector;
+
+		/** [MOD] 애님 OFF Reach 보간용 윈도우 시작 시각/길이 */
+		double WindowStartTime = 0.0;
+		float WindowDuration = 0.f;
+	};
+
+	FMeleeHandSweep& GetMeleeHandSweep(EMosesZombieAttackHand Side) { return Side == EMosesZombieAttackHand::Left ? MeleeHand_L : MeleeHand_R; }
+	const FMeleeHandSweep& GetMeleeHandSweep(EMosesZombieAttackHand Side) const { return Side == EMosesZombieAttackHand::Left ? MeleeHand_L : MeleeHand_R; }
+
+	void SetOneHandSweepEnabled_Server(EMosesZombieAttackHand Side, bool bEnabled, float WindowDuration);
+	void TickMeleeSweep_Server();
+	bool GetHandSweepPose_Server(EMosesZombieAttackHand Side, FVector& OutLocation, FQuat& OutRotation, FVector& OutHalfExtent) const;
+	void SweepHand_Server(EMosesZombieAttackHand Side, TArray<FHitResult>& OutHits);
+	void TryApplyMeleeHit_Server(AActor* OtherActor);
 
 	UAbilitySystemComponent* FindASCFromActor_Server(AActor* TargetActor) const;
 	bool ApplySetByCallerDamageGE_Server(UAbilitySystemComponent* TargetASC, float DamageAmount) const;
 
-	UFUNCTION()
-	void OnAttackHitOverlapBegin(
-		UPrimitiveComponent* OverlappedComp,
-		AActor* OtherActor,
-		UPrimitiveComponent* OtherComp,
-		int32 OtherBodyIndex,
-		bool bFromSweep,
-		const FHitResult& SweepResult);
-
 	UFUNCTION()
 	void OnAttackMontageEnded_Server(UAnimMontage* Montage, bool bInterrupted);
 
@@ -75,7 +119,7 @@ private:
 
 	// 킬러/헤드샷 해석 (EffectContext 기반)
 	AMosesPlayerState* ResolveKillerPlayerState_FromEffectContext_Server(const FGameplayEffectContextHandle& Context) const;
-	bool ResolveHeadshot_FromEffectContext_Server(const FGameplayEffectContextHandle& Context) const;
+	bool ResolveHeadshot_FromEffectSpec_Server(const FGameplayEffectSpec& Spec) const;
 
 	void HandleDeath_Server();
 
@@ -107,17 +151,24 @@ private:
 	TObjectPtr<UMosesZombieTypeData> ZombieTypeData = nullptr;
 
 	// HitBoxes
+	// - [MOD] 충돌 바디 없음 (NoCollision). 손 소켓의 위치/크기만 제공 → 스윕 형상
 	UPROPERTY(VisibleAnywhere, Category = "Moses|Zombie|HitBox")
 	TObjectPtr<UBoxComponent> AttackHitBox_L = nullptr;
 
 	UPROPERTY(VisibleAnywhere, Category = "Moses|Zombie|HitBox")
 	TObjectPtr<UBoxComponent> AttackHitBox_R = nullptr;
 
-	bool bAttackHitEnabled_L = false;
-	bool bAttackHitEnabled_R = false;
+	FMeleeHandSweep MeleeHand_L;
+	FMeleeHandSweep MeleeHand_R;
 
-	UPROPERTY()
-	TSet<TObjectPtr<AActor>> HitActorsThisWindow;
+	/** 윈도우가 열린 동안만 도는 스윕 타이머 */
+	FTimerHandle MeleeSweepTimerHandle;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|HitBox", meta = (ClampMin = "0.01"))
+	float MeleeSweepInterval = 1.f / 30.f;
+
+	// 한 윈도우 히트 대상은 보통 1~2명 → 인라인 선형 검색
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>> HitActorsThisWindow;
 
 	// Headshot
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie")
@@ -133,9 +184,23 @@ private:
 	double NextAttackServerTime = 0.0;
 	bool bIsAttacking_Server = false;
 
+	// Attack Timeline (Server)
+	FMosesZombieAttackTimeline ActiveAttackTimeline;
+	int32 AttackTimelineNextEvent = 0;
+	double AttackTimelineStartTime = 0.0;
+	FTimerHandle AttackTimelineHandle;
+	bool bAttackTimelineActive_Server = false;
+
 	// Death Guard
 	bool bIsDying_Server = false;
 
+	// Pool
+	bool bPooled = false;
+	FTimerHandle DeathCleanupTimerHandle;
+
+	/** BeginPlay 시점 캡슐 충돌 (사망 시 끈 것을 재사용 때 복구) */
+	ECollisionEnabled::Type CapsuleCollisionDefault = ECollisionEnabled::QueryAndPhysics;
+
 	// Destroy delay after death montage end
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|Death")
 	float DestroyDelayAfterDeathMontageSeconds = 5.0f; // ✅ 요청: 몽타주 끝나고 5초 뒤 삭제
@@ -0,0 +1,116 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Tests/MosesZombieMeleeSweepTests.cpp
+// ----------------------------------------------------------------------------
+// 좀비 근접 스윕 (애님 OFF 데디 서버 경로)
+// - 포즈 고정 → 손 소켓이 움직이지 않아 소켓 직전→현재 스윕은 0 길이
+// - 루트 기준 Reach를 윈도우 경과 비율로 보간하면 손이 앞으로 뻗어 히트가 난다
+// - 실제 데디 프로세스가 아닌 빈 Game 월드에서 좀비와 같은 헬퍼/스텝(1/30초)으로 재현
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Types/MosesZombieAttackTypes.h"
+
+#include "Misc/AutomationTest.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/HitResult.h"
+#include "Engine/World.h"
+#include "CollisionQueryParams.h"
+#include "GameFramework/Actor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MosesZombieMeleeSweepTests_Private
+{
+	static constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+	/** 좀비 MeleeSweepInterval / 기본 공격 윈도우 길이 */
+	static constexpr float SweepInterval = 1.f / 30.f;
+	static constexpr float WindowDuration = 0.3f;
+
+	/** Pawn 오브젝트 캡슐 하나를 가진 표적 (플레이어 캡슐 크기) */
+	static AActor* SpawnPawnTarget(UWorld* World, const FVector& Location)
+	{
+		AActor* Target = World->SpawnActor<AActor>();
+		UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Target);
+		Capsule->SetCapsuleSize(34.f, 88.f);
+		Capsule->SetCollisionObjectType(ECC_Pawn);
+		Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		Capsule->SetCollisionResponseToAllChannels(ECR_Block);
+		Target->SetRootComponent(Capsule);
+		Capsule->RegisterComponent();
+		Target->SetActorLocation(Location);
+		return Target;
+	}
+
+	static bool ContainsActor(const TArray<FHitResult>& Hits, const AActor* Actor)
+	{
+		return Hits.ContainsByPredicate([Actor](const FHitResult& Hit) { return Hit.GetActor() == Actor; });
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMosesZombieMeleeReachSweepTest, "Moses.Zombie.MeleeSweep.ReachHitsWithAnimationOff", MosesZombieMeleeSweepTests_Private::TestFlags)
+
+bool FMosesZombieMeleeReachSweepTest::RunTest(const FString& Parameters)
+{
+	using namespace MosesZombieMeleeSweepTests_Private;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("MosesZombieMeleeSweepTest"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	// 좀비 루트: 원점, +X 정면. 표적은 오른손 Reach 끝 근처 (손 시작 위치에선 닿지 않음)
+	const FTransform ZombieRoot = FTransform::Identity;
+	const FMosesZombieHandReach Reach;
+	AActor* Target = SpawnPawnTarget(World, ZombieRoot.TransformPosition(Reach.End) + FVector(25.f, 0.f, 0.f));
+
+	// 새 바디를 씬 쿼리 구조에 반영
+	World->Tick(LEVELTICK_All, SweepInterval);
+
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(Moses_ZombieMeleeSweepTest), false);
+	const FQuat Rotation = ZombieRoot.GetRotation();
+
+	// Before: 고정 포즈 손 소켓 (직전 = 현재) → 0 길이 스윕
+	{
+		const FVector FrozenHand = FMosesZombieMeleeSweep::GetReachLocation(ZombieRoot, Reach, 0.f);
+
+		TArray<FHitResult> Hits;
+		for (float Elapsed = 0.f; Elapsed <= WindowDuration + KINDA_SMALL_NUMBER; Elapsed += SweepInterval)
+		{
+			FMosesZombieMeleeSweep::SweepBox(World, FrozenHand, FrozenHand, Rotation, Reach.HalfExtent, Params, Hits);
+		}
+
+		TestFalse(TEXT("Frozen hand socket never reaches the target"), ContainsActor(Hits, Target));
+	}
+
+	// After: 윈도우 열기(0 길이) → 1/30초 스텝 → 닫기(Alpha 1) — 좀비 SweepHand_Server와 같은 순서
+	{
+		TArray<FHitResult> Hits;
+		FVector LastLocation = FMosesZombieMeleeSweep::GetReachLocation(ZombieRoot, Reach, 0.f);
+		FMosesZombieMeleeSweep::SweepBox(World, LastLocation, LastLocation, Rotation, Reach.HalfExtent, Params, Hits);
+
+		TestFalse(TEXT("Window open sweep does not hit yet"), ContainsActor(Hits, Target));
+
+		int32 FirstHitStep = INDEX_NONE;
+		const int32 NumSteps = FMath::CeilToInt(WindowDuration / SweepInterval);
+		for (int32 Step = 1; Step <= NumSteps; ++Step)
+		{
+			const FVector End = FMosesZombieMeleeSweep::GetReachLocation(ZombieRoot, Reach, (Step * SweepInterval) / WindowDuration);
+			FMosesZombieMeleeSweep::SweepBox(World, LastLocation, End, Rotation, Reach.HalfExtent, Params, Hits);
+			LastLocation = End;
+
+			if (FirstHitStep == INDEX_NONE && ContainsActor(Hits, Target))
+			{
+				FirstHitStep = Step;
+			}
+		}
+
+		TestTrue(TEXT("Root-relative reach sweep lands a hit during the window"), FirstHitStep != INDEX_NONE);
+		AddInfo(FString::Printf(TEXT("[ZOMBIE][SWEEP] First hit at step %d/%d"), FirstHitStep, NumSteps));
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,38 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Types/MosesZombieAttackTypes.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Types/MosesZombieAttackTypes.h"
+
+#include "Engine/World.h"
+#include "Engine/HitResult.h"
+#include "CollisionQueryParams.h"
+
+FVector FMosesZombieMeleeSweep::GetReachLocation(const FTransform& RootTransform, const FMosesZombieHandReach& Reach, float Alpha)
+{
+	return RootTransform.TransformPosition(FMath::Lerp(Reach.Start, Reach.End, FMath::Clamp(Alpha, 0.f, 1.f)));
+}
+
+int32 FMosesZombieMeleeSweep::SweepBox(
+	const UWorld* World,
+	const FVector& Start,
+	const FVector& End,
+	const FQuat& Rotation,
+	const FVector& HalfExtent,
+	const FCollisionQueryParams& Params,
+	TArray<FHitResult>& OutHits)
+{
+	if (!World)
+	{
+		return 0;
+	}
+
+	const FCollisionObjectQueryParams ObjectParams(ECC_Pawn);
+
+	TArray<FHitResult> Hits;
+	World->SweepMultiByObjectType(Hits, Start, End, Rotation, ObjectParams, FCollisionShape::MakeBox(HalfExtent), Params);
+
+	const int32 NumHits = Hits.Num();
+	OutHits.Append(MoveTemp(Hits));
+	return NumHits;
+}
@@ -5,6 +5,11 @@
 #include "CoreMinimal.h"
 #include "MosesZombieAttackTypes.generated.h"
 
+class UAnimMontage;
+class UWorld;
+struct FHitResult;
+struct FCollisionQueryParams;
+
 // [MOD] enum은 "단 한 곳"에만 UENUM으로 선언한다.
 UENUM(BlueprintType)
 enum class EMosesZombieAttackHand : uint8
@@ -13,3 +18,77 @@ enum class EMosesZombieAttackHand : uint8
 	Right	UMETA(DisplayName = "Right"),
 	Both	UMETA(DisplayName = "Both"),
 };
+
+// ----------------------------------------------------------------------------
+// [ADD] Baked Attack Timeline (Server)
+// - Montage의 AttackWindow 노티파이 구간을 시간 이벤트로 미리 펼친 것
+// - 서버는 애님 평가 없이 이 타임스탬프로 히트박스를 열고 닫는다
+// ----------------------------------------------------------------------------
+
+struct FMosesZombieAttackWindowEvent
+{
+	/** 공격 시작 기준 경과 시간 (초, RateScale 반영) */
+	float Time = 0.f;
+
+	EMosesZombieAttackHand Hand = EMosesZombieAttackHand::Right;
+
+	/** true = 윈도우 열기, false = 닫기 */
+	bool bEnabled = false;
+
+	bool bResetHitActorsOnBegin = false;
+
+	/** 열기 이벤트: 같은 노티파이의 닫기까지 길이 (애님 OFF Reach 보간용) */
+	float WindowDuration = 0.f;
+};
+
+struct FMosesZombieAttackTimeline
+{
+	UAnimMontage* Montage = nullptr;
+
+	/** 공격 종료 시점 (= Montage 길이) */
+	float PlayLength = 0.f;
+
+	/** Time 오름차순 (같은 시각이면 닫기 먼저) */
+	TArray<FMosesZombieAttackWindowEvent, TInlineAllocator<4>> Events;
+};
+
+// ----------------------------------------------------------------------------
+// [ADD] Melee Reach (Server, 애님 OFF)
+// - 포즈가 고정되면 손 소켓이 움직이지 않음 → 액터 루트 기준 손 경로로 대체
+// - 윈도우 경과 비율(0~1)로 Start → End 보간, 박스 스윕 끝점으로 사용
+// ----------------------------------------------------------------------------
+
+USTRUCT(BlueprintType)
+struct FMosesZombieHandReach
+{
+	GENERATED_BODY()
+
+	/** 윈도우 시작 시 손 위치 (액터 루트 기준) */
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|Reach")
+	FVector Start = FVector(10.f, 50.f, 40.f);
+
+	/** 윈도우 끝 시 손 위치 (액터 루트 기준) */
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|Reach")
+	FVector End = FVector(110.f, 15.f, 20.f);
+
+	/** 스윕 박스 반 크기 */
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Zombie|Reach")
+	FVector HalfExtent = FVector(15.f, 15.f, 15.f);
+};
+
+/** 손 스윕 공용 (좀비 / 자동화 테스트) */
+struct UE5_MULTI_SHOOTER_API FMosesZombieMeleeSweep
+{
+	/** 루트 기준 Reach를 Alpha(0~1)로 보간한 월드 위치 */
+	static FVector GetReachLocation(const FTransform& RootTransform, const FMosesZombieHandReach& Reach, float Alpha);
+
+	/** Pawn 오브젝트 대상 박스 스윕, 결과를 OutHits에 추가. @return 이번 스윕 히트 수 */
+	static int32 SweepBox(
+		const UWorld* World,
+		const FVector& Start,
+		const FVector& End,
+		const FQuat& Rotation,
+		const FVector& HalfExtent,
+		const FCollisionQueryParams& Params,
+		TArray<FHitResult>& OutHits);
+};
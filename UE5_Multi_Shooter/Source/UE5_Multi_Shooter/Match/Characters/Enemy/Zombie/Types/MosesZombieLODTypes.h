@@ -0,0 +1,16 @@
+﻿// MosesZombieLODTypes.h (NEW)
+// - Zombie AI LOD tier (UMosesZombieDirectorSubsystem가 결정, AIController가 적용)
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MosesZombieLODTypes.generated.h"
+
+// 숫자가 클수록 멀다 (Active=풀 레이트 ~ Dormant=BT 정지)
+UENUM(BlueprintType)
+enum class EMosesZombieLODTier : uint8
+{
+	Active	UMETA(DisplayName = "Active"),
+	Near	UMETA(DisplayName = "Near"),
+	Far		UMETA(DisplayName = "Far"),
+	Dormant	UMETA(DisplayName = "Dormant"),
+};
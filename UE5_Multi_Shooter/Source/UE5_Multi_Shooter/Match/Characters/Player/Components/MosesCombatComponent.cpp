@@ -4,9 +4,9 @@
 //
 // ✅ 포함사항
 // - 네가 올린 .cpp 내용 "전부" 포함
-// - Heartbeat/AutoFire 쪽 컴파일 깨지는 멤버/이름 불일치 전부 정리
+// - [MOD] 발사 = Fire Command Stream (Unreliable, 최근 N발 중복 전송 + ShotSeq 중복 제거)
 // - Owner=PlayerState 패턴에 맞게 Pawn resolve 전부 MosesCombat_Private::GetOwnerPawn(this)로 통일
-// - 서버 AutoFireTick에서 Heartbeat timeout 시 강제 Stop (연사 고착 방지)
+// - 연사 타이머는 로컬에만 존재 → 서버 연사 고착 없음 (Heartbeat 제거)
 // ============================================================================
 
 #include "UE5_Multi_Shooter/Match/Characters/Player/Components/MosesCombatComponent.h"
@@ -19,12 +19,22 @@
 #include "UE5_Multi_Shooter/Match/GAS/MosesGameplayTags.h"
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/MosesZombieCharacter.h"
 #include "UE5_Multi_Shooter/MosesPlayerController.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesLagCompensationSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesHitZoneSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesHitscanBatchSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesCombatAssetSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesDamageAccumulatorSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectilePoolSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectileManagerSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesSpreadModel.h"
+#include "UE5_Multi_Shooter/MosesStats.h"
 
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/Controller.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/GameStateBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
 #include "AbilitySystemInterface.h"
@@ -34,6 +44,7 @@
 #include "GameplayTagContainer.h"
 #include "DrawDebugHelpers.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Particles/ParticleSystem.h"
 #include "InputCoreTypes.h" // EKeys
 
 namespace MosesCombat_Private
@@ -64,6 +75,12 @@ namespace MosesCombat_Private
 	{
 		return FMath::Clamp(SlotIndex, 1, 4);
 	}
+
+	// 스프레드 생명 시드 (전역 RNG 상태와 무관)
+	static uint32 MakeLifeSeed()
+	{
+		return GetTypeHash(FGuid::NewGuid());
+	}
 }
 
 // ============================================================================
@@ -72,7 +89,9 @@ namespace MosesCombat_Private
 
 UMosesCombatComponent::UMosesCombatComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	// 트리거 Hold 동안만 Tick (FireScheduler Advance)
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	SetIsReplicatedByDefault(true);
 }
 
@@ -80,19 +99,26 @@ void UMosesCombatComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// ✅ Slot Runtime Cache 초기 구성 (OnRep 이전에도 기본 interval 보장)
+	for (int32 SlotIndex = 1; SlotIndex <= 4; ++SlotIndex)
+	{
+		RebuildSlotRuntime(SlotIndex, GetSlotWeaponIdInternal(SlotIndex));
+	}
+
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
-		// ✅ 안전장치: 서버에서 시작 시 연사 상태/타이머는 무조건 초기화
-		bWantsToFire = false;
+		// ✅ 안전장치: 서버에서 시작 시 Fire Stream 상태/타이머는 무조건 초기화
+		bServerHasShotSeq = false;
+		ServerLastShotTimeSec = -1.0;
+		SpreadLifeSeed = MosesCombat_Private::MakeLifeSeed();
 
 		if (UWorld* World = GetWorld())
 		{
-			World->GetTimerManager().ClearTimer(AutoFireTimerHandle);
 			World->GetTimerManager().ClearTimer(ReloadTimerHandle);
 		}
 
 		UE_LOG(LogMosesCombat, Warning,
-			TEXT("[FIRE][SV] BeginPlay Reset AutoFire/Reload Timers PS=%s"),
+			TEXT("[FIRE][SV] BeginPlay Reset FireStream/Reload Timer PS=%s"),
 			*GetNameSafe(GetOwner()));
 
 		UE_LOG(LogMosesCombat, Warning,
@@ -105,21 +131,18 @@ void UMosesCombatComponent::BeginPlay()
 
 void UMosesCombatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// ✅ PIE 종료/Travel/월드 파괴 시 타이머 잔존 방지(클라 heartbeat 포함)
-	StopClientFireHeldHeartbeat();
+	// ✅ PIE 종료/Travel/월드 파괴 시 타이머 잔존 방지(로컬 연사 포함)
+	StopAutoFire_Local();
 
 	if (GetOwner() && GetOwner()->HasAuthority())
 	{
-		bWantsToFire = false;
-
 		if (UWorld* World = GetWorld())
 		{
-			World->GetTimerManager().ClearTimer(AutoFireTimerHandle);
 			World->GetTimerManager().ClearTimer(ReloadTimerHandle);
 		}
 
 		UE_LOG(LogMosesCombat, Warning,
-			TEXT("[FIRE][SV] EndPlay Clear AutoFire/Reload Timers Reason=%d PS=%s"),
+			TEXT("[FIRE][SV] EndPlay Clear Reload Timer Reason=%d PS=%s"),
 			(int32)EndPlayReason,
 			*GetNameSafe(GetOwner()));
 	}
@@ -131,35 +154,12 @@ void UMosesCombatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(UMosesCombatComponent, CurrentSlot);
-
-	DOREPLIFETIME(UMosesCombatComponent, Slot1WeaponId);
-	DOREPLIFETIME(UMosesCombatComponent, Slot2WeaponId);
-	DOREPLIFETIME(UMosesCombatComponent, Slot3WeaponId);
-	DOREPLIFETIME(UMosesCombatComponent, Slot4WeaponId);
-
-	DOREPLIFETIME(UMosesCombatComponent, Slot1MagAmmo);
-	DOREPLIFETIME(UMosesCombatComponent, Slot1ReserveAmmo);
-	DOREPLIFETIME(UMosesCombatComponent, Slot1ReserveMax);
-
-	DOREPLIFETIME(UMosesCombatComponent, Slot2MagAmmo);
-	DOREPLIFETIME(UMosesCombatComponent, Slot2ReserveAmmo);
-	DOREPLIFETIME(UMosesCombatComponent, Slot2ReserveMax);
-
-	DOREPLIFETIME(UMosesCombatComponent, Slot3MagAmmo);
-	DOREPLIFETIME(UMosesCombatComponent, Slot3ReserveAmmo);
-	DOREPLIFETIME(UMosesCombatComponent, Slot3ReserveMax);
-
-	DOREPLIFETIME(UMosesCombatComponent, Slot4MagAmmo);
-	DOREPLIFETIME(UMosesCombatComponent, Slot4ReserveAmmo);
-	DOREPLIFETIME(UMosesCombatComponent, Slot4ReserveMax);
+	DOREPLIFETIME(UMosesCombatComponent, SlotState);
 
 	DOREPLIFETIME(UMosesCombatComponent, bIsDead);
 	DOREPLIFETIME(UMosesCombatComponent, bIsReloading);
 
-	DOREPLIFETIME(UMosesCombatComponent, SwapSerial);
-	DOREPLIFETIME(UMosesCombatComponent, LastSwapFromSlot);
-	DOREPLIFETIME(UMosesCombatComponent, LastSwapToSlot);
+	DOREPLIFETIME(UMosesCombatComponent, SpreadLifeSeed);
 }
 
 // ============================================================================
@@ -173,27 +173,27 @@ FGameplayTag UMosesCombatComponent::GetWeaponIdForSlot(int32 SlotIndex) const
 
 FGameplayTag UMosesCombatComponent::GetEquippedWeaponId() const
 {
-	return GetSlotWeaponIdInternal(CurrentSlot);
+	return GetSlotWeaponIdInternal(SlotState.CurrentSlot);
 }
 
 int32 UMosesCombatComponent::GetCurrentMagAmmo() const
 {
 	int32 Mag = 0, Cur = 0, Max = 0;
-	GetSlotAmmo_Internal(CurrentSlot, Mag, Cur, Max);
+	GetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Cur, Max);
 	return Mag;
 }
 
 int32 UMosesCombatComponent::GetCurrentReserveAmmo() const
 {
 	int32 Mag = 0, Cur = 0, Max = 0;
-	GetSlotAmmo_Internal(CurrentSlot, Mag, Cur, Max);
+	GetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Cur, Max);
 	return Cur;
 }
 
 int32 UMosesCombatComponent::GetCurrentReserveMax() const
 {
 	int32 Mag = 0, Cur = 0, Max = 0;
-	GetSlotAmmo_Internal(CurrentSlot, Mag, Cur, Max);
+	GetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Cur, Max);
 	return Max;
 }
 
@@ -212,25 +212,29 @@ void UMosesCombatComponent::ServerInitDefaultSlots_4(
 		return;
 	}
 
-	Slot1WeaponId = InSlot1;
-	Slot2WeaponId = InSlot2;
-	Slot3WeaponId = InSlot3;
-	Slot4WeaponId = InSlot4;
+	Server_SetSlotWeaponId_Internal(1, InSlot1);
+	Server_SetSlotWeaponId_Internal(2, InSlot2);
+	Server_SetSlotWeaponId_Internal(3, InSlot3);
+	Server_SetSlotWeaponId_Internal(4, InSlot4);
 
-	CurrentSlot = 1;
+	const bool bCurrentSlotChanged = (SlotState.CurrentSlot != 1);
+	SlotState.CurrentSlot = 1;
 
-	Server_EnsureAmmoInitializedForSlot(1, Slot1WeaponId);
-	Server_EnsureAmmoInitializedForSlot(2, Slot2WeaponId);
-	Server_EnsureAmmoInitializedForSlot(3, Slot3WeaponId);
-	Server_EnsureAmmoInitializedForSlot(4, Slot4WeaponId);
+	Server_EnsureAmmoInitializedForSlot(1, InSlot1);
+	Server_EnsureAmmoInitializedForSlot(2, InSlot2);
+	Server_EnsureAmmoInitializedForSlot(3, InSlot3);
+	Server_EnsureAmmoInitializedForSlot(4, InSlot4);
 
 	bInitialized_DefaultSlots = true;
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][SV] InitDefaultSlots_4 S1=%s S2=%s S3=%s S4=%s"),
-		*Slot1WeaponId.ToString(), *Slot2WeaponId.ToString(), *Slot3WeaponId.ToString(), *Slot4WeaponId.ToString());
+		*InSlot1.ToString(), *InSlot2.ToString(), *InSlot3.ToString(), *InSlot4.ToString());
 
-	BroadcastEquippedChanged(TEXT("ServerInitDefaultSlots_4"));
-	BroadcastAmmoChanged(TEXT("ServerInitDefaultSlots_4"));
+	// 슬롯/탄약 통지는 Set 경로(HandleSlotStateChanged)에서 이미 방송 → CurrentSlot 변경분만
+	if (bCurrentSlotChanged)
+	{
+		HandleSlotStateChanged(0, 0, false, true, TEXT("ServerInitDefaultSlots_4"));
+	}
 }
 
 // ============================================================================
@@ -244,6 +248,7 @@ void UMosesCombatComponent::ServerGrantDefaultRifleAmmo_30_90()
 		return;
 	}
 
+	const FGameplayTag Slot1WeaponId = GetSlotWeaponIdInternal(1);
 	if (!Slot1WeaponId.IsValid())
 	{
 		UE_LOG(LogMosesWeapon, Warning, TEXT("[AMMO][SV] DefaultRifleAmmo FAIL (Slot1WeaponId invalid)"));
@@ -252,11 +257,6 @@ void UMosesCombatComponent::ServerGrantDefaultRifleAmmo_30_90()
 
 	SetSlotAmmo_Internal(1, 30, 90, 90);
 
-	if (CurrentSlot == 1)
-	{
-		OnRep_CurrentSlot();
-	}
-
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[AMMO][SV] DefaultRifleAmmo Granted Slot=1 Mag=30 Reserve=90/90 Weapon=%s"),
 		*Slot1WeaponId.ToString());
 }
@@ -326,13 +326,6 @@ void UMosesCombatComponent::ServerAddAmmoByType(EMosesAmmoType AmmoType, int32 R
 			*GetNameSafe(GetOwner()));
 
 		bAppliedAny = true;
-
-		if (CurrentSlot == Slot)
-		{
-			BroadcastAmmoChanged(TEXT("ServerAddAmmoByType(CurrentSlot)"));
-		}
-
-		BroadcastSlotsStateChanged(Slot, TEXT("ServerAddAmmoByType"));
 	}
 
 	if (!bAppliedAny)
@@ -387,13 +380,6 @@ void UMosesCombatComponent::ServerGrantWeaponToSlot(int32 SlotIndex, const FGame
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][SV] GrantWeaponToSlot OK Slot=%d Weapon=%s (InitAmmo=%d) PS=%s"),
 		ClampedSlot, *WeaponId.ToString(), bInitializeAmmoIfEmpty ? 1 : 0, *GetNameSafe(GetOwner()));
-
-	if (CurrentSlot == ClampedSlot)
-	{
-		BroadcastAmmoChanged(TEXT("ServerGrantWeaponToSlot(CurrentSlot)"));
-	}
-
-	BroadcastSlotsStateChanged(ClampedSlot, TEXT("ServerGrantWeaponToSlot"));
 }
 
 // ============================================================================
@@ -407,6 +393,9 @@ void UMosesCombatComponent::RequestEquipSlot(int32 SlotIndex)
 		return;
 	}
 
+	// ✅ 스왑 시작 시 연사 끊기 (로컬 Stream)
+	StopAutoFire_Local();
+
 	ServerEquipSlot(SlotIndex);
 }
 
@@ -417,10 +406,6 @@ void UMosesCombatComponent::ServerEquipSlot_Implementation(int32 SlotIndex)
 		return;
 	}
 
-	// ✅ 스왑 시작 시 연사 끊기
-	bWantsToFire = false;
-	StopAutoFire_Server();
-
 	if (bIsDead)
 	{
 		UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][SV] Equip Reject Dead Slot=%d"), SlotIndex);
@@ -448,7 +433,7 @@ void UMosesCombatComponent::ServerEquipSlot_Implementation(int32 SlotIndex)
 		return;
 	}
 
-	const int32 OldSlot = CurrentSlot;
+	const int32 OldSlot = SlotState.CurrentSlot;
 	const FGameplayTag OldWeaponId = GetEquippedWeaponId();
 
 	if (OldSlot == NewSlot)
@@ -456,22 +441,18 @@ void UMosesCombatComponent::ServerEquipSlot_Implementation(int32 SlotIndex)
 		return;
 	}
 
-	LastSwapFromSlot = OldSlot;
-	LastSwapToSlot = NewSlot;
-	SwapSerial++;
+	SlotState.LastSwapFromSlot = static_cast<uint8>(OldSlot);
+	SlotState.LastSwapToSlot = static_cast<uint8>(NewSlot);
+	SlotState.SwapSerial++;
 
-	CurrentSlot = NewSlot;
+	SlotState.CurrentSlot = static_cast<uint8>(NewSlot);
 
-	Server_EnsureAmmoInitializedForSlot(CurrentSlot, NewWeaponId);
+	Server_EnsureAmmoInitializedForSlot(NewSlot, NewWeaponId);
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][SV] Swap OK Slot %d -> %d Weapon %s -> %s Serial=%d"),
-		OldSlot, CurrentSlot, *OldWeaponId.ToString(), *NewWeaponId.ToString(), SwapSerial);
-
-	OnRep_SwapSerial();
-	OnRep_CurrentSlot();
+		OldSlot, NewSlot, *OldWeaponId.ToString(), *NewWeaponId.ToString(), SlotState.SwapSerial);
 
-	BroadcastEquippedChanged(TEXT("ServerEquipSlot"));
-	BroadcastAmmoChanged(TEXT("ServerEquipSlot"));
+	HandleSlotStateChanged(0, 0, true, true, TEXT("ServerEquipSlot"));
 }
 
 // ============================================================================
@@ -480,66 +461,35 @@ void UMosesCombatComponent::ServerEquipSlot_Implementation(int32 SlotIndex)
 
 void UMosesCombatComponent::RequestFire()
 {
-	if (!GetOwner())
-	{
-		return;
-	}
-
-	if (GetOwner()->HasAuthority())
+	if (!GetOwner() || !IsLocallyControlledOwner())
 	{
-		ServerFire_Implementation();
 		return;
 	}
 
-	ServerFire();
-}
-
-void UMosesCombatComponent::ServerFire_Implementation()
-{
-	if (!GetOwner() || !GetOwner()->HasAuthority())
+	// 연사 Stream이 이미 샷을 만들고 있으면 중복 생성하지 않는다
+	if (LocalFireScheduler.IsTriggerHeld())
 	{
 		return;
 	}
 
-	EMosesFireGuardFailReason Reason = EMosesFireGuardFailReason::None;
-	FString Debug;
-
-	if (!Server_CanFire(Reason, Debug))
+	bool bShouldStop = false;
+	if (!CanEmitShot_Local(0, bShouldStop))
 	{
 		return;
 	}
 
-	FGameplayTag ApprovedWeaponId;
-	const UMosesWeaponData* WeaponData = Server_ResolveEquippedWeaponData(ApprovedWeaponId);
-	if (!WeaponData)
-	{
-		return;
-	}
+	// 단발도 같은 스케줄러로 쿨다운 판정 (연타로 연사 속도 초과 불가)
+	LocalFireScheduler.Configure(GetEquippedSlotRuntime().FireIntervalSec);
 
-	if (!Server_IsFireCooldownReady(WeaponData))
+	const double NowLocal = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	if (!LocalFireScheduler.TryConsumeSingleShot(NowLocal))
 	{
 		return;
 	}
 
-	// ✅ 여기서부터가 "승인 후" 구간
-	Server_UpdateFireCooldownStamp();
-
-	// ✅ [여기에 삽입]
-	const bool bAmmoCostApplied = Server_ApplyAmmoCostToSelf_GAS(1.0f, WeaponData);
-	if (!bAmmoCostApplied)
-	{
-		Server_ConsumeAmmo_OnApprovedFire(WeaponData);
-	}
-
-	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][SV] Fire Weapon=%s Slot=%d Mag=%d Reserve=%d"),
-		*ApprovedWeaponId.ToString(), CurrentSlot, GetCurrentMagAmmo(), GetCurrentReserveAmmo());
-
-	Server_PerformFireAndApplyDamage(WeaponData);
-
-	// ✅ [MOD] 기존 ApprovedWeaponId -> WeaponData 로 변경
-	Server_PropagateFireCosmetics(WeaponData);
-
-	BroadcastSlotsStateChanged(CurrentSlot, TEXT("ServerFire"));
+	LatchShotTimeOffset_Local();
+	EmitShot_Local(NowLocal);
+	SendRecentShots_Local();
 }
 
 // ============================================================================
@@ -553,6 +503,8 @@ void UMosesCombatComponent::RequestReload()
 		return;
 	}
 
+	StopAutoFire_Local();
+
 	if (GetOwner()->HasAuthority())
 	{
 		ServerReload_Implementation();
@@ -572,7 +524,7 @@ void UMosesCombatComponent::ServerReload_Implementation()
 	if (bIsDead || bIsReloading)
 	{
 		UE_LOG(LogMosesWeapon, Warning, TEXT("[RELOAD][SV] REJECT Dead=%d Reloading=%d Slot=%d"),
-			bIsDead ? 1 : 0, bIsReloading ? 1 : 0, CurrentSlot);
+			bIsDead ? 1 : 0, bIsReloading ? 1 : 0, SlotState.CurrentSlot);
 		return;
 	}
 
@@ -581,17 +533,17 @@ void UMosesCombatComponent::ServerReload_Implementation()
 	if (!WeaponData)
 	{
 		UE_LOG(LogMosesWeapon, Warning, TEXT("[RELOAD][SV] REJECT NoWeaponData Slot=%d Weapon=%s"),
-			CurrentSlot, *WeaponId.ToString());
+			SlotState.CurrentSlot, *WeaponId.ToString());
 		return;
 	}
 
 	int32 Mag = 0;
 	int32 Reserve = 0;
-	GetSlotAmmo_Internal(CurrentSlot, Mag, Reserve);
+	GetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Reserve);
 
 	UE_LOG(LogMosesWeapon, Warning,
 		TEXT("[RELOAD][SV] TRY Slot=%d Weapon=%s Mag=%d Reserve=%d MagSize=%d"),
-		CurrentSlot,
+		SlotState.CurrentSlot,
 		*WeaponId.ToString(),
 		Mag,
 		Reserve,
@@ -621,15 +573,11 @@ void UMosesCombatComponent::Server_StartReload(const UMosesWeaponData* WeaponDat
 		return;
 	}
 
-	// ✅ 사망/리로드 시작 시 연사 끊기
-	bWantsToFire = false;
-	StopAutoFire_Server();
-
 	bIsReloading = true;
 	OnRep_IsReloading();
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][SV] ReloadStart Slot=%d Weapon=%s Sec=%.2f"),
-		CurrentSlot, *GetEquippedWeaponId().ToString(), WeaponData->ReloadSeconds);
+		SlotState.CurrentSlot, *GetEquippedWeaponId().ToString(), WeaponData->ReloadSeconds);
 
 	World->GetTimerManager().SetTimer(
 		ReloadTimerHandle,
@@ -657,7 +605,7 @@ void UMosesCombatComponent::Server_FinishReload()
 
 	int32 Mag = 0;
 	int32 Reserve = 0;
-	GetSlotAmmo_Internal(CurrentSlot, Mag, Reserve);
+	GetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Reserve);
 
 	const int32 Need = FMath::Max(WeaponData->MagSize - Mag, 0);
 	const int32 Give = FMath::Min(Need, Reserve);
@@ -665,13 +613,13 @@ void UMosesCombatComponent::Server_FinishReload()
 	Mag += Give;
 	Reserve -= Give;
 
-	SetSlotAmmo_Internal(CurrentSlot, Mag, Reserve);
+	SetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Reserve);
 
 	bIsReloading = false;
 	OnRep_IsReloading();
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][SV] ReloadFinish Slot=%d Weapon=%s Mag=%d Reserve=%d"),
-		CurrentSlot, *WeaponId.ToString(), Mag, Reserve);
+		SlotState.CurrentSlot, *WeaponId.ToString(), Mag, Reserve);
 }
 
 // ============================================================================
@@ -747,6 +695,13 @@ const UMosesWeaponData* UMosesCombatComponent::Server_ResolveEquippedWeaponData(
 		return nullptr;
 	}
 
+	// ✅ Slot Runtime Cache 우선 (WeaponId 일치 시 Registry 조회 없음)
+	const FMosesWeaponSlotRuntime& Runtime = GetEquippedSlotRuntime();
+	if (Runtime.WeaponData && Runtime.WeaponId == OutWeaponId)
+	{
+		return Runtime.WeaponData;
+	}
+
 	const UWorld* World = GetWorld();
 	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
 	if (!GI)
@@ -771,14 +726,12 @@ void UMosesCombatComponent::Server_ConsumeAmmo_OnApprovedFire(const UMosesWeapon
 {
 	int32 Mag = 0;
 	int32 Reserve = 0;
-	GetSlotAmmo_Internal(CurrentSlot, Mag, Reserve);
+	GetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Reserve);
 
 	const int32 OldMag = Mag;
 
 	Mag = FMath::Max(Mag - 1, 0);
-	SetSlotAmmo_Internal(CurrentSlot, Mag, Reserve);
-
-	BroadcastAmmoChanged(TEXT("Server_ConsumeAmmo_OnApprovedFire"));
+	SetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Reserve);
 
 	if (bAutoReloadOnEmpty
 		&& !bIsDead
@@ -789,7 +742,7 @@ void UMosesCombatComponent::Server_ConsumeAmmo_OnApprovedFire(const UMosesWeapon
 	{
 		UE_LOG(LogMosesWeapon, Warning,
 			TEXT("[RELOAD][SV][AUTO] Triggered Slot=%d OldMag=%d NewMag=%d Reserve=%d PS=%s"),
-			CurrentSlot, OldMag, Mag, Reserve, *GetNameSafe(GetOwner()));
+			SlotState.CurrentSlot, OldMag, Mag, Reserve, *GetNameSafe(GetOwner()));
 
 		ServerReload_Implementation();
 	}
@@ -809,20 +762,6 @@ float UMosesCombatComponent::Server_GetFireIntervalSec_FromWeaponData(const UMos
 	return Interval;
 }
 
-bool UMosesCombatComponent::Server_IsFireCooldownReady(const UMosesWeaponData* WeaponData) const
-{
-	if (!GetWorld())
-	{
-		return false;
-	}
-
-	const int32 SlotIndex = FMath::Clamp(CurrentSlot, 1, 4) - 1;
-	const float Now = GetWorld()->GetTimeSeconds();
-	const float Interval = Server_GetFireIntervalSec_FromWeaponData(WeaponData);
-
-	return (Now - SlotLastFireTimeSec[SlotIndex]) >= Interval;
-}
-
 void UMosesCombatComponent::Server_UpdateFireCooldownStamp()
 {
 	if (!GetWorld())
@@ -830,7 +769,7 @@ void UMosesCombatComponent::Server_UpdateFireCooldownStamp()
 		return;
 	}
 
-	const int32 SlotIndex = FMath::Clamp(CurrentSlot, 1, 4) - 1;
+	const int32 SlotIndex = FMath::Clamp<int32>(SlotState.CurrentSlot, 1, 4) - 1;
 	SlotLastFireTimeSec[SlotIndex] = GetWorld()->GetTimeSeconds();
 }
 
@@ -838,19 +777,17 @@ void UMosesCombatComponent::Server_UpdateFireCooldownStamp()
 // Spread / Fire Core
 // ============================================================================
 
-float UMosesCombatComponent::Server_CalcSpreadFactor01(const UMosesWeaponData* WeaponData, const APawn* OwnerPawn) const
+float UMosesCombatComponent::CalcSpreadFactor01(const APawn* Pawn) const
 {
-	if (!WeaponData || !OwnerPawn)
+	if (!Pawn)
 	{
 		return 0.0f;
 	}
 
-	const float Speed2D = OwnerPawn->GetVelocity().Size2D();
-	const float Ref = FMath::Max(1.0f, WeaponData->SpreadSpeedRef);
-	return FMath::Clamp(Speed2D / Ref, 0.0f, 1.0f);
+	return FMosesSpreadModel::CalcSpreadFactor01(Pawn->GetVelocity().Size2D(), GetEquippedSlotRuntime().SpreadSpeedRef);
 }
 
-FVector UMosesCombatComponent::Server_ApplySpreadToDirection(const FVector& AimDir, const UMosesWeaponData* WeaponData, float SpreadFactor01, float& OutHalfAngleDeg) const
+FVector UMosesCombatComponent::CalcShotDirection(const FVector& AimDir, const UMosesWeaponData* WeaponData, float SpreadFactor01, uint16 ShotSeq, float& OutHalfAngleDeg) const
 {
 	if (!WeaponData)
 	{
@@ -858,13 +795,31 @@ FVector UMosesCombatComponent::Server_ApplySpreadToDirection(const FVector& AimD
 		return AimDir.GetSafeNormal();
 	}
 
-	OutHalfAngleDeg = FMath::Lerp(WeaponData->SpreadDegrees_Min, WeaponData->SpreadDegrees_Max, SpreadFactor01);
-	const float HalfAngleRad = FMath::DegreesToRadians(FMath::Max(0.0f, OutHalfAngleDeg));
+	OutHalfAngleDeg = FMosesSpreadModel::CalcHalfAngleDeg(WeaponData->SpreadDegrees_Min, WeaponData->SpreadDegrees_Max, SpreadFactor01);
+
+	const uint32 ShotSeed = FMosesSpreadModel::MakeShotSeed(SpreadLifeSeed, ShotSeq);
+	return FMosesSpreadModel::ApplyToDirection(AimDir, OutHalfAngleDeg, ShotSeed);
+}
+
+int32 UMosesCombatComponent::CalcPelletDirections(const FVector& CenterDir, const UMosesWeaponData* WeaponData, uint16 ShotSeq, TArrayView<FVector> OutDirs) const
+{
+	if (OutDirs.Num() <= 0)
+	{
+		return 0;
+	}
+
+	const int32 NumPellets = (WeaponData && WeaponData->IsPelletWeapon()) ? FMath::Min(WeaponData->PelletCount, OutDirs.Num()) : 1;
+	if (NumPellets <= 1)
+	{
+		OutDirs[0] = CenterDir.GetSafeNormal();
+		return 1;
+	}
 
-	return FMath::VRandCone(AimDir.GetSafeNormal(), HalfAngleRad);
+	const uint32 ShotSeed = FMosesSpreadModel::MakeShotSeed(SpreadLifeSeed, ShotSeq);
+	return FMosesSpreadModel::BuildPelletDirections(CenterDir, WeaponData->PelletSpreadDegrees, ShotSeed, OutDirs.Left(NumPellets));
 }
 
-void UMosesCombatComponent::Server_PerformFireAndApplyDamage(const UMosesWeaponData* WeaponData)
+void UMosesCombatComponent::Server_PerformFireAndApplyDamage(const UMosesWeaponData* WeaponData, const FRotator& AimRot, float SpreadFactor01, uint16 ShotSeq)
 {
 	APawn* OwnerPawn = MosesCombat_Private::GetOwnerPawn(this);
 	if (!OwnerPawn)
@@ -888,191 +843,343 @@ void UMosesCombatComponent::Server_PerformFireAndApplyDamage(const UMosesWeaponD
 	FRotator ViewRot;
 	Controller->GetPlayerViewPoint(ViewLoc, ViewRot);
 
-	const FVector AimDir = ViewRot.Vector();
-	const float SpreadFactor = Server_CalcSpreadFactor01(WeaponData, OwnerPawn);
+	// 조준/스프레드는 승인된 샷 명령 기준 (Server_ResolveShotAim / Server_ResolveShotSpreadFactor)
+	const FVector AimDir = AimRot.Vector();
 
+	// 시드 스프레드: 발사자 클라가 같은 ShotSeq로 같은 방향을 재현 (PredictShot_Local)
 	float HalfAngleDeg = 0.0f;
-	const FVector SpreadDir = Server_ApplySpreadToDirection(AimDir, WeaponData, SpreadFactor, HalfAngleDeg);
+	const FVector SpreadDir = CalcShotDirection(AimDir, WeaponData, SpreadFactor01, ShotSeq, HalfAngleDeg);
 
-	FVector MuzzleStart = OwnerPawn->GetPawnViewLocation();
-	bool bGotMuzzle = false;
+	// ---------------------------------------------------------------------
+	// Fire Origin: Pawn 캐시(Equip/Swap 시 재구성)에서 포인터 읽기만
+	// ---------------------------------------------------------------------
+	const APlayerCharacter* OwnerChar = Cast<APlayerCharacter>(OwnerPawn);
+	const FMosesFireOriginCache* FireOrigin = OwnerChar ? &OwnerChar->GetFireOrigin() : nullptr;
 
-	if (WeaponData)
+	FVector MuzzleStart = OwnerPawn->GetPawnViewLocation();
+	if (FireOrigin)
 	{
-		const FName MuzzleSocketName = WeaponData->MuzzleSocketName;
-
-		if (!MuzzleSocketName.IsNone())
-		{
-			TInlineComponentArray<USkeletalMeshComponent*> SkelComps;
-			OwnerPawn->GetComponents<USkeletalMeshComponent>(SkelComps);
-
-			for (USkeletalMeshComponent* Comp : SkelComps)
-			{
-				if (!Comp)
-				{
-					continue;
-				}
-
-				if (Comp->GetFName() == TEXT("WeaponMesh_Hand"))
-				{
-					if (Comp->DoesSocketExist(MuzzleSocketName))
-					{
-						MuzzleStart = Comp->GetSocketLocation(MuzzleSocketName);
-						bGotMuzzle = true;
-					}
-					break;
-				}
-			}
-		}
+		FireOrigin->GetMuzzleLocation(MuzzleStart);
 	}
 
 	// Projectile weapon
 	if (WeaponData && WeaponData->bIsProjectileWeapon)
 	{
-		Server_SpawnGrenadeProjectile(WeaponData, MuzzleStart, SpreadDir, Controller, OwnerPawn);
+		Server_SpawnGrenadeProjectile(WeaponData, MuzzleStart, SpreadDir, Controller, OwnerPawn, ShotSeq);
 		return;
 	}
 
-	const FVector CamStart = ViewLoc;
-	const FVector CamEnd = CamStart + (SpreadDir * HitscanDistance);
+	// ---------------------------------------------------------------------
+	// [ADD] Hitscan Request: 조준/시작점/Rewind 시각은 발사 시점에 확정
+	// ---------------------------------------------------------------------
+	FMosesHitscanRequest Request;
+	Request.Shooter = this;
+	Request.ShooterPawn = OwnerPawn;
+	Request.ShooterController = Controller;
+	Request.WeaponData = WeaponData;
+	Request.CamStart = ViewLoc;
+	Request.CamEnd = ViewLoc + (SpreadDir * HitscanDistance);
+	Request.MuzzleStart = MuzzleStart;
+	Request.SpreadDir = SpreadDir;
+	Request.TraceChannel = FireTraceChannel;
+	Request.ShotSeq = ShotSeq;
+	Request.bAckToShooter = true;
+
+	// Trace Params: Equip 시 1회 구성된 캐시 사용 (PlayerCharacter가 아니면 즉석 구성)
+	if (FireOrigin)
+	{
+		Request.CamParams = FireOrigin->CamParams;
+		Request.MuzzleParams = FireOrigin->MuzzleParams;
+	}
+	else
+	{
+		FMosesFireOriginCache::BuildTraceParams(OwnerPawn, nullptr, Request.CamParams, Request.MuzzleParams);
+	}
+
+	// Lag Compensation: 슈터 클라가 보던 시점(Now - RTT)으로 타겟 히트볼륨을 되감는다
+	UMosesLagCompensationSubsystem* LagComp = bEnableLagCompensation ? World->GetSubsystem<UMosesLagCompensationSubsystem>() : nullptr;
+	Request.bRewind = (LagComp != nullptr);
+	Request.RewindTimeSec = LagComp
+		? LagComp->EstimateClientViewTime_Server(OwnerPawn->GetPlayerState(), MaxLagCompensationSec, LagCompensationExtraSec)
+		: World->GetTimeSeconds();
 
-	FCollisionQueryParams CamParams(SCENE_QUERY_STAT(Moses_FireTrace_Cam), true);
-	CamParams.AddIgnoredActor(OwnerPawn);
+	// ---------------------------------------------------------------------
+	// [ADD] 펠릿 샷: 중심 방향(SpreadDir) 기준 N개 → 펠릿마다 Cam/Muzzle 요청 1쌍
+	// ---------------------------------------------------------------------
+	FVector PelletDirs[FMosesSpreadModel::MaxPellets];
+	const int32 NumPellets = CalcPelletDirections(SpreadDir, WeaponData, ShotSeq, PelletDirs);
+	if (NumPellets > 1)
+	{
+		Server_FirePellets(Request, MakeArrayView(PelletDirs, NumPellets), LagComp);
+		return;
+	}
 
-	if (USkeletalMeshComponent* MeshComp = OwnerPawn->FindComponentByClass<USkeletalMeshComponent>())
+	// ---------------------------------------------------------------------
+	// [ADD] Hitscan Batch: 프레임 고정 지점에서 일괄 Trace → Server_ResolveHitscanResult
+	// ---------------------------------------------------------------------
+	if (bUseHitscanBatch)
 	{
-		CamParams.AddIgnoredComponent(MeshComp);
+		UMosesHitscanBatchSubsystem* HitscanBatch = World->GetSubsystem<UMosesHitscanBatchSubsystem>();
+		if (HitscanBatch && HitscanBatch->Enqueue_Server(MoveTemp(Request)))
+		{
+			return;
+		}
 	}
 
-	FHitResult CamHit;
-	const bool bCamHit = World->LineTraceSingleByChannel(CamHit, CamStart, CamEnd, FireTraceChannel, CamParams);
-	const FVector CamImpact = (bCamHit ? (CamHit.Location.IsNearlyZero() ? CamHit.ImpactPoint : CamHit.Location) : CamEnd);
-	const FVector AimPoint = CamImpact;
+	// 동기 폴백: Cam/Muzzle Trace 2회가 끝나면 스코프 종료 시 즉시 복구
+	FMosesHitscanTraceResult Result;
+	{
+		FMosesScopedHitboxRewind ScopedRewind(LagComp, Request.RewindTimeSec, OwnerPawn, Request.CamStart, Request.CamEnd);
+		UMosesHitscanBatchSubsystem::ExecuteTracePair(World, Request, Result);
+	}
 
-	FVector MuzzleEnd = AimPoint;
+	Server_ResolveHitscanResult(Request, Result);
+}
 
-	const float DistMS = FVector::Dist(MuzzleStart, MuzzleEnd);
-	if (DistMS < 10.0f)
+void UMosesCombatComponent::Server_FirePellets(const FMosesHitscanRequest& BaseRequest, TConstArrayView<FVector> PelletDirs, UMosesLagCompensationSubsystem* LagComp)
+{
+	UWorld* World = GetWorld();
+	if (!World)
 	{
-		MuzzleEnd = MuzzleStart + (SpreadDir * 10.0f);
+		return;
 	}
 
-	FCollisionQueryParams MuzzleParams(SCENE_QUERY_STAT(Moses_FireTrace_Muzzle), true);
-	MuzzleParams.AddIgnoredActor(OwnerPawn);
+	const int32 NumPellets = PelletDirs.Num();
+
+	TArray<FMosesHitscanRequest, TInlineAllocator<8>> PelletRequests;
+	PelletRequests.Reserve(NumPellets);
+
+	for (int32 PelletIndex = 0; PelletIndex < NumPellets; ++PelletIndex)
+	{
+		FMosesHitscanRequest& Pellet = PelletRequests.Add_GetRef(BaseRequest);
+		Pellet.CamEnd = BaseRequest.CamStart + (PelletDirs[PelletIndex] * HitscanDistance);
+		Pellet.SpreadDir = PelletDirs[PelletIndex];
+		Pellet.PelletIndex = static_cast<uint8>(PelletIndex);
+		Pellet.PelletCount = static_cast<uint8>(NumPellets);
+	}
 
+	// 배치: 펠릿 N쌍을 연속 큐잉 → 같은 Rewind 묶음에서 병렬 Trace
+	if (bUseHitscanBatch)
 	{
-		TInlineComponentArray<USkeletalMeshComponent*> SkelComps;
-		OwnerPawn->GetComponents<USkeletalMeshComponent>(SkelComps);
-		for (USkeletalMeshComponent* Comp : SkelComps)
+		UMosesHitscanBatchSubsystem* HitscanBatch = World->GetSubsystem<UMosesHitscanBatchSubsystem>();
+		if (HitscanBatch && HitscanBatch->Enqueue_Server(MakeArrayView(PelletRequests)))
 		{
-			if (!Comp)
-			{
-				continue;
-			}
+			return;
+		}
+	}
 
-			if (Comp == OwnerPawn->FindComponentByClass<USkeletalMeshComponent>() || Comp->GetFName() == TEXT("WeaponMesh_Hand"))
-			{
-				MuzzleParams.AddIgnoredComponent(Comp);
-			}
+	// 동기 폴백: 펠릿 세그먼트 전체로 Rewind 1회 → Trace → 순서대로 Resolve
+	FVector SegmentPoints[FMosesSpreadModel::MaxPellets * 2];
+	for (int32 PelletIndex = 0; PelletIndex < NumPellets; ++PelletIndex)
+	{
+		SegmentPoints[PelletIndex * 2] = PelletRequests[PelletIndex].CamStart;
+		SegmentPoints[PelletIndex * 2 + 1] = PelletRequests[PelletIndex].CamEnd;
+	}
+
+	TArray<FMosesHitscanTraceResult, TInlineAllocator<8>> PelletResults;
+	PelletResults.SetNum(NumPellets);
+	{
+		FMosesScopedHitboxRewind ScopedRewind(LagComp, BaseRequest.RewindTimeSec, BaseRequest.ShooterPawn.Get(), MakeArrayView(SegmentPoints, NumPellets * 2));
+		for (int32 PelletIndex = 0; PelletIndex < NumPellets; ++PelletIndex)
+		{
+			UMosesHitscanBatchSubsystem::ExecuteTracePair(World, PelletRequests[PelletIndex], PelletResults[PelletIndex]);
 		}
 	}
 
-	FHitResult FinalHit;
-	const bool bFinalHit = World->LineTraceSingleByChannel(FinalHit, MuzzleStart, MuzzleEnd, FireTraceChannel, MuzzleParams);
+	for (int32 PelletIndex = 0; PelletIndex < NumPellets; ++PelletIndex)
+	{
+		Server_ResolveHitscanResult(PelletRequests[PelletIndex], PelletResults[PelletIndex]);
+	}
+}
+
+void UMosesCombatComponent::Server_ResolveHitscanResult(const FMosesHitscanRequest& Request, const FMosesHitscanTraceResult& Result)
+{
+	APawn* OwnerPawn = Request.ShooterPawn.Get();
+	AController* Controller = Request.ShooterController.Get();
+	if (!OwnerPawn || !GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
 
-	const FVector FinalImpact = (bFinalHit ? (FinalHit.Location.IsNearlyZero() ? FinalHit.ImpactPoint : FinalHit.Location) : MuzzleEnd);
+	const UMosesWeaponData* WeaponData = Request.WeaponData.Get();
 
 	if (bServerTraceDebugDraw)
 	{
-		Multicast_DrawFireTraceDebug(
-			CamStart, CamEnd,
-			bCamHit, CamImpact,
-			MuzzleStart, MuzzleEnd,
-			bFinalHit, FinalImpact);
+		Server_DrawTraceDebug(Request, Result);
+	}
+
+	// 펠릿 샷: 타겟별 누적 → 마지막 펠릿에서 GE 1회씩
+	if (Request.PelletCount > 1)
+	{
+		Server_AccumulatePelletHit(Request, Result);
+		return;
 	}
 
-	if (!bFinalHit || !FinalHit.GetActor())
+	const FHitResult& FinalHit = Result.FinalHit;
+	if (!Result.bFinalHit || !FinalHit.GetActor())
 	{
+		if (Request.bAckToShooter)
+		{
+			Server_QueueShotAck(Request.ShotSeq, EMosesShotAckResult::Miss);
+		}
 		return;
 	}
 
 	// ---------------------------------------------------------------------
-	// Headshot 판정 강화 (좀비 HitBox 대응)
+	// Hit Zone 판정 (레지스트리 테이블 조회 1회)
 	// ---------------------------------------------------------------------
-	bool bHeadshot = false;
+	const EMosesHitZone HitZone = Server_ResolveHitZone(FinalHit);
+	const bool bHeadshot = (HitZone == EMosesHitZone::Head);
 
-	UPrimitiveComponent* HitComp = Cast<UPrimitiveComponent>(FinalHit.GetComponent());
-	const FString HitCompName = HitComp ? HitComp->GetName() : TEXT("None");
+	// Hit Confirm: 클라 예측과 같은 기준 (Pawn 히트 = 히트마커)
+	if (Request.bAckToShooter)
+	{
+		const EMosesShotAckResult AckResult = !Cast<APawn>(FinalHit.GetActor())
+			? EMosesShotAckResult::Miss
+			: (bHeadshot ? EMosesShotAckResult::Headshot : EMosesShotAckResult::Hit);
+
+		Server_QueueShotAck(Request.ShotSeq, AckResult);
+	}
+
+	const float BaseDamage = WeaponData ? WeaponData->Damage : DefaultDamage;
+
+	Server_ApplyHitDamage(FinalHit.GetActor(), BaseDamage * Server_GetHitZoneDamageMultiplier(HitZone), HitZone, FinalHit, Controller, OwnerPawn, WeaponData);
+}
 
-	if (HitComp && HitComp->ComponentHasTag(TEXT("HitZone.Head")))
+void UMosesCombatComponent::Server_AccumulatePelletHit(const FMosesHitscanRequest& Request, const FMosesHitscanTraceResult& Result)
+{
+	// 샷의 첫 펠릿 → 누적 초기화 (중간에 끊긴 이전 샷 누적은 버림)
+	if (Request.PelletIndex == 0 || Request.ShotSeq != ServerPelletShotSeq)
 	{
-		bHeadshot = true;
+		ServerPelletHits.Reset();
+		ServerPelletShotSeq = Request.ShotSeq;
 	}
 
-	if (!bHeadshot)
+	const UMosesWeaponData* WeaponData = Request.WeaponData.Get();
+
+	const FHitResult& PelletHit = Result.FinalHit;
+	AActor* HitActor = PelletHit.GetActor();
+	if (Result.bFinalHit && HitActor)
 	{
-		if (const APlayerCharacter* VictimPlayer = Cast<APlayerCharacter>(FinalHit.GetActor()))
+		const EMosesHitZone HitZone = Server_ResolveHitZone(PelletHit);
+
+		FServerPelletHit* Entry = ServerPelletHits.FindByPredicate([HitActor](const FServerPelletHit& Existing)
+		{
+			return Existing.Target.Get() == HitActor;
+		});
+
+		if (!Entry)
+		{
+			Entry = &ServerPelletHits.AddDefaulted_GetRef();
+			Entry->Target = HitActor;
+		}
+
+		const float PelletDamage = (WeaponData ? WeaponData->Damage : DefaultDamage) * Server_GetHitZoneDamageMultiplier(HitZone);
+
+		// 헤드/몸통 분리 합산 (헤드 1발이 몸통 합산분 전체를 헤드샷으로 만들지 않게)
+		if (HitZone == EMosesHitZone::Head)
 		{
-			if (VictimPlayer->GetHeadHitBox() && FinalHit.GetComponent() == VictimPlayer->GetHeadHitBox())
+			if (Entry->NumHeadPellets == 0)
 			{
-				bHeadshot = true;
+				Entry->HeadHit = PelletHit;
 			}
+
+			Entry->HeadDamage += PelletDamage;
+			++Entry->NumHeadPellets;
+		}
+		else
+		{
+			if (Entry->NumBodyPellets == 0)
+			{
+				Entry->BodyHit = PelletHit;
+				Entry->BodyZone = HitZone;
+			}
+
+			Entry->BodyDamage += PelletDamage;
+			++Entry->NumBodyPellets;
 		}
 	}
 
-	if (!bHeadshot)
+	if (Request.PelletIndex + 1 < Request.PelletCount)
 	{
-		if (HitComp && HitCompName.Contains(TEXT("HeadHitBox")))
-		{
-			bHeadshot = true;
-		}
+		return;
 	}
 
-	if (!bHeadshot)
+	// ---------------------------------------------------------------------
+	// 마지막 펠릿: Ack 1개 + 타겟별 GE 1회
+	// ---------------------------------------------------------------------
+	bool bPawnHit = false;
+	bool bPawnHeadshot = false;
+	for (const FServerPelletHit& Entry : ServerPelletHits)
 	{
-		if (!FinalHit.BoneName.IsNone())
+		if (Cast<APawn>(Entry.Target.Get()))
 		{
-			const FString BoneLower = FinalHit.BoneName.ToString().ToLower();
-			bHeadshot = (FinalHit.BoneName == HeadshotBoneName) || BoneLower.Contains(TEXT("head"));
+			bPawnHit = true;
+			bPawnHeadshot |= (Entry.NumHeadPellets > 0);
 		}
 	}
 
-	const float BaseDamage = WeaponData ? WeaponData->Damage : DefaultDamage;
+	if (Request.bAckToShooter)
+	{
+		Server_QueueShotAck(Request.ShotSeq, bPawnHeadshot ? EMosesShotAckResult::Headshot : (bPawnHit ? EMosesShotAckResult::Hit : EMosesShotAckResult::Miss));
+	}
 
-	const bool bIsZombie = Server_IsZombieTarget(FinalHit.GetActor());
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[HIT][SV] Pellets ShotSeq=%u Pellets=%u Targets=%d"),
+		Request.ShotSeq, Request.PelletCount, ServerPelletHits.Num());
 
-	float AppliedDamage = BaseDamage;
-	if (bHeadshot)
+	// 타겟별 몸통 → 헤드 순 (몸통 합산만으로 죽으면 헤드샷 크레딧 없음)
+	for (const FServerPelletHit& Entry : ServerPelletHits)
 	{
-		if (bIsZombie)
+		AActor* Target = Entry.Target.Get();
+		if (!Target)
+		{
+			continue;
+		}
+
+		if (Entry.NumBodyPellets > 0)
 		{
-			AppliedDamage = 99999.0f;
+			Server_ApplyHitDamage(Target, Entry.BodyDamage, Entry.BodyZone, Entry.BodyHit, Request.ShooterController.Get(), Request.ShooterPawn.Get(), WeaponData);
 		}
-		else
+
+		if (Entry.NumHeadPellets > 0)
 		{
-			AppliedDamage = BaseDamage * HeadshotDamageMultiplier;
+			Server_ApplyHitDamage(Target, Entry.HeadDamage, EMosesHitZone::Head, Entry.HeadHit, Request.ShooterController.Get(), Request.ShooterPawn.Get(), WeaponData);
 		}
 	}
 
-	UE_LOG(LogMosesCombat, Warning, TEXT("[HIT][SV] Victim=%s Comp=%s Bone=%s Headshot=%d IsZombie=%d Damage=%.1f"),
-		*GetNameSafe(FinalHit.GetActor()),
-		*GetNameSafe(FinalHit.GetComponent()),
-		FinalHit.BoneName.IsNone() ? TEXT("None") : *FinalHit.BoneName.ToString(),
-		bHeadshot ? 1 : 0,
+	ServerPelletHits.Reset();
+}
+
+void UMosesCombatComponent::Server_ApplyHitDamage(AActor* TargetActor, float Damage, EMosesHitZone HitZone, const FHitResult& Hit, AController* Controller, APawn* OwnerPawn, const UMosesWeaponData* WeaponData)
+{
+	const bool bIsZombie = Server_IsZombieTarget(TargetActor);
+
+	float AppliedDamage = Damage;
+	if (HitZone == EMosesHitZone::Head && bIsZombie)
+	{
+		AppliedDamage = 99999.0f;
+	}
+
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[HIT][SV] Victim=%s Comp=%s Bone=%s Zone=%d IsZombie=%d Damage=%.1f"),
+		*GetNameSafe(TargetActor),
+		*GetNameSafe(Hit.GetComponent()),
+		*Hit.BoneName.ToString(),
+		static_cast<int32>(HitZone),
 		bIsZombie ? 1 : 0,
 		AppliedDamage);
 
 	const bool bAppliedByGAS = Server_ApplyDamageToTarget_GAS(
-		FinalHit.GetActor(),
+		TargetActor,
 		AppliedDamage,
 		Controller,
 		OwnerPawn,
 		WeaponData,
-		FinalHit);
+		Hit,
+		HitZone);
 
 	if (!bAppliedByGAS)
 	{
-		UGameplayStatics::ApplyDamage(FinalHit.GetActor(), AppliedDamage, Controller, OwnerPawn, nullptr);
+		UGameplayStatics::ApplyDamage(TargetActor, AppliedDamage, Controller, OwnerPawn, nullptr);
 	}
 }
 
@@ -1081,7 +1188,8 @@ void UMosesCombatComponent::Server_SpawnGrenadeProjectile(
 	const FVector& SpawnLoc,
 	const FVector& FireDir,
 	AController* InstigatorController,
-	APawn* OwnerPawn)
+	APawn* OwnerPawn,
+	uint16 ShotSeq)
 {
 	if (!GetOwner() || !GetOwner()->HasAuthority())
 	{
@@ -1121,7 +1229,12 @@ void UMosesCombatComponent::Server_SpawnGrenadeProjectile(
 		return;
 	}
 
-	TSubclassOf<UGameplayEffect> GEClass = DamageGE_SetByCaller.LoadSynchronous();
+	if (!CachedDamageGE)
+	{
+		CachedDamageGE = UMosesCombatAssetSubsystem::ResolveClass(this, DamageGE_SetByCaller);
+	}
+
+	TSubclassOf<UGameplayEffect> GEClass = CachedDamageGE;
 	if (!GEClass)
 	{
 		UE_LOG(LogMosesGAS, Warning,
@@ -1129,28 +1242,54 @@ void UMosesCombatComponent::Server_SpawnGrenadeProjectile(
 			*DamageGE_SetByCaller.ToSoftObjectPath().ToString());
 	}
 
-	FActorSpawnParameters Params;
-	Params.Owner = OwnerPawn;
-	Params.Instigator = OwnerPawn;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	const float ExplodeDamage =
+		(WeaponData->ExplosionDamageOverride > 0.0f)
+		? WeaponData->ExplosionDamageOverride
+		: WeaponData->Damage;
+
+	// [ADD] 액터 없는 시뮬레이션 (실패/상한 시 아래 액터 경로)
+	if (WeaponData->bSimulateProjectileWithoutActor)
+	{
+		if (UMosesProjectileManagerSubsystem* ProjectileManager = GetWorld()->GetSubsystem<UMosesProjectileManagerSubsystem>())
+		{
+			const uint32 ProjectileId = ProjectileManager->Launch_Server(
+				WeaponData, SpawnLoc, FireDir, SourceASC, GEClass, ExplodeDamage, InstigatorController, OwnerPawn, ShotSeq);
+
+			if (ProjectileId != 0)
+			{
+				UE_LOG(LogMosesCombat, Verbose,
+					TEXT("[GRENADE][SV] Sim Launch OK Weapon=%s Id=%u Active=%d"),
+					*WeaponData->WeaponId.ToString(), ProjectileId, ProjectileManager->GetNumActive());
+				return;
+			}
+		}
+	}
 
 	const FRotator SpawnRot = FireDir.Rotation();
 
-	AMosesGrenadeProjectile* Projectile =
-		GetWorld()->SpawnActor<AMosesGrenadeProjectile>(ProjectileClass, SpawnLoc, SpawnRot, Params);
+	// [MOD] 풀에서 대기 Projectile 재사용 (Warmup에 Prewarm, 고갈 시 풀이 스폰)
+	AMosesGrenadeProjectile* Projectile = nullptr;
+	if (UMosesProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UMosesProjectilePoolSubsystem>())
+	{
+		Projectile = ProjectilePool->Acquire_Server(ProjectileClass, SpawnLoc, SpawnRot, OwnerPawn);
+	}
+	else
+	{
+		FActorSpawnParameters Params;
+		Params.Owner = OwnerPawn;
+		Params.Instigator = OwnerPawn;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+		Projectile = GetWorld()->SpawnActor<AMosesGrenadeProjectile>(ProjectileClass, SpawnLoc, SpawnRot, Params);
+	}
 
 	if (!Projectile)
 	{
 		UE_LOG(LogMosesCombat, Warning,
-			TEXT("[GRENADE][SV] Spawn FAIL (SpawnActor returned null)"));
+			TEXT("[GRENADE][SV] Spawn FAIL (Pool/SpawnActor returned null)"));
 		return;
 	}
 
-	const float ExplodeDamage =
-		(WeaponData->ExplosionDamageOverride > 0.0f)
-		? WeaponData->ExplosionDamageOverride
-		: WeaponData->Damage;
-
 	Projectile->InitFromCombat_Server(
 		SourceASC,
 		GEClass,
@@ -1160,7 +1299,7 @@ void UMosesCombatComponent::Server_SpawnGrenadeProjectile(
 		OwnerPawn,
 		WeaponData);
 
-	Projectile->Launch_Server(FireDir, WeaponData->ProjectileSpeed);
+	Projectile->Launch_Server(FireDir, WeaponData->ProjectileSpeed, ShotSeq);
 
 	UE_LOG(LogMosesCombat, Warning,
 		TEXT("[GRENADE][SV] Spawn OK Weapon=%s Loc=%s Speed=%.1f Radius=%.1f Damage=%.1f GE=%s"),
@@ -1178,7 +1317,8 @@ bool UMosesCombatComponent::Server_ApplyDamageToTarget_GAS(
 	AController* InstigatorController,
 	AActor* DamageCauser,
 	const UMosesWeaponData* WeaponData,
-	const FHitResult& Hit) const
+	const FHitResult& Hit,
+	EMosesHitZone HitZone) const
 {
 	if (APawn* TargetPawn = Cast<APawn>(TargetActor))
 	{
@@ -1298,55 +1438,8 @@ bool UMosesCombatComponent::Server_ApplyDamageToTarget_GAS(
 		return false;
 	}
 
-	const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(GEClass, 1.0f, Ctx);
-	if (!SpecHandle.IsValid() || !SpecHandle.Data.IsValid())
-	{
-		return false;
-	}
-
-	// Headshot 판정(동일 로직 유지)
-	bool bIsHeadshot = false;
-
-	UPrimitiveComponent* HitComp = Cast<UPrimitiveComponent>(Hit.GetComponent());
-	const FString HitCompName = HitComp ? HitComp->GetName() : TEXT("None");
-
-	if (HitComp && HitComp->ComponentHasTag(TEXT("HitZone.Head")))
-	{
-		bIsHeadshot = true;
-	}
-
-	if (!bIsHeadshot)
-	{
-		if (const APlayerCharacter* VictimPlayer = Cast<APlayerCharacter>(TargetActor))
-		{
-			if (VictimPlayer->GetHeadHitBox() && Hit.GetComponent() == VictimPlayer->GetHeadHitBox())
-			{
-				bIsHeadshot = true;
-			}
-		}
-	}
-
-	if (!bIsHeadshot)
-	{
-		if (HitComp && HitCompName.Contains(TEXT("HeadHitBox")))
-		{
-			bIsHeadshot = true;
-		}
-	}
-
-	if (!bIsHeadshot)
-	{
-		if (!Hit.BoneName.IsNone())
-		{
-			const FString BoneLower = Hit.BoneName.ToString().ToLower();
-			bIsHeadshot = (Hit.BoneName == HeadshotBoneName) || BoneLower.Contains(TEXT("head"));
-		}
-	}
-
-	if (bIsHeadshot)
-	{
-		SpecHandle.Data->AddDynamicAssetTag(FMosesGameplayTags::Get().Hit_Headshot);
-	}
+	// Headshot 판정: 호출자가 분류한 HitZone 재사용
+	const bool bIsHeadshot = (HitZone == EMosesHitZone::Head);
 
 	float FinalDamageForSetByCaller = FMath::Abs(Damage);
 	if (bZombieTarget && bIsHeadshot)
@@ -1354,30 +1447,29 @@ bool UMosesCombatComponent::Server_ApplyDamageToTarget_GAS(
 		FinalDamageForSetByCaller = 99999.0f;
 	}
 
-	SpecHandle.Data->SetSetByCallerMagnitude(FMosesGameplayTags::Get().Data_Damage, FinalDamageForSetByCaller);
-
 	// ---------------------------------------------------------------------
-	// ★ Apply 결과 핸들을 받아서, 성공 시 HitImpact Cue 실행
+	// [MOD] Spec/Apply는 Damage Accumulator가 프레임당 (타겟, 인스티게이터) 묶음으로 1회
+	//       (HitImpact Cue도 Apply 성공 시 묶음당 1회)
 	// ---------------------------------------------------------------------
-	const FActiveGameplayEffectHandle Applied =
-		SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+	FMosesDamageEvent DamageEvent;
+	DamageEvent.SourceASC = SourceASC;
+	DamageEvent.TargetASC = TargetASC;
+	DamageEvent.DamageGE = GEClass;
+	DamageEvent.Context = Ctx;
+	DamageEvent.Magnitude = FinalDamageForSetByCaller;
+	DamageEvent.bHeadshot = bIsHeadshot;
+	DamageEvent.ImpactCueTag = FMosesGameplayTags::Get().GameplayCue_Weapon_HitImpact;
+	DamageEvent.CueSourceObject = WeaponData;
 
-	if (Applied.WasSuccessfullyApplied())
+	UWorld* World = GetWorld();
+	UMosesDamageAccumulatorSubsystem* DamageAccumulator = World ? World->GetSubsystem<UMosesDamageAccumulatorSubsystem>() : nullptr;
+	if (!DamageAccumulator || !DamageAccumulator->AddDamage_Server(DamageEvent))
 	{
-		FGameplayCueParameters Params;
-		Params.EffectContext = Ctx;
-		Params.SourceObject = const_cast<UMosesWeaponData*>(WeaponData);
-
-		TargetASC->ExecuteGameplayCue(FMosesGameplayTags::Get().GameplayCue_Weapon_HitImpact, Params);
-
-		UE_LOG(LogMosesGAS, Verbose,
-			TEXT("[GC][SV] Execute HitImpact(TargetASC) Target=%s Weapon=%s"),
-			*GetNameSafe(TargetActor),
-			WeaponData ? *WeaponData->WeaponId.ToString() : TEXT("None"));
+		return UMosesDamageAccumulatorSubsystem::ApplyNow_Server(DamageEvent);
 	}
 
-	UE_LOG(LogMosesGAS, Warning,
-		TEXT("[GAS][SV] APPLY OK TargetActor=%s ResolvedOwner=%s Damage=%.1f Weapon=%s GE=%s Bone=%s Headshot=%d IsZombie=%d HitComp=%s"),
+	UE_LOG(LogMosesGAS, Verbose,
+		TEXT("[GAS][SV] APPLY QUEUED TargetActor=%s ResolvedOwner=%s Damage=%.1f Weapon=%s GE=%s Bone=%s Headshot=%d IsZombie=%d HitComp=%s"),
 		*GetNameSafe(TargetActor),
 		*GetNameSafe(ResolvedTargetOwnerForLog),
 		FinalDamageForSetByCaller,
@@ -1386,17 +1478,11 @@ bool UMosesCombatComponent::Server_ApplyDamageToTarget_GAS(
 		Hit.BoneName.IsNone() ? TEXT("None") : *Hit.BoneName.ToString(),
 		bIsHeadshot ? 1 : 0,
 		bZombieTarget ? 1 : 0,
-		*HitCompName);
+		*GetNameSafe(Hit.GetComponent()));
 
-	if (bIsHeadshot && InstigatorController)
-	{
-		if (AMosesPlayerController* MPC = Cast<AMosesPlayerController>(InstigatorController))
-		{
-			MPC->Client_ShowHeadshotToast_OwnerOnly(FText::FromString(TEXT("헤드샷!")), 0.8f);
-		}
-	}
+	// [MOD] 헤드샷 토스트: Client RPC 대신 발사자 로컬 예측 + Shot Ack 보정 (OnHitConfirm)
 
-	return Applied.WasSuccessfullyApplied();
+	return true;
 }
 
 // ============================================================================
@@ -1419,25 +1505,9 @@ void UMosesCombatComponent::Server_PropagateFireCosmetics(const UMosesWeaponData
 		*GetNameSafe(PlayerChar),
 		WeaponData ? *WeaponData->WeaponId.ToString() : TEXT("None"));
 
-	// 1) 기존: 발사 몽타주(멀티캐스트) 유지
-	PlayerChar->Multicast_PlayFireMontage(WeaponIdForMontage);
-
-	// 2) [ADD] GameplayCue: MuzzleFlash (SourceASC)
-	if (AMosesPlayerState* PS = MosesCombat_Private::GetOwnerPS(this))
-	{
-		if (UAbilitySystemComponent* ASC = PS->GetAbilitySystemComponent())
-		{
-			FGameplayCueParameters Params;
-			Params.SourceObject = const_cast<UMosesWeaponData*>(WeaponData); // ★ WeaponData 전달
-
-			ASC->ExecuteGameplayCue(FMosesGameplayTags::Get().GameplayCue_Weapon_MuzzleFlash, Params);
-
-			UE_LOG(LogMosesGAS, Verbose,
-				TEXT("[GC][SV] Execute MuzzleFlash Cue Weapon=%s PS=%s"),
-				WeaponData ? *WeaponData->WeaponId.ToString() : TEXT("None"),
-				*GetNameSafe(PS));
-		}
-	}
+	// [MOD] 샷당 Multicast(몽타주) + MuzzleFlash Cue 제거
+	// → Burst Counter 복제: 시뮬 프록시가 몽타주/머즐/사운드(PlayFireAV_Local)를 파생 재생
+	PlayerChar->Server_NotifyFired(WeaponIdForMontage);
 }
 
 // ============================================================================
@@ -1458,14 +1528,10 @@ void UMosesCombatComponent::ServerMarkDead()
 
 	bIsDead = true;
 
-	bWantsToFire = false;
-	StopAutoFire_Server();
-
 	bIsReloading = false;
 
 	if (UWorld* World = GetWorld())
 	{
-		World->GetTimerManager().ClearTimer(AutoFireTimerHandle);
 		World->GetTimerManager().ClearTimer(ReloadTimerHandle);
 	}
 
@@ -1485,18 +1551,20 @@ void UMosesCombatComponent::ServerClearDeadAfterRespawn()
 		return;
 	}
 
-	bWantsToFire = false;
-	StopAutoFire_Server();
-
 	const bool bOldDead = bIsDead;
 	const bool bOldReload = bIsReloading;
 
 	bIsDead = false;
 	bIsReloading = false;
 
+	// 새 생명: 연사 간격 기준 리셋 (Seq는 유지 → 지연 도착한 이전 생명 샷은 계속 중복 제거)
+	ServerLastShotTimeSec = -1.0;
+
+	// 새 생명: 스프레드 시드 재발급 (이전 생명 패턴 재사용 방지)
+	SpreadLifeSeed = MosesCombat_Private::MakeLifeSeed();
+
 	if (UWorld* World = GetWorld())
 	{
-		World->GetTimerManager().ClearTimer(AutoFireTimerHandle);
 		World->GetTimerManager().ClearTimer(ReloadTimerHandle);
 	}
 
@@ -1521,65 +1589,68 @@ void UMosesCombatComponent::ServerClearDeadAfterRespawn()
 // RepNotifies
 // ============================================================================
 
-void UMosesCombatComponent::OnRep_CurrentSlot()
-{
-	BroadcastEquippedChanged(TEXT("OnRep_CurrentSlot"));
-	BroadcastAmmoChanged(TEXT("OnRep_CurrentSlot"));
-	BroadcastSlotsStateChanged(0, TEXT("OnRep_CurrentSlot"));
-}
-
-void UMosesCombatComponent::OnRep_Slot1WeaponId()
+void UMosesCombatComponent::OnRep_SlotState()
 {
-	BroadcastEquippedChanged(TEXT("OnRep_Slot1WeaponId"));
-	BroadcastSlotsStateChanged(1, TEXT("OnRep_Slot1WeaponId"));
-}
+	const UWorld* World = GetWorld();
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr;
 
-void UMosesCombatComponent::OnRep_Slot2WeaponId()
-{
-	BroadcastEquippedChanged(TEXT("OnRep_Slot2WeaponId"));
-	BroadcastSlotsStateChanged(2, TEXT("OnRep_Slot2WeaponId"));
-}
+	// Weapon Dirty 슬롯만 NetIndex → WeaponId 복원 + Runtime 재구성
+	for (int32 SlotIndex = 1; SlotIndex <= FMosesPackedSlotState::NumSlots; ++SlotIndex)
+	{
+		if (SlotState.ReceivedWeaponMask & (1 << (SlotIndex - 1)))
+		{
+			const uint8 NetIndex = SlotState.GetSlot(SlotIndex).WeaponIndex;
+			RebuildSlotRuntime(SlotIndex, Registry ? Registry->GetWeaponIdByNetIndex(NetIndex) : FGameplayTag());
+		}
+	}
 
-void UMosesCombatComponent::OnRep_Slot3WeaponId()
-{
-	BroadcastEquippedChanged(TEXT("OnRep_Slot3WeaponId"));
-	BroadcastSlotsStateChanged(3, TEXT("OnRep_Slot3WeaponId"));
+	HandleSlotStateChanged(
+		SlotState.ReceivedWeaponMask,
+		SlotState.ReceivedAmmoMask,
+		SlotState.bReceivedSwap,
+		SlotState.bReceivedCurrentSlot,
+		TEXT("OnRep_SlotState"));
 }
 
-void UMosesCombatComponent::OnRep_Slot4WeaponId()
+void UMosesCombatComponent::HandleSlotStateChanged(uint8 WeaponSlotMask, uint8 AmmoSlotMask, bool bSwapChanged, bool bCurrentSlotChanged, const TCHAR* ContextTag)
 {
-	BroadcastEquippedChanged(TEXT("OnRep_Slot4WeaponId"));
-	BroadcastSlotsStateChanged(4, TEXT("OnRep_Slot4WeaponId"));
-}
+	if (bSwapChanged)
+	{
+		BroadcastSwapStarted(ContextTag);
+	}
 
-void UMosesCombatComponent::OnRep_Slot1Ammo()
-{
-	BroadcastAmmoChanged(TEXT("OnRep_Slot1Ammo"));
-	BroadcastSlotsStateChanged(1, TEXT("OnRep_Slot1Ammo"));
-}
+	if (bCurrentSlotChanged || WeaponSlotMask != 0)
+	{
+		BroadcastEquippedChanged(ContextTag);
+	}
 
-void UMosesCombatComponent::OnRep_Slot2Ammo()
-{
-	BroadcastAmmoChanged(TEXT("OnRep_Slot2Ammo"));
-	BroadcastSlotsStateChanged(2, TEXT("OnRep_Slot2Ammo"));
-}
+	if (bCurrentSlotChanged || AmmoSlotMask != 0)
+	{
+		BroadcastAmmoChanged(ContextTag);
+	}
 
-void UMosesCombatComponent::OnRep_Slot3Ammo()
-{
-	BroadcastAmmoChanged(TEXT("OnRep_Slot3Ammo"));
-	BroadcastSlotsStateChanged(3, TEXT("OnRep_Slot3Ammo"));
-}
+	// CurrentSlot 변경 = 전체 갱신(0), 아니면 바뀐 슬롯만
+	if (bCurrentSlotChanged)
+	{
+		BroadcastSlotsStateChanged(0, ContextTag);
+		return;
+	}
 
-void UMosesCombatComponent::OnRep_Slot4Ammo()
-{
-	BroadcastAmmoChanged(TEXT("OnRep_Slot4Ammo"));
-	BroadcastSlotsStateChanged(4, TEXT("OnRep_Slot4Ammo"));
+	const uint8 ChangedMask = WeaponSlotMask | AmmoSlotMask;
+	for (int32 SlotIndex = 1; SlotIndex <= FMosesPackedSlotState::NumSlots; ++SlotIndex)
+	{
+		if (ChangedMask & (1 << (SlotIndex - 1)))
+		{
+			BroadcastSlotsStateChanged(SlotIndex, ContextTag);
+		}
+	}
 }
 
 void UMosesCombatComponent::OnRep_IsReloading()
 {
 	BroadcastReloadingChanged(TEXT("OnRep_IsReloading"));
-	BroadcastSlotsStateChanged(CurrentSlot, TEXT("OnRep_IsReloading"));
+	BroadcastSlotsStateChanged(SlotState.CurrentSlot, TEXT("OnRep_IsReloading"));
 }
 
 void UMosesCombatComponent::OnRep_IsDead()
@@ -1587,11 +1658,6 @@ void UMosesCombatComponent::OnRep_IsDead()
 	BroadcastDeadChanged(TEXT("OnRep_IsDead"));
 }
 
-void UMosesCombatComponent::OnRep_SwapSerial()
-{
-	BroadcastSwapStarted(TEXT("OnRep_SwapSerial"));
-}
-
 // ============================================================================
 // Broadcast helpers
 // ============================================================================
@@ -1599,23 +1665,23 @@ void UMosesCombatComponent::OnRep_SwapSerial()
 void UMosesCombatComponent::BroadcastEquippedChanged(const TCHAR* ContextTag)
 {
 	const FGameplayTag WeaponId = GetEquippedWeaponId();
-	OnEquippedChanged.Broadcast(CurrentSlot, WeaponId);
+	OnEquippedChanged.Broadcast(SlotState.CurrentSlot, WeaponId);
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][REP] %s Slot=%d Weapon=%s"),
-		ContextTag ? ContextTag : TEXT("None"), CurrentSlot, *WeaponId.ToString());
+		ContextTag ? ContextTag : TEXT("None"), SlotState.CurrentSlot, *WeaponId.ToString());
 }
 
 void UMosesCombatComponent::BroadcastAmmoChanged(const TCHAR* ContextTag)
 {
 	int32 Mag = 0, Cur = 0, Max = 0;
-	GetSlotAmmo_Internal(CurrentSlot, Mag, Cur, Max);
+	GetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, Cur, Max);
 
 	OnAmmoChanged.Broadcast(Mag, Cur);
 	OnAmmoChangedEx.Broadcast(Mag, Cur, Max);
 
 	UE_LOG(LogMosesCombat, Warning, TEXT("[AMMO][REP] %s Slot=%d Mag=%d Reserve=%d/%d"),
 		ContextTag ? ContextTag : TEXT("None"),
-		CurrentSlot,
+		SlotState.CurrentSlot,
 		Mag,
 		Cur,
 		Max);
@@ -1634,21 +1700,21 @@ void UMosesCombatComponent::BroadcastReloadingChanged(const TCHAR* ContextTag)
 	OnReloadingChanged.Broadcast(bIsReloading);
 
 	UE_LOG(LogMosesWeapon, Verbose, TEXT("[RELOAD][REP] %s Reloading=%d Slot=%d"),
-		ContextTag ? ContextTag : TEXT("None"), bIsReloading ? 1 : 0, CurrentSlot);
+		ContextTag ? ContextTag : TEXT("None"), bIsReloading ? 1 : 0, SlotState.CurrentSlot);
 }
 
 void UMosesCombatComponent::BroadcastSwapStarted(const TCHAR* ContextTag)
 {
-	const int32 FromSlot = MosesCombat_Private::ClampSlotIndex(LastSwapFromSlot);
-	const int32 ToSlot = MosesCombat_Private::ClampSlotIndex(LastSwapToSlot);
+	const int32 FromSlot = MosesCombat_Private::ClampSlotIndex(SlotState.LastSwapFromSlot);
+	const int32 ToSlot = MosesCombat_Private::ClampSlotIndex(SlotState.LastSwapToSlot);
 
-	OnSwapStarted.Broadcast(FromSlot, ToSlot, SwapSerial);
+	OnSwapStarted.Broadcast(FromSlot, ToSlot, SlotState.SwapSerial);
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[SWAP][REP] %s From=%d To=%d Serial=%d PS=%s"),
 		ContextTag ? ContextTag : TEXT("None"),
 		FromSlot,
 		ToSlot,
-		SwapSerial,
+		SlotState.SwapSerial,
 		*GetNameSafe(GetOwner()));
 }
 
@@ -1663,42 +1729,72 @@ bool UMosesCombatComponent::IsValidSlotIndex(int32 SlotIndex) const
 
 FGameplayTag UMosesCombatComponent::GetSlotWeaponIdInternal(int32 SlotIndex) const
 {
-	switch (SlotIndex)
+	// 서버: Set 시점 태그 / 클라: OnRep_SlotState에서 NetIndex로 복원한 태그
+	return IsValidSlotIndex(SlotIndex) ? SlotRuntime[SlotIndex - 1].WeaponId : FGameplayTag();
+}
+
+void UMosesCombatComponent::RebuildSlotRuntime(int32 SlotIndex, const FGameplayTag& WeaponId)
+{
+	if (!IsValidSlotIndex(SlotIndex))
 	{
-	case 1: return Slot1WeaponId;
-	case 2: return Slot2WeaponId;
-	case 3: return Slot3WeaponId;
-	case 4: return Slot4WeaponId;
-	default: break;
+		return;
 	}
-	return FGameplayTag();
+
+	FMosesWeaponSlotRuntime& Runtime = SlotRuntime[SlotIndex - 1];
+	Runtime = FMosesWeaponSlotRuntime();
+	Runtime.WeaponId = WeaponId;
+	Runtime.FireIntervalSec = Server_GetFireIntervalSec_FromWeaponData(nullptr);
+	Runtime.Damage = DefaultDamage;
+
+	if (!Runtime.WeaponId.IsValid())
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr;
+
+	const UMosesWeaponData* Data = Registry ? Registry->ResolveWeaponData(Runtime.WeaponId) : nullptr;
+	if (!Data)
+	{
+		return;
+	}
+
+	Runtime.WeaponData = Data;
+	Runtime.FireIntervalSec = Server_GetFireIntervalSec_FromWeaponData(Data);
+	Runtime.SpreadDegreesMin = Data->SpreadDegrees_Min;
+	Runtime.SpreadDegreesMax = Data->SpreadDegrees_Max;
+	Runtime.SpreadSpeedRef = Data->SpreadSpeedRef;
+	Runtime.Damage = Data->Damage;
+	Runtime.MagSize = Data->MagSize;
+	Runtime.MaxReserve = Data->MaxReserve;
+	Runtime.MuzzleSocketName = Data->MuzzleSocketName;
+	Runtime.bIsProjectileWeapon = Data->bIsProjectileWeapon;
+}
+
+const FMosesWeaponSlotRuntime& UMosesCombatComponent::GetEquippedSlotRuntime() const
+{
+	return SlotRuntime[FMath::Clamp<int32>(SlotState.CurrentSlot, 1, 4) - 1];
 }
 
 void UMosesCombatComponent::Server_SetSlotWeaponId_Internal(int32 SlotIndex, const FGameplayTag& WeaponId)
 {
 	check(GetOwner() && GetOwner()->HasAuthority());
 
-	switch (SlotIndex)
-	{
-	case 1:
-		Slot1WeaponId = WeaponId;
-		OnRep_Slot1WeaponId();
-		break;
-	case 2:
-		Slot2WeaponId = WeaponId;
-		OnRep_Slot2WeaponId();
-		break;
-	case 3:
-		Slot3WeaponId = WeaponId;
-		OnRep_Slot3WeaponId();
-		break;
-	case 4:
-		Slot4WeaponId = WeaponId;
-		OnRep_Slot4WeaponId();
-		break;
-	default:
-		break;
+	if (!IsValidSlotIndex(SlotIndex))
+	{
+		return;
 	}
+
+	const UWorld* World = GetWorld();
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr;
+
+	SlotState.GetSlot(SlotIndex).WeaponIndex = Registry ? Registry->GetWeaponNetIndex(WeaponId) : 0;
+	RebuildSlotRuntime(SlotIndex, WeaponId);
+
+	HandleSlotStateChanged(static_cast<uint8>(1 << (SlotIndex - 1)), 0, false, false, TEXT("Server_SetSlotWeaponId_Internal"));
 }
 
 void UMosesCombatComponent::Server_EnsureAmmoInitializedForSlot(int32 SlotIndex, const FGameplayTag& WeaponId)
@@ -1741,11 +1837,6 @@ void UMosesCombatComponent::Server_EnsureAmmoInitializedForSlot(int32 SlotIndex,
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[AMMO][SV] EnsureAmmo INIT Slot=%d Weapon=%s Ammo Mag=%d Reserve=%d/%d PS=%s"),
 		SlotIndex, *WeaponId.ToString(), InitMag, InitCur, InitMax, *GetNameSafe(GetOwner()));
-
-	if (CurrentSlot == SlotIndex)
-	{
-		BroadcastAmmoChanged(TEXT("Server_EnsureAmmoInitializedForSlot(CurrentSlot)"));
-	}
 }
 
 // ============================================================================
@@ -1758,35 +1849,15 @@ void UMosesCombatComponent::GetSlotAmmo_Internal(int32 SlotIndex, int32& OutMag,
 	OutReserveCur = 0;
 	OutReserveMax = 0;
 
-	switch (SlotIndex)
+	if (!IsValidSlotIndex(SlotIndex))
 	{
-	case 1:
-		OutMag = Slot1MagAmmo;
-		OutReserveCur = Slot1ReserveAmmo;
-		OutReserveMax = Slot1ReserveMax;
-		return;
-
-	case 2:
-		OutMag = Slot2MagAmmo;
-		OutReserveCur = Slot2ReserveAmmo;
-		OutReserveMax = Slot2ReserveMax;
-		return;
-
-	case 3:
-		OutMag = Slot3MagAmmo;
-		OutReserveCur = Slot3ReserveAmmo;
-		OutReserveMax = Slot3ReserveMax;
-		return;
-
-	case 4:
-		OutMag = Slot4MagAmmo;
-		OutReserveCur = Slot4ReserveAmmo;
-		OutReserveMax = Slot4ReserveMax;
-		return;
-
-	default:
 		return;
 	}
+
+	const FMosesPackedSlot& Slot = SlotState.GetSlot(SlotIndex);
+	OutMag = Slot.MagAmmo;
+	OutReserveCur = Slot.ReserveAmmo;
+	OutReserveMax = Slot.ReserveMax;
 }
 
 void UMosesCombatComponent::SetSlotAmmo_Internal(int32 SlotIndex, int32 NewMag, int32 NewReserveCur, int32 NewReserveMax)
@@ -1800,39 +1871,18 @@ void UMosesCombatComponent::SetSlotAmmo_Internal(int32 SlotIndex, int32 NewMag,
 	NewReserveMax = FMath::Max(NewReserveMax, 0);
 	NewReserveCur = FMath::Clamp(NewReserveCur, 0, NewReserveMax);
 
-	switch (SlotIndex)
+	if (!IsValidSlotIndex(SlotIndex))
 	{
-	case 1:
-		Slot1MagAmmo = NewMag;
-		Slot1ReserveMax = NewReserveMax;
-		Slot1ReserveAmmo = NewReserveCur;
-		OnRep_Slot1Ammo();
-		return;
-
-	case 2:
-		Slot2MagAmmo = NewMag;
-		Slot2ReserveMax = NewReserveMax;
-		Slot2ReserveAmmo = NewReserveCur;
-		OnRep_Slot2Ammo();
-		return;
-
-	case 3:
-		Slot3MagAmmo = NewMag;
-		Slot3ReserveMax = NewReserveMax;
-		Slot3ReserveAmmo = NewReserveCur;
-		OnRep_Slot3Ammo();
 		return;
+	}
 
-	case 4:
-		Slot4MagAmmo = NewMag;
-		Slot4ReserveMax = NewReserveMax;
-		Slot4ReserveAmmo = NewReserveCur;
-		OnRep_Slot4Ammo();
-		return;
+	// 패킹 범위(10bit) 초과분은 여기서 Clamp
+	FMosesPackedSlot& Slot = SlotState.GetSlot(SlotIndex);
+	Slot.MagAmmo = FMosesPackedSlotState::ClampAmmo(NewMag);
+	Slot.ReserveMax = FMosesPackedSlotState::ClampAmmo(NewReserveMax);
+	Slot.ReserveAmmo = FMosesPackedSlotState::ClampAmmo(NewReserveCur);
 
-	default:
-		return;
-	}
+	HandleSlotStateChanged(0, static_cast<uint8>(1 << (SlotIndex - 1)), false, false, TEXT("SetSlotAmmo_Internal"));
 }
 
 void UMosesCombatComponent::GetSlotAmmo_Internal(int32 SlotIndex, int32& OutMag, int32& OutReserveCur) const
@@ -1932,356 +1982,704 @@ void UMosesCombatComponent::ServerAddAmmoByTag(FGameplayTag AmmoTypeId, int32 Re
 }
 
 // ============================================================================
-// Trace Debug (Server -> All Clients)
+// Trace Debug (Server local)
+// - 클라는 같은 시드로 PredictShot_Local에서 직접 그린다 (Multicast 없음)
 // ============================================================================
 
-void UMosesCombatComponent::Multicast_DrawFireTraceDebug_Implementation(
-	const FVector& CamStart,
-	const FVector& CamEnd,
-	bool bCamHit,
-	const FVector& CamImpact,
-	const FVector& MuzzleStart,
-	const FVector& MuzzleEnd,
-	bool bFinalHit,
-	const FVector& FinalImpact)
+void UMosesCombatComponent::Server_DrawTraceDebug(const FMosesHitscanRequest& Request, const FMosesHitscanTraceResult& Result) const
 {
 #if ENABLE_DRAW_DEBUG
-	if (GetNetMode() == NM_DedicatedServer)
+	UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld() || GetNetMode() == NM_DedicatedServer)
 	{
 		return;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
+	const float Life = FMath::Max(0.01f, ServerTraceDebugDrawTime);
+
+	DrawDebugLine(World, Request.CamStart, Request.CamEnd, FColor::Cyan, false, Life, 0, 1.5f);
+	if (Result.bCamHit)
 	{
-		return;
+		DrawDebugPoint(World, Result.CamImpact, 10.f, FColor::Cyan, false, Life);
 	}
 
-	if (!World->IsGameWorld())
+	DrawDebugLine(World, Request.MuzzleStart, Result.MuzzleEnd, Result.bFinalHit ? FColor::Green : FColor::Red, false, Life, 0, 2.5f);
+	if (Result.bFinalHit)
 	{
-		return;
+		DrawDebugPoint(World, Result.FinalImpact, 14.f, FColor::Green, false, Life);
 	}
+#endif
+}
 
-	const float Life = FMath::Max(0.01f, ServerTraceDebugDrawTime);
+bool UMosesCombatComponent::Server_IsZombieTarget(const AActor* TargetActor) const
+{
+	return TargetActor && TargetActor->IsA(AMosesZombieCharacter::StaticClass());
+}
 
-	DrawDebugLine(World, CamStart, CamEnd, FColor::Cyan, false, Life, 0, 1.5f);
-	if (bCamHit)
+void UMosesCombatComponent::AppendCombatResidencyAssets(TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (!DamageGE_SetByCaller.IsNull())
 	{
-		DrawDebugPoint(World, CamImpact, 10.f, FColor::Cyan, false, Life);
+		OutPaths.AddUnique(DamageGE_SetByCaller.ToSoftObjectPath());
 	}
 
-	DrawDebugLine(World, MuzzleStart, MuzzleEnd, bFinalHit ? FColor::Green : FColor::Red, false, Life, 0, 2.5f);
-	if (bFinalHit)
+	if (!AmmoCostGE_SetByCaller.IsNull())
 	{
-		DrawDebugPoint(World, FinalImpact, 14.f, FColor::Green, false, Life);
+		OutPaths.AddUnique(AmmoCostGE_SetByCaller.ToSoftObjectPath());
 	}
-#endif
 }
 
-bool UMosesCombatComponent::Server_IsZombieTarget(const AActor* TargetActor) const
+EMosesHitZone UMosesCombatComponent::Server_ResolveHitZone(const FHitResult& Hit) const
 {
-	return TargetActor && TargetActor->IsA(AMosesZombieCharacter::StaticClass());
+	UMosesHitZoneSubsystem* HitZones = GetWorld() ? GetWorld()->GetSubsystem<UMosesHitZoneSubsystem>() : nullptr;
+	if (!HitZones)
+	{
+		return EMosesHitZone::Body;
+	}
+
+	return HitZones->ClassifyHit(Hit, HeadshotBoneName);
+}
+
+float UMosesCombatComponent::Server_GetHitZoneDamageMultiplier(EMosesHitZone HitZone) const
+{
+	switch (HitZone)
+	{
+	case EMosesHitZone::Head: return HeadshotDamageMultiplier;
+	case EMosesHitZone::Limb: return LimbDamageMultiplier;
+	default: return 1.0f;
+	}
 }
 
 // ============================================================================
-// AutoFire (Server) + Heartbeat (Client -> Server)
+// Fire Command Stream - Local (Client / ListenServer Local)
+// - 로컬 컨트롤러가 샷을 생성(ShotSeq/타임스탬프/조준)하고 최근 N발을 묶어 전송
+// - 서버 AutoFire/Heartbeat 없음: 서버는 받은 샷만 처리하므로 연사 고착이 구조적으로 불가
 // ============================================================================
 
-void UMosesCombatComponent::RequestStartFire()
+bool UMosesCombatComponent::IsLocallyControlledOwner() const
 {
-	UE_LOG(LogTemp, Warning, TEXT("[CC][CL] RequestStartFire"));
-
-	// ✅ 로컬(클라)에서 Heartbeat 시작
-	StartClientFireHeldHeartbeat();
-
-	// ✅ 서버에 연사 시작 요청
-	ServerStartFire();
+	const APawn* Pawn = MosesCombat_Private::GetOwnerPawn(this);
+	return Pawn && Pawn->IsLocallyControlled();
 }
 
-void UMosesCombatComponent::RequestStopFire()
+float UMosesCombatComponent::GetTimeUntilNextShotSec() const
 {
-	UE_LOG(LogTemp, Warning, TEXT("[CC][CL] RequestStopFire"));
+	const UWorld* World = GetWorld();
+	return World ? LocalFireScheduler.GetTimeUntilNextShotSec(World->GetTimeSeconds()) : 0.0f;
+}
 
-	StopClientFireHeldHeartbeat();
-	ServerStopFire();
+float UMosesCombatComponent::GetFireCooldownAlpha() const
+{
+	const UWorld* World = GetWorld();
+	return World ? LocalFireScheduler.GetCooldownAlpha(World->GetTimeSeconds()) : 1.0f;
 }
 
-void UMosesCombatComponent::ServerStartFire_Implementation()
+void UMosesCombatComponent::RequestStartFire()
 {
-	if (!GetOwner() || !GetOwner()->HasAuthority())
+	UWorld* World = GetWorld();
+	if (!World || !IsLocallyControlledOwner() || LocalFireScheduler.IsTriggerHeld())
 	{
 		return;
 	}
 
-	// ✅ 새 연사 세션 토큰 발급 (Stop 이후 남은 tick 무력화)
-	++FireRequestToken;
-	ActiveFireToken = FireRequestToken;
+	// ✅ 무기 interval로 스케줄러 설정 (스왑/리로드 시 Stop되므로 Start마다 갱신)
+	const FMosesWeaponSlotRuntime& Runtime = GetEquippedSlotRuntime();
+	LocalFireScheduler.Configure(Runtime.FireIntervalSec);
+	LocalFireScheduler.Start(World->GetTimeSeconds());
+	LatchShotTimeOffset_Local();
 
-	// 이미 연사 의도 상태라도 “타이머가 꺼져있을 수 있음” -> 아래에서 재보장
-	bWantsToFire = true;
+	SetComponentTickEnabled(true);
 
-	// ✅ 시작 시점 기준점(클라 heartbeat 지연 대비)
-	if (UWorld* World = GetWorld())
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[FIRE][CL] StartFire NextSeq=%u Interval=%.3f Weapon=%s PS=%s"),
+		LocalNextShotSeq, LocalFireScheduler.GetIntervalSec(), *Runtime.WeaponId.ToString(), *GetNameSafe(GetOwner()));
+
+	// ✅ 즉발 1발 (쿨다운이 끝났을 때만)
+	AutoFireTick_Local();
+}
+
+void UMosesCombatComponent::RequestStopFire()
+{
+	if (!LocalFireScheduler.IsTriggerHeld())
 	{
-		LastFireHeldHeartbeatSec = World->GetTimeSeconds();
+		return;
 	}
 
-	// ✅ 현재 무기 interval 캐시
-	FGameplayTag WeaponId;
-	const UMosesWeaponData* WeaponData = Server_ResolveEquippedWeaponData(WeaponId);
-	CachedAutoFireIntervalSec = Server_GetFireIntervalSec_FromWeaponData(WeaponData);
+	StopAutoFire_Local();
 
-	UE_LOG(LogMosesCombat, Warning,
-		TEXT("[FIRE][SV] StartFire Wants=1 Token=%u Interval=%.3f PS=%s"),
-		ActiveFireToken,
-		CachedAutoFireIntervalSec,
-		*GetNameSafe(GetOwner()));
+	// ✅ 마지막 샷 유실 대비: 최근 N발 한 번 더 전송 (서버에서 Seq로 중복 제거)
+	SendRecentShots_Local();
 
-	// ✅ 즉발 1발
-	AutoFireTick_Server();
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[FIRE][CL] StopFire LastSeq=%u Shots=%u PS=%s"),
+		static_cast<uint16>(LocalNextShotSeq - 1), LocalFireScheduler.GetShotCount(), *GetNameSafe(GetOwner()));
+}
 
-	// ✅ 반복 타이머 시작(weapon interval)
-	StartAutoFire_Server(CachedAutoFireIntervalSec);
+void UMosesCombatComponent::StopAutoFire_Local()
+{
+	LocalFireScheduler.Stop();
+	SetComponentTickEnabled(false);
 }
 
-void UMosesCombatComponent::ServerStopFire_Implementation()
+void UMosesCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
-	if (!GetOwner() || !GetOwner()->HasAuthority())
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	AutoFireTick_Local();
+}
+
+bool UMosesCombatComponent::CanEmitShot_Local(int32 ShotsEmittedThisBatch, bool& bOutShouldStop) const
+{
+	bOutShouldStop = false;
+
+	// 복제된 SSOT 기준 소프트 가드 (최종 판정은 서버)
+	EMosesFireGuardFailReason Reason = EMosesFireGuardFailReason::None;
+	FString Debug;
+	if (Server_CanFire(Reason, Debug))
 	{
+		// 같은 배치에서 이미 낸 샷만큼 탄창 차감 (복제 전이라 Mag는 아직 그대로)
+		return GetCurrentMagAmmo() > ShotsEmittedThisBatch;
+	}
+
+	bOutShouldStop = (Reason == EMosesFireGuardFailReason::IsDead || Reason == EMosesFireGuardFailReason::InvalidPhase);
+	return false;
+}
+
+void UMosesCombatComponent::AutoFireTick_Local()
+{
+	UWorld* World = GetWorld();
+	APawn* Pawn = MosesCombat_Private::GetOwnerPawn(this);
+	APlayerController* PC = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+
+	if (!World || !LocalFireScheduler.IsTriggerHeld() || !PC || !PC->IsLocalController())
+	{
+		RequestStopFire();
 		return;
 	}
 
-	bWantsToFire = false;
+	// ✅ Released 씹힘 대응: 실제 입력 상태로 Stop 강제
+	if (!PC->IsInputKeyDown(EKeys::LeftMouseButton))
+	{
+		RequestStopFire();
+		return;
+	}
 
-	// ✅ 토큰 갱신: 이미 큐에 들어간 tick도 무력화
-	++FireRequestToken;
+	// 고정소수점 누산기: 이번 프레임까지 예정된 샷 (프레임레이트 무관)
+	double ShotTimes[FMosesFireScheduler::MaxCatchUpShots];
+	const int32 NumShots = LocalFireScheduler.Advance(World->GetTimeSeconds(), ShotTimes);
+	if (NumShots <= 0)
+	{
+		return;
+	}
 
-	StopAutoFire_Server();
+	// 따라잡기 샷마다 탄약 확인 (탄창을 넘는 예측 샷 방지)
+	// 탄약 없음/리로드 중: 남은 예정 샷은 소비만 하고 버린다 (재개 시 몰아쏘기 방지)
+	int32 NumEmitted = 0;
+	bool bShouldStop = false;
+	for (int32 Index = 0; Index < NumShots; ++Index)
+	{
+		if (!CanEmitShot_Local(NumEmitted, bShouldStop))
+		{
+			break;
+		}
 
-	UE_LOG(LogMosesCombat, Warning,
-		TEXT("[FIRE][SV] StopFire Wants=0 NewToken=%u PS=%s"),
-		FireRequestToken,
-		*GetNameSafe(GetOwner()));
+		EmitShot_Local(ShotTimes[Index]);
+		++NumEmitted;
+	}
+
+	// 배치당 1회 전송 (히치 따라잡기여도 패킷 1개)
+	if (NumEmitted > 0)
+	{
+		SendRecentShots_Local();
+	}
+
+	if (bShouldStop)
+	{
+		RequestStopFire();
+	}
 }
 
-void UMosesCombatComponent::Server_UpdateFireHeldHeartbeat_Implementation()
+void UMosesCombatComponent::LatchShotTimeOffset_Local()
 {
-	if (!GetOwner() || !GetOwner()->HasAuthority())
+	// GameState 서버 시간은 복제될 때마다 흔들린다 → 샷마다 다시 구하면 간격에 지터가 섞임
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GS = World ? World->GetGameState() : nullptr;
+	LocalShotServerTimeOffset = GS ? (GS->GetServerWorldTimeSeconds() - World->GetTimeSeconds()) : 0.0;
+}
+
+void UMosesCombatComponent::EmitShot_Local(double ShotLocalTimeSec)
+{
+	UWorld* World = GetWorld();
+	APawn* Pawn = MosesCombat_Private::GetOwnerPawn(this);
+	AController* Controller = Pawn ? Pawn->GetController() : nullptr;
+	if (!World || !Controller)
 	{
 		return;
 	}
 
-	if (UWorld* World = GetWorld())
+	// 예정 시각(로컬) + 트리거 당김 시 래치한 오프셋 → 샷 간격이 정확히 Interval로 전송됨
+	FMosesFireShotCommand Shot;
+	Shot.ShotSeq = LocalNextShotSeq++;
+	Shot.ClientTimeSec = static_cast<float>(ShotLocalTimeSec + LocalShotServerTimeOffset);
+	Shot.SetAimRotation(Controller->GetControlRotation());
+	Shot.SetSpreadFactor01(CalcSpreadFactor01(Pawn));
+
+	// 링: [0] = 최신
+	for (int32 Index = FMosesFireCommandPacket::MaxRedundantShots - 1; Index > 0; --Index)
 	{
-		LastFireHeldHeartbeatSec = World->GetTimeSeconds();
+		LocalRecentShots[Index] = LocalRecentShots[Index - 1];
 	}
+	LocalRecentShots[0] = Shot;
+	LocalRecentShotCount = FMath::Min(LocalRecentShotCount + 1, FMosesFireCommandPacket::MaxRedundantShots);
+
+	// 발사자 본인 코스메틱: 서버 승인을 기다리지 않는다 (FireBurst는 SkipOwner)
+	if (APlayerCharacter* PlayerChar = Cast<APlayerCharacter>(Pawn))
+	{
+		PlayerChar->PlayFireCosmetics_Local(GetEquippedSlotRuntime().WeaponId);
+	}
+
+	PredictShot_Local(Shot);
 }
 
-void UMosesCombatComponent::StartAutoFire_Server(float IntervalSec)
+void UMosesCombatComponent::PredictShot_Local(const FMosesFireShotCommand& Shot)
 {
-	if (!GetOwner() || !GetOwner()->HasAuthority())
+	UWorld* World = GetWorld();
+	APawn* Pawn = MosesCombat_Private::GetOwnerPawn(this);
+	AController* Controller = Pawn ? Pawn->GetController() : nullptr;
+	if (!World || !Controller)
 	{
 		return;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
+	const FMosesWeaponSlotRuntime& Runtime = GetEquippedSlotRuntime();
+	const UMosesWeaponData* WeaponData = Runtime.WeaponData;
+	if (!WeaponData)
 	{
 		return;
 	}
 
-	// 혹시 남아있는게 있으면 먼저 정리
-	World->GetTimerManager().ClearTimer(AutoFireTimerHandle);
+	if (Runtime.bIsProjectileWeapon)
+	{
+		PredictProjectileLaunch_Local(Shot, WeaponData, Pawn);
+		return;
+	}
 
-	const float TickRate = FMath::Max(0.01f, IntervalSec);
+	FVector ViewLoc;
+	FRotator ViewRot;
+	Controller->GetPlayerViewPoint(ViewLoc, ViewRot);
 
-	World->GetTimerManager().SetTimer(
-		AutoFireTimerHandle,
-		this,
-		&ThisClass::AutoFireTick_Server,
-		TickRate,
-		true,
-		TickRate);
+	// 서버와 같은 입력(Aim/Spread/ShotSeq/LifeSeed) → 같은 스프레드 방향
+	float HalfAngleDeg = 0.0f;
+	const FVector SpreadDir = CalcShotDirection(Shot.GetAimRotation().Vector(), WeaponData, Shot.GetSpreadFactor01(), Shot.ShotSeq, HalfAngleDeg);
 
-	UE_LOG(LogMosesCombat, Verbose,
-		TEXT("[FIRE][SV] AutoFireTimer START Rate=%.3f Token=%u PS=%s"),
-		TickRate, ActiveFireToken, *GetNameSafe(GetOwner()));
-}
+	const APlayerCharacter* OwnerChar = Cast<APlayerCharacter>(Pawn);
+	const FMosesFireOriginCache* FireOrigin = OwnerChar ? &OwnerChar->GetFireOrigin() : nullptr;
 
-void UMosesCombatComponent::StopAutoFire_Server()
-{
-	if (!GetOwner() || !GetOwner()->HasAuthority())
+	FMosesHitscanRequest Request;
+	Request.CamStart = ViewLoc;
+	Request.CamEnd = ViewLoc + (SpreadDir * HitscanDistance);
+	Request.MuzzleStart = Pawn->GetPawnViewLocation();
+	Request.SpreadDir = SpreadDir;
+	Request.TraceChannel = FireTraceChannel;
+
+	if (FireOrigin)
 	{
-		return;
+		FireOrigin->GetMuzzleLocation(Request.MuzzleStart);
+		Request.CamParams = FireOrigin->CamParams;
+		Request.MuzzleParams = FireOrigin->MuzzleParams;
+	}
+	else
+	{
+		FMosesFireOriginCache::BuildTraceParams(Pawn, nullptr, Request.CamParams, Request.MuzzleParams);
 	}
 
-	if (UWorld* World = GetWorld())
+	// 펠릿 샷이면 서버와 같은 패턴 N개 (단일 히트스캔 = SpreadDir 1개)
+	FVector PelletDirs[FMosesSpreadModel::MaxPellets];
+	const int32 NumPellets = CalcPelletDirections(SpreadDir, WeaponData, Shot.ShotSeq, PelletDirs);
+
+	bool bPredictedHit = false;
+	bool bPredictedHeadshot = false;
+
+	for (int32 PelletIndex = 0; PelletIndex < NumPellets; ++PelletIndex)
 	{
-		World->GetTimerManager().ClearTimer(AutoFireTimerHandle);
+		Request.CamEnd = ViewLoc + (PelletDirs[PelletIndex] * HitscanDistance);
+		Request.SpreadDir = PelletDirs[PelletIndex];
+
+		// 예측 전용: Rewind 없음 (클라 화면 = 서버가 Rewind로 재현하려는 시점), 판정은 서버
+		FMosesHitscanTraceResult Result;
+		UMosesHitscanBatchSubsystem::ExecuteTracePair(World, Request, Result);
+
+		// Hit Confirm 예측: 서버 Ack와 같은 기준 (Pawn 히트 + HitZone, 펠릿은 하나라도)
+		const bool bPelletHitPawn = Result.bFinalHit && Cast<APawn>(Result.FinalHit.GetActor());
+		if (bPelletHitPawn)
+		{
+			bPredictedHit = true;
+			bPredictedHeadshot |= (Server_ResolveHitZone(Result.FinalHit) == EMosesHitZone::Head);
+		}
+
+		if (!bPlayLocalShotTracer)
+		{
+			continue;
+		}
+
+		// 월드 표면 임팩트만 로컬 재생 (캐릭터 피격 임팩트는 서버 HitImpact Cue)
+		if (Result.bFinalHit && !bPelletHitPawn)
+		{
+			if (UParticleSystem* ImpactVFX = WeaponData->ImpactVFX.Get())
+			{
+				UGameplayStatics::SpawnEmitterAtLocation(World, ImpactVFX, Result.FinalImpact, Result.FinalHit.ImpactNormal.Rotation(), true);
+			}
+		}
+
+#if ENABLE_DRAW_DEBUG
+		if (LocalTracerDrawTime > 0.0f)
+		{
+			DrawDebugLine(World, Request.MuzzleStart, Result.FinalImpact, FColor::Yellow, false, LocalTracerDrawTime, 0, 1.0f);
+		}
+#endif
 	}
 
-	UE_LOG(LogMosesCombat, Verbose,
-		TEXT("[FIRE][SV] AutoFireTimer STOP PS=%s"),
-		*GetNameSafe(GetOwner()));
+	RecordPredictedShot_Local(Shot.ShotSeq, bPredictedHit, bPredictedHeadshot);
 }
 
-void UMosesCombatComponent::AutoFireTick_Server()
+void UMosesCombatComponent::PredictProjectileLaunch_Local(const FMosesFireShotCommand& Shot, const UMosesWeaponData* WeaponData, APawn* Pawn)
 {
-	if (!GetOwner() || !GetOwner()->HasAuthority())
+	// 리슨 서버 호스트는 권위 스폰이 같은 프레임 → 예측 불필요
+	if (!Pawn || Pawn->HasAuthority())
 	{
 		return;
 	}
 
-	// ✅ Stop 이후 큐에 남은 tick 무력화
-	const uint32 TickToken = ActiveFireToken;
-	if (TickToken != FireRequestToken)
+	UMosesProjectileManagerSubsystem* ProjectileManager = GetWorld()->GetSubsystem<UMosesProjectileManagerSubsystem>();
+	if (!ProjectileManager)
 	{
-		UE_LOG(LogMosesCombat, Verbose,
-			TEXT("[FIRE][SV] AutoFireTick IGNORED by Token Tick=%u Cur=%u PS=%s"),
-			TickToken, FireRequestToken, *GetNameSafe(GetOwner()));
 		return;
 	}
 
-	if (!bWantsToFire)
+	// 서버 Server_PerformFireAndApplyDamage와 같은 입력 (Aim/Spread/ShotSeq/LifeSeed → 같은 방향, Muzzle 캐시)
+	float HalfAngleDeg = 0.0f;
+	const FVector SpreadDir = CalcShotDirection(Shot.GetAimRotation().Vector(), WeaponData, Shot.GetSpreadFactor01(), Shot.ShotSeq, HalfAngleDeg);
+
+	FVector MuzzleStart = Pawn->GetPawnViewLocation();
+	if (const APlayerCharacter* OwnerChar = Cast<APlayerCharacter>(Pawn))
+	{
+		OwnerChar->GetFireOrigin().GetMuzzleLocation(MuzzleStart);
+	}
+
+	ProjectileManager->PredictLaunch_Local(WeaponData, MuzzleStart, SpreadDir, Pawn, Shot.ShotSeq);
+}
+
+void UMosesCombatComponent::SendRecentShots_Local()
+{
+	if (LocalRecentShotCount <= 0)
 	{
-		StopAutoFire_Server();
 		return;
 	}
 
-	// ✅ Heartbeat timeout이면 연사 고착 강제 종료
-	if (UWorld* World = GetWorld())
+	FMosesFireCommandPacket Packet;
+
+	const float NewestTime = LocalRecentShots[0].ClientTimeSec;
+	for (int32 Index = 0; Index < LocalRecentShotCount; ++Index)
 	{
-		const double Now = World->GetTimeSeconds();
-		if ((Now - LastFireHeldHeartbeatSec) > FireHeldHeartbeatTimeoutSec)
+		if (Index > 0 && (NewestTime - LocalRecentShots[Index].ClientTimeSec) > RedundantShotWindowSec)
 		{
-			UE_LOG(LogMosesCombat, Warning,
-				TEXT("[FIRE][SV] AutoFire STOP by HeartbeatTimeout Now=%.3f Last=%.3f Timeout=%.3f PS=%s"),
-				Now, LastFireHeldHeartbeatSec, FireHeldHeartbeatTimeoutSec, *GetNameSafe(GetOwner()));
-
-			bWantsToFire = false;
-			++FireRequestToken; // 잔여 tick 무력화
-			StopAutoFire_Server();
-			return;
+			break;
 		}
+
+		Packet.Shots[Packet.NumShots++] = LocalRecentShots[Index];
 	}
 
-	EMosesFireGuardFailReason Reason = EMosesFireGuardFailReason::None;
-	FString Debug;
-	if (!Server_CanFire(Reason, Debug))
+	// ListenServer 로컬: RPC 없이 바로 처리
+	if (GetOwner() && GetOwner()->HasAuthority())
 	{
-		UE_LOG(LogMosesCombat, Verbose,
-			TEXT("[FIRE][SV] AutoFire STOP by Guard Reason=%d Debug=%s PS=%s"),
-			(int32)Reason, *Debug, *GetNameSafe(GetOwner()));
-
-		bWantsToFire = false;
-		++FireRequestToken;
-		StopAutoFire_Server();
+		Server_ProcessFireCommands(Packet);
 		return;
 	}
 
-	// ✅ 서버면 RPC(ServerFire)로 다시 돌지 말고 Implementation 직접 호출
-	ServerFire_Implementation();
+	ServerFireCommands(Packet);
 }
 
 // ============================================================================
-// Client Heartbeat (Fail-safe)
+// Hit Confirm - Local prediction / reconcile
 // ============================================================================
 
-void UMosesCombatComponent::StartClientFireHeldHeartbeat()
+void UMosesCombatComponent::RecordPredictedShot_Local(uint16 ShotSeq, bool bHit, bool bHeadshot)
 {
-	if (GetNetMode() == NM_DedicatedServer)
+	FPredictedShot& Entry = LocalPredictedShots[ShotSeq % MaxPredictedShots];
+
+	// 이전 샷 Ack가 한 바퀴 돌 때까지 안 왔다 → 유실 (예측 유지)
+	if (Entry.bPending)
 	{
-		return;
+		++LocalHitConfirmStats.AckLost;
+		INC_DWORD_STAT(STAT_MosesHitConfirmAckLost);
 	}
 
-	APawn* Pawn = MosesCombat_Private::GetOwnerPawn(this);
-	if (!Pawn)
+	Entry.ShotSeq = ShotSeq;
+	Entry.bPending = true;
+	Entry.bHit = bHit;
+	Entry.bHeadshot = bHeadshot;
+
+	if (bHit)
 	{
-		return;
+		++LocalHitConfirmStats.PredictedHits;
+		INC_DWORD_STAT(STAT_MosesHitConfirmPredicted);
+
+		OnHitConfirm.Broadcast(EMosesHitConfirm::Predicted, bHeadshot);
 	}
+}
 
-	APlayerController* PC = Cast<APlayerController>(Pawn->GetController());
-	if (!PC || !PC->IsLocalController())
+void UMosesCombatComponent::Client_ShotAcks_Implementation(const FMosesShotAckBatch& Batch)
+{
+	for (int32 Index = 0; Index < Batch.NumAcks; ++Index)
 	{
-		return;
+		ReconcileShotAck_Local(Batch.Acks[Index]);
 	}
+}
 
-	UWorld* World = GetWorld();
-	if (!World)
+void UMosesCombatComponent::ReconcileShotAck_Local(const FMosesShotAck& Ack)
+{
+	// 거절된 Projectile 샷 → 예측 Projectile 폐기 (히트 예측 슬롯과 무관)
+	if (Ack.Result == EMosesShotAckResult::Rejected)
 	{
-		return;
+		if (UMosesProjectileManagerSubsystem* ProjectileManager = GetWorld() ? GetWorld()->GetSubsystem<UMosesProjectileManagerSubsystem>() : nullptr)
+		{
+			ProjectileManager->DiscardPrediction_Local(MosesCombat_Private::GetOwnerPawn(this), Ack.ShotSeq);
+		}
 	}
 
-	if (bClientFireHeldHeartbeatRunning)
+	FPredictedShot& Entry = LocalPredictedShots[Ack.ShotSeq % MaxPredictedShots];
+	if (!Entry.bPending || Entry.ShotSeq != Ack.ShotSeq)
 	{
+		// 예측 없는 샷 (Projectile 등) 또는 이미 덮어쓴 슬롯
 		return;
 	}
 
-	bClientFireHeldHeartbeatRunning = true;
+	Entry.bPending = false;
 
-	World->GetTimerManager().SetTimer(
-		ClientFireHeldHeartbeatHandle,
-		this,
-		&ThisClass::ClientFireHeldHeartbeatTick,
-		FMath::Max(0.01f, ClientFireHeldHeartbeatIntervalSec),
-		true);
+	FMosesHitConfirmStats& Stats = LocalHitConfirmStats;
+	++Stats.AckedShots;
+
+	const bool bServerHit = (Ack.Result == EMosesShotAckResult::Hit || Ack.Result == EMosesShotAckResult::Headshot);
+	const bool bServerHeadshot = (Ack.Result == EMosesShotAckResult::Headshot);
+
+	if (Ack.Result == EMosesShotAckResult::Rejected)
+	{
+		++Stats.Rejected;
+		INC_DWORD_STAT(STAT_MosesHitConfirmRejected);
+	}
+
+	if (Entry.bHit && !bServerHit)
+	{
+		++Stats.FalsePositive;
+		INC_DWORD_STAT(STAT_MosesHitConfirmFalsePositive);
+
+		OnHitConfirm.Broadcast(EMosesHitConfirm::Retracted, false);
+	}
+	else if (!Entry.bHit && bServerHit)
+	{
+		++Stats.FalseNegative;
+		INC_DWORD_STAT(STAT_MosesHitConfirmFalseNegative);
+
+		OnHitConfirm.Broadcast(EMosesHitConfirm::Confirmed, bServerHeadshot);
+	}
+	else if (bServerHit)
+	{
+		++Stats.Confirmed;
+		INC_DWORD_STAT(STAT_MosesHitConfirmConfirmed);
+
+		// 히트는 맞았지만 부위가 다름 → 헤드샷 여부만 보정
+		if (Entry.bHeadshot != bServerHeadshot)
+		{
+			++Stats.HeadshotMismatch;
+			INC_DWORD_STAT(STAT_MosesHitConfirmHeadshotMismatch);
+
+			OnHitConfirm.Broadcast(EMosesHitConfirm::Confirmed, bServerHeadshot);
+		}
+	}
+
+	if ((Stats.AckedShots % FMath::Max(1, HitConfirmLogEveryNShots)) == 0)
+	{
+		UE_LOG(LogMosesCombat, Log,
+			TEXT("[HITCONFIRM][CL] Acked=%d PredHit=%d Confirmed=%d FalsePos=%d FalseNeg=%d HeadMismatch=%d Rejected=%d AckLost=%d Mismatch=%.1f%%"),
+			Stats.AckedShots, Stats.PredictedHits, Stats.Confirmed, Stats.FalsePositive, Stats.FalseNegative,
+			Stats.HeadshotMismatch, Stats.Rejected, Stats.AckLost, Stats.GetMismatchRate() * 100.0f);
+	}
 }
 
-void UMosesCombatComponent::StopClientFireHeldHeartbeat()
+// ============================================================================
+// Hit Confirm - Server ack batch (프레임당 1회 Unreliable)
+// ============================================================================
+
+void UMosesCombatComponent::Server_QueueShotAck(uint16 ShotSeq, EMosesShotAckResult Result)
 {
-	if (GetNetMode() == NM_DedicatedServer)
+	if (!GetOwner() || !GetOwner()->HasAuthority())
 	{
 		return;
 	}
 
-	if (UWorld* World = GetWorld())
+	if (ServerPendingAcks.IsFull())
 	{
-		World->GetTimerManager().ClearTimer(ClientFireHeldHeartbeatHandle);
+		Server_FlushShotAcks();
 	}
 
-	bClientFireHeldHeartbeatRunning = false;
+	FMosesShotAck& Ack = ServerPendingAcks.Acks[ServerPendingAcks.NumAcks++];
+	Ack.ShotSeq = ShotSeq;
+	Ack.Result = Result;
+
+	// HitscanBatch Flush가 같은 프레임 샷을 모두 Resolve한 뒤 한 번에 전송
+	if (!bServerAckFlushScheduled)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			bServerAckFlushScheduled = true;
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &ThisClass::Server_FlushShotAcks));
+		}
+	}
 }
 
-void UMosesCombatComponent::ClientFireHeldHeartbeatTick()
+void UMosesCombatComponent::Server_FlushShotAcks()
 {
-	if (GetNetMode() == NM_DedicatedServer)
+	bServerAckFlushScheduled = false;
+
+	if (ServerPendingAcks.NumAcks == 0)
 	{
-		StopClientFireHeldHeartbeat();
 		return;
 	}
 
-	APawn* Pawn = MosesCombat_Private::GetOwnerPawn(this);
-	APlayerController* PC = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+	Client_ShotAcks(ServerPendingAcks);
+	ServerPendingAcks.NumAcks = 0;
+}
+
+// ============================================================================
+// Fire Command Stream - Server
+// ============================================================================
+
+void UMosesCombatComponent::ServerFireCommands_Implementation(const FMosesFireCommandPacket& Packet)
+{
+	Server_ProcessFireCommands(Packet);
+}
 
-	// Pawn/PC가 깨졌으면 “클라 heartbeat만” 끄고 서버에도 Stop 한번 날림
-	if (!Pawn || !PC || !PC->IsLocalController())
+void UMosesCombatComponent::Server_ProcessFireCommands(const FMosesFireCommandPacket& Packet)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority())
 	{
-		StopClientFireHeldHeartbeat();
-		ServerStopFire(); // ✅ RequestStopFire 재진입 제거
 		return;
 	}
 
-	// ✅ 서버로 heartbeat 전송
-	if (GetOwner() && GetOwner()->HasAuthority())
+	// 오래된 샷 → 최신 샷 순서로 처리 (Shots[0] = 최신)
+	for (int32 Index = Packet.NumShots - 1; Index >= 0; --Index)
 	{
-		// ListenServer 로컬 입력도 서버값 갱신
-		if (UWorld* World = GetWorld())
+		const FMosesFireShotCommand& Shot = Packet.Shots[Index];
+
+		// ✅ 중복 제거: 이미 처리한 Seq는 무시
+		if (bServerHasShotSeq && !MosesFireSeq::IsNewer(Shot.ShotSeq, ServerLastShotSeq))
 		{
-			LastFireHeldHeartbeatSec = World->GetTimeSeconds();
+			continue;
 		}
+
+		ServerLastShotSeq = Shot.ShotSeq;
+		bServerHasShotSeq = true;
+
+		Server_FireShot(Shot);
 	}
-	else
+}
+
+bool UMosesCombatComponent::Server_ValidateShotRate(const FMosesFireShotCommand& Shot, const UMosesWeaponData* WeaponData)
+{
+	UWorld* World = GetWorld();
+	if (!World)
 	{
-		Server_UpdateFireHeldHeartbeat();
+		return false;
 	}
 
-	// ✅ Released 씹힘 대응: 실제 입력 상태로 Stop 강제
-	const bool bMouseDown = PC->IsInputKeyDown(EKeys::LeftMouseButton);
-	if (!bMouseDown)
+	// Slot Runtime Cache 우선 (장착 무기와 일치할 때)
+	const FMosesWeaponSlotRuntime& Runtime = GetEquippedSlotRuntime();
+	const float Interval = (Runtime.WeaponData == WeaponData)
+		? Runtime.FireIntervalSec
+		: Server_GetFireIntervalSec_FromWeaponData(WeaponData);
+	const AGameStateBase* GS = World->GetGameState();
+	const double Now = GS ? GS->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+
+	// 클라 샷 타임스탬프 간격으로 검증 (한 패킷에 묶인 샷도 발사 시각 기준)
+	// - 타임스탬프는 [Now - MaxShotClockAgeSec, Now]로 Clamp → 미래 시각/과거로 몰아 보내기 불가
+	// - 유휴 후 버스트 상한 = MaxShotClockAgeSec 안에 Interval 간격으로 들어가는 샷 수 (느린 무기는 1발)
+	const double ShotTimeSec = FMath::Clamp(static_cast<double>(Shot.ClientTimeSec), Now - MaxShotClockAgeSec, Now);
+
+	if (ServerLastShotTimeSec >= 0.0 && (ShotTimeSec - ServerLastShotTimeSec) < Interval * ShotIntervalTolerance)
 	{
-		StopClientFireHeldHeartbeat();
-		ServerStopFire(); // ✅ RequestStopFire 재진입 제거
+		UE_LOG(LogMosesCombat, Verbose, TEXT("[FIRE][SV] Shot REJECT Rate Seq=%u Gap=%.3f Interval=%.3f PS=%s"),
+			Shot.ShotSeq, ShotTimeSec - ServerLastShotTimeSec, Interval, *GetNameSafe(GetOwner()));
+		return false;
 	}
+
+	ServerLastShotTimeSec = ShotTimeSec;
+	return true;
+}
+
+FRotator UMosesCombatComponent::Server_ResolveShotAim(const FMosesFireShotCommand& Shot, const AController* Controller) const
+{
+	FVector ViewLoc;
+	FRotator ViewRot;
+	Controller->GetPlayerViewPoint(ViewLoc, ViewRot);
+
+	// 클라 조준(발사 시점)을 우선 사용하되, 서버 ControlRotation과 과도하게 다르면 서버 값
+	const FRotator ShotAim = Shot.GetAimRotation();
+	const float CosDeviation = FVector::DotProduct(ShotAim.Vector(), ViewRot.Vector());
+
+	return (CosDeviation >= FMath::Cos(FMath::DegreesToRadians(MaxShotAimDeviationDeg))) ? ShotAim : ViewRot;
+}
+
+float UMosesCombatComponent::Server_ResolveShotSpreadFactor(const FMosesFireShotCommand& Shot, const APawn* OwnerPawn) const
+{
+	// 클라가 예측에 쓴 값을 사용 (속도는 머신마다 다르게 보임 → 서버 재계산 시 트레이서와 어긋남)
+	// 단, 서버 추정치 ± 허용 오차로 Clamp (정지 상태 위조 방지)
+	const float ServerFactor = CalcSpreadFactor01(OwnerPawn);
+	return FMath::Clamp(Shot.GetSpreadFactor01(), ServerFactor - MaxShotSpreadFactorDeviation, ServerFactor + MaxShotSpreadFactorDeviation);
+}
+
+void UMosesCombatComponent::Server_FireShot(const FMosesFireShotCommand& Shot)
+{
+	EMosesFireGuardFailReason Reason = EMosesFireGuardFailReason::None;
+	FString Debug;
+
+	if (!Server_CanFire(Reason, Debug))
+	{
+		Server_QueueShotAck(Shot.ShotSeq, EMosesShotAckResult::Rejected);
+		return;
+	}
+
+	FGameplayTag ApprovedWeaponId;
+	const UMosesWeaponData* WeaponData = Server_ResolveEquippedWeaponData(ApprovedWeaponId);
+	if (!WeaponData)
+	{
+		Server_QueueShotAck(Shot.ShotSeq, EMosesShotAckResult::Rejected);
+		return;
+	}
+
+	if (!Server_ValidateShotRate(Shot, WeaponData))
+	{
+		Server_QueueShotAck(Shot.ShotSeq, EMosesShotAckResult::Rejected);
+		return;
+	}
+
+	// ✅ 여기서부터가 "승인 후" 구간
+	Server_UpdateFireCooldownStamp();
+
+	const bool bAmmoCostApplied = Server_ApplyAmmoCostToSelf_GAS(1.0f, WeaponData);
+	if (!bAmmoCostApplied)
+	{
+		Server_ConsumeAmmo_OnApprovedFire(WeaponData);
+	}
+
+	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON][SV] Fire Weapon=%s Slot=%d Seq=%u Mag=%d Reserve=%d"),
+		*ApprovedWeaponId.ToString(), SlotState.CurrentSlot, Shot.ShotSeq, GetCurrentMagAmmo(), GetCurrentReserveAmmo());
+
+	const APawn* OwnerPawn = MosesCombat_Private::GetOwnerPawn(this);
+	const FRotator AimRot = Server_ResolveShotAim(Shot, OwnerPawn->GetController());
+	const float SpreadFactor = Server_ResolveShotSpreadFactor(Shot, OwnerPawn);
+
+	Server_PerformFireAndApplyDamage(WeaponData, AimRot, SpreadFactor, Shot.ShotSeq);
+
+	// ✅ [MOD] 기존 ApprovedWeaponId -> WeaponData 로 변경
+	Server_PropagateFireCosmetics(WeaponData);
 }
 
 void UMosesCombatComponent::Server_ConsumeAmmo_ManualCost(int32 Cost)
@@ -2300,18 +2698,16 @@ void UMosesCombatComponent::Server_ConsumeAmmo_ManualCost(int32 Cost)
 	int32 Mag = 0;
 	int32 ReserveCur = 0;
 	int32 ReserveMax = 0;
-	GetSlotAmmo_Internal(CurrentSlot, Mag, ReserveCur, ReserveMax);
+	GetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, ReserveCur, ReserveMax);
 
 	const int32 OldMag = Mag;
 
 	Mag = FMath::Max(0, Mag - Cost);
-	SetSlotAmmo_Internal(CurrentSlot, Mag, ReserveCur, ReserveMax);
-
-	BroadcastAmmoChanged(TEXT("Server_ConsumeAmmo_ManualCost"));
+	SetSlotAmmo_Internal(SlotState.CurrentSlot, Mag, ReserveCur, ReserveMax);
 
 	UE_LOG(LogMosesWeapon, Verbose,
 		TEXT("[AMMO][SV] ManualCost Slot=%d Cost=%d Mag %d->%d Reserve=%d/%d PS=%s"),
-		CurrentSlot,
+		SlotState.CurrentSlot,
 		Cost,
 		OldMag,
 		Mag,
@@ -2346,8 +2742,13 @@ bool UMosesCombatComponent::Server_ApplyAmmoCostToSelf_GAS(float AmmoCost, const
 		return false;
 	}
 
-	// Load GE (Soft Reference)
-	TSubclassOf<UGameplayEffect> GEClass = AmmoCostGE_SetByCaller.LoadSynchronous();
+	// GE (Residency Set에서 선로드됨 → 캐시 포인터)
+	if (!CachedAmmoCostGE)
+	{
+		CachedAmmoCostGE = UMosesCombatAssetSubsystem::ResolveClass(this, AmmoCostGE_SetByCaller);
+	}
+
+	TSubclassOf<UGameplayEffect> GEClass = CachedAmmoCostGE;
 	if (!GEClass)
 	{
 		UE_LOG(LogMosesGAS, Warning,
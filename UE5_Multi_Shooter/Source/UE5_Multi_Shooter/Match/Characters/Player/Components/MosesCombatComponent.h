@@ -3,10 +3,12 @@
 // (FULL - UPDATED / CLEAN / COMMENTED)
 // ----------------------------------------------------------------------------
 // [FIX 핵심]
-// - Client FireHeld Heartbeat: PlayerState Owner 패턴에 맞게 Pawn resolve 수정
-// - Heartbeat 타이머 멤버/이름 불일치 제거(컴파일 에러 제거)
-// - ClientTick에서 Server_UpdateFireHeldHeartbeat() 주기적으로 전송
-// - Server AutoFireTick에서 Heartbeat timeout 시 강제 Stop (연사 고착 방지)
+// - Fire Command Stream: 발사 1회당 Reliable RPC 제거
+//   클라가 ShotSeq/타임스탬프/조준을 "최근 N발" 묶음으로 Unreliable 중복 전송
+// - 서버는 ShotSeq 중복 제거 + FireIntervalSec 기반 연사 속도 검증 후 승인
+// - 서버 AutoFire 타이머/Heartbeat 제거 (서버는 받은 샷만 처리 → 연사 고착 불가)
+// - [MOD] 연사 타이밍 = FMosesFireScheduler 하나 (로컬 발사/HUD/GA 공용)
+//   서버 연사 속도 검증 = 클라 샷 타임스탬프 간격 (서버 시계 창으로 Clamp)
 // ============================================================================
 
 #pragma once
@@ -18,6 +20,9 @@
 #include "GameplayEffect.h"
 
 #include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponTypes.h" // EMosesAmmoType
+#include "UE5_Multi_Shooter/Match/Combat/MosesFireCommandTypes.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesFireScheduler.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesSlotStateTypes.h"
 #include "MosesCombatComponent.generated.h"
 
 class UMosesWeaponData;
@@ -25,6 +30,10 @@ class AMosesGrenadeProjectile;
 class UGameplayEffect;
 class AController;
 class APawn;
+enum class EMosesHitZone : uint8;
+class UMosesLagCompensationSubsystem;
+struct FMosesHitscanRequest;
+struct FMosesHitscanTraceResult;
 
 // ============================================================================
 // Delegates (Native Only - UI는 여기만 구독)
@@ -40,6 +49,40 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FMosesOnReloadingChangedNative, bool /*bRelo
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FMosesOnSwapStartedNative, int32 /*FromSlot*/, int32 /*ToSlot*/, int32 /*Serial*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FMosesOnSlotsStateChangedNative, int32 /*ChangedSlotOr0ForAll*/);
 
+// ============================================================================
+// Hit Confirm (Owner Client)
+// - Predicted: 로컬 Trace 히트 → 즉시 히트마커
+// - Confirmed: 예측과 다른 서버 히트 (늦은 히트 / 헤드샷 여부 보정)
+// - Retracted: 예측 히트를 서버가 부정 → 히트마커 취소
+// ============================================================================
+
+enum class EMosesHitConfirm : uint8
+{
+	Predicted,
+	Confirmed,
+	Retracted,
+};
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FMosesOnHitConfirmNative, EMosesHitConfirm /*Type*/, bool /*bHeadshot*/);
+
+/** 예측/확정 불일치 누적 (리와인드/검증 튜닝용) */
+struct FMosesHitConfirmStats
+{
+	int32 AckedShots = 0;
+	int32 PredictedHits = 0;
+	int32 Confirmed = 0;
+	int32 FalsePositive = 0;		// 예측 히트 → 서버 미스/거절
+	int32 FalseNegative = 0;		// 예측 미스 → 서버 히트
+	int32 HeadshotMismatch = 0;
+	int32 Rejected = 0;
+	int32 AckLost = 0;
+
+	float GetMismatchRate() const
+	{
+		return AckedShots > 0 ? static_cast<float>(FalsePositive + FalseNegative + HeadshotMismatch) / static_cast<float>(AckedShots) : 0.0f;
+	}
+};
+
 // ============================================================================
 // Fire Guard Fail Reason
 // ============================================================================
@@ -63,6 +106,36 @@ enum class EMosesFireGuardFailReason : uint8
 	IsDead,
 };
 
+// ============================================================================
+// Slot Runtime Cache
+// - 슬롯 WeaponId가 바뀔 때만 재구성 (OnRep_SlotState Weapon Dirty 비트 / 서버 Set 시)
+// - 발사 경로는 Registry 조회 없이 이 구조체 하나만 읽는다
+// ============================================================================
+
+USTRUCT()
+struct FMosesWeaponSlotRuntime
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<const UMosesWeaponData> WeaponData = nullptr;
+
+	UPROPERTY(Transient)
+	FGameplayTag WeaponId;
+
+	float FireIntervalSec = 0.0f;
+	float SpreadDegreesMin = 0.0f;
+	float SpreadDegreesMax = 0.0f;
+	float SpreadSpeedRef = 600.0f;
+	float Damage = 0.0f;
+
+	int32 MagSize = 0;
+	int32 MaxReserve = 0;
+
+	FName MuzzleSocketName;
+	bool bIsProjectileWeapon = false;
+};
+
 // ============================================================================
 // UMosesCombatComponent (Owner=AMosesPlayerState 가정)
 // ============================================================================
@@ -78,7 +151,7 @@ public:
 	// =========================================================================
 	// SSOT Query
 	// =========================================================================
-	int32 GetCurrentSlot() const { return CurrentSlot; }
+	int32 GetCurrentSlot() const { return SlotState.CurrentSlot; }
 
 	FGameplayTag GetWeaponIdForSlot(int32 SlotIndex) const;
 	FGameplayTag GetEquippedWeaponId() const;
@@ -90,12 +163,18 @@ public:
 	bool IsDead() const { return bIsDead; }
 	bool IsReloading() const { return bIsReloading; }
 
+	/** 현재 장착 슬롯의 Resolve 캐시 (WeaponData/Interval/MuzzleSocket 등) */
+	const FMosesWeaponSlotRuntime& GetEquippedSlotRuntime() const;
+
+	/** 이동 스프레드(0~1): 서버 판정 / 로컬 트레이서 / 크로스헤어 Bloom 공용 */
+	float CalcSpreadFactor01(const APawn* Pawn) const;
+
 	// =========================================================================
 	// Slot Query (UI/코스메틱용)
 	// =========================================================================
-	int32 GetLastSwapFromSlot() const { return LastSwapFromSlot; }
-	int32 GetLastSwapToSlot() const { return LastSwapToSlot; }
-	int32 GetSwapSerial() const { return SwapSerial; }
+	int32 GetLastSwapFromSlot() const { return SlotState.LastSwapFromSlot; }
+	int32 GetLastSwapToSlot() const { return SlotState.LastSwapToSlot; }
+	int32 GetSwapSerial() const { return SlotState.SwapSerial; }
 
 	int32 GetMagAmmoForSlot(int32 SlotIndex) const;
 	int32 GetReserveAmmoForSlot(int32 SlotIndex) const;
@@ -114,42 +193,50 @@ public:
 	// =========================================================================
 	void RequestFire();
 
-	UFUNCTION(Server, Reliable)
-	void ServerFire();
-
 	// =========================================================================
-	// Fire (연사)
+	// Fire (연사) - 로컬 컨트롤러가 샷을 생성해 Command Stream으로 전송
 	// =========================================================================
 	void RequestStartFire();
 	void RequestStopFire();
 
-	UFUNCTION(Server, Reliable)
-	void ServerStartFire();
-
-	UFUNCTION(Server, Reliable)
-	void ServerStopFire();
+	// =========================================================================
+	// Fire Schedule Query (HUD/GA 공용, 로컬 스케줄러 기준)
+	// =========================================================================
+	bool IsFireTriggerHeld() const { return LocalFireScheduler.IsTriggerHeld(); }
+	float GetFireIntervalSec() const { return LocalFireScheduler.GetIntervalSec(); }
+	float GetTimeUntilNextShotSec() const;
+	float GetFireCooldownAlpha() const;
+	const FMosesFireScheduler& GetFireScheduler() const { return LocalFireScheduler; }
 
 	// =========================================================================
-	// Reload
+	// Fire Command Stream (Client -> Server)
+	// - 최근 N발 묶음을 Unreliable로 중복 전송 (유실 시 다음 패킷이 복구)
 	// =========================================================================
-	void RequestReload();
+	UFUNCTION(Server, Unreliable)
+	void ServerFireCommands(const FMosesFireCommandPacket& Packet);
 
-	UFUNCTION(Server, Reliable)
-	void ServerReload();
+	// =========================================================================
+	// Hitscan Batch Resolve (Server only) - MosesHitscanBatchSubsystem Flush에서 호출
+	// =========================================================================
+	void Server_ResolveHitscanResult(const FMosesHitscanRequest& Request, const FMosesHitscanTraceResult& Result);
 
 	// =========================================================================
-	// AutoFire Heartbeat (Client -> Server Fail-safe)
-	// - 클라이언트가 "버튼을 계속 누르고 있다"는 것을 서버에 주기적으로 알림
-	// - 서버는 heartbeat timeout이면 연사 강제 종료
+	// Hit Confirm (Server -> Owner Client)
 	// =========================================================================
-	UFUNCTION(Server, Unreliable)
-	void Server_UpdateFireHeldHeartbeat();
+	UFUNCTION(Client, Unreliable)
+	void Client_ShotAcks(const FMosesShotAckBatch& Batch);
 
-	void StartClientFireHeldHeartbeat();
-	void StopClientFireHeldHeartbeat();
+	FMosesOnHitConfirmNative OnHitConfirm;
 
-	// 타이머에서 호출(클라 전용): (1) 서버로 heartbeat 전송 (2) LMB 업이면 Stop 강제
-	void ClientFireHeldHeartbeatTick();
+	const FMosesHitConfirmStats& GetHitConfirmStats() const { return LocalHitConfirmStats; }
+
+	// =========================================================================
+	// Reload
+	// =========================================================================
+	void RequestReload();
+
+	UFUNCTION(Server, Reliable)
+	void ServerReload();
 
 	// =========================================================================
 	// Default Init / Loadout (Server only)
@@ -188,48 +275,30 @@ public:
 
 	void BroadcastSlotsStateChanged(int32 ChangedSlotOr0ForAll, const TCHAR* ContextTag);
 
+	void Server_ConsumeAmmo_ManualCost(int32 Cost);
+
 	// =========================================================================
-	// Debug
+	// Combat Asset Residency (CDO 기준 수집)
 	// =========================================================================
-	UFUNCTION(NetMulticast, Unreliable)
-	void Multicast_DrawFireTraceDebug(
-		const FVector& CamStart,
-		const FVector& CamEnd,
-		bool bCamHit,
-		const FVector& CamImpact,
-		const FVector& MuzzleStart,
-		const FVector& MuzzleEnd,
-		bool bFinalHit,
-		const FVector& FinalImpact
-	);
-
-	void Server_ConsumeAmmo_ManualCost(int32 Cost);
+	void AppendCombatResidencyAssets(TArray<FSoftObjectPath>& OutPaths) const;
 
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 private:
 	// =========================================================================
 	// RepNotifies
 	// =========================================================================
-	UFUNCTION() void OnRep_CurrentSlot();
-
-	UFUNCTION() void OnRep_Slot1WeaponId();
-	UFUNCTION() void OnRep_Slot2WeaponId();
-	UFUNCTION() void OnRep_Slot3WeaponId();
-	UFUNCTION() void OnRep_Slot4WeaponId();
-
-	UFUNCTION() void OnRep_Slot1Ammo();
-	UFUNCTION() void OnRep_Slot2Ammo();
-	UFUNCTION() void OnRep_Slot3Ammo();
-	UFUNCTION() void OnRep_Slot4Ammo();
+	UFUNCTION() void OnRep_SlotState();
 
 	UFUNCTION() void OnRep_IsDead();
 	UFUNCTION() void OnRep_IsReloading();
 
-	UFUNCTION() void OnRep_SwapSerial();
+	// Slot State 변경 통지 (OnRep_SlotState / 서버 Set 공용, Dirty 비트 단위)
+	void HandleSlotStateChanged(uint8 WeaponSlotMask, uint8 AmmoSlotMask, bool bSwapChanged, bool bCurrentSlotChanged, const TCHAR* ContextTag);
 
 	// =========================================================================
 	// Delegate Emit Helpers
@@ -246,6 +315,9 @@ private:
 	bool IsValidSlotIndex(int32 SlotIndex) const;
 	FGameplayTag GetSlotWeaponIdInternal(int32 SlotIndex) const;
 
+	// Slot Runtime Cache: WeaponId 변경 시 1회 재구성
+	void RebuildSlotRuntime(int32 SlotIndex, const FGameplayTag& WeaponId);
+
 	void Server_SetSlotWeaponId_Internal(int32 SlotIndex, const FGameplayTag& WeaponId);
 
 	void Server_EnsureAmmoInitializedForSlot(int32 SlotIndex, const FGameplayTag& WeaponId);
@@ -265,20 +337,40 @@ private:
 	void Server_ConsumeAmmo_OnApprovedFire(const UMosesWeaponData* WeaponData);
 
 	float Server_GetFireIntervalSec_FromWeaponData(const UMosesWeaponData* WeaponData) const;
-	bool Server_IsFireCooldownReady(const UMosesWeaponData* WeaponData) const;
 	void Server_UpdateFireCooldownStamp();
 
-	void Server_PerformFireAndApplyDamage(const UMosesWeaponData* WeaponData);
+	// Command Stream 처리: 중복 제거 → 속도 검증 → 승인된 샷 실행
+	void Server_ProcessFireCommands(const FMosesFireCommandPacket& Packet);
+	bool Server_ValidateShotRate(const FMosesFireShotCommand& Shot, const UMosesWeaponData* WeaponData);
+	void Server_FireShot(const FMosesFireShotCommand& Shot);
+	FRotator Server_ResolveShotAim(const FMosesFireShotCommand& Shot, const AController* Controller) const;
+	float Server_ResolveShotSpreadFactor(const FMosesFireShotCommand& Shot, const APawn* OwnerPawn) const;
+
+	void Server_PerformFireAndApplyDamage(const UMosesWeaponData* WeaponData, const FRotator& AimRot, float SpreadFactor01, uint16 ShotSeq);
+
+	// (SpreadLifeSeed, ShotSeq) 시드 스프레드 → 서버/클라 같은 방향
+	FVector CalcShotDirection(const FVector& AimDir, const UMosesWeaponData* WeaponData, float SpreadFactor01, uint16 ShotSeq, float& OutHalfAngleDeg) const;
 
-	float Server_CalcSpreadFactor01(const UMosesWeaponData* WeaponData, const APawn* OwnerPawn) const;
-	FVector Server_ApplySpreadToDirection(const FVector& AimDir, const UMosesWeaponData* WeaponData, float SpreadFactor01, float& OutHalfAngleDeg) const;
+	// 펠릿 무기면 CenterDir 기준 펠릿 방향 N개, 아니면 CenterDir 1개
+	int32 CalcPelletDirections(const FVector& CenterDir, const UMosesWeaponData* WeaponData, uint16 ShotSeq, TArrayView<FVector> OutDirs) const;
 
+	// 펠릿 샷: 펠릿 N쌍 Trace 요청 (배치 연속 큐잉 / 동기 폴백)
+	void Server_FirePellets(const FMosesHitscanRequest& BaseRequest, TConstArrayView<FVector> PelletDirs, UMosesLagCompensationSubsystem* LagComp);
+	void Server_AccumulatePelletHit(const FMosesHitscanRequest& Request, const FMosesHitscanTraceResult& Result);
+
+	// 히트 1건 데미지 적용 (좀비 헤드샷 정책 → GAS → ApplyDamage 폴백)
+	void Server_ApplyHitDamage(AActor* TargetActor, float Damage, EMosesHitZone HitZone, const FHitResult& Hit, AController* Controller, APawn* OwnerPawn, const UMosesWeaponData* WeaponData);
+
+	void Server_DrawTraceDebug(const FMosesHitscanRequest& Request, const FMosesHitscanTraceResult& Result) const;
+
+	// ShotSeq = 발사자 클라 예측 Projectile 매칭 키
 	void Server_SpawnGrenadeProjectile(
 		const UMosesWeaponData* WeaponData,
 		const FVector& SpawnLoc,
 		const FVector& FireDir,
 		AController* InstigatorController,
-		APawn* OwnerPawn);
+		APawn* OwnerPawn,
+		uint16 ShotSeq);
 
 	bool Server_ApplyDamageToTarget_GAS(
 		AActor* TargetActor,
@@ -286,7 +378,12 @@ private:
 		AController* InstigatorController,
 		AActor* DamageCauser,
 		const UMosesWeaponData* WeaponData,
-		const FHitResult& Hit) const;
+		const FHitResult& Hit,
+		EMosesHitZone HitZone) const;
+
+	// 히트 부위 분류 (HitZone 레지스트리, 히트당 O(1))
+	EMosesHitZone Server_ResolveHitZone(const FHitResult& Hit) const;
+	float Server_GetHitZoneDamageMultiplier(EMosesHitZone HitZone) const;
 
 	void Server_PropagateFireCosmetics(const UMosesWeaponData* WeaponData);
 
@@ -302,66 +399,35 @@ private:
 	bool Server_IsZombieTarget(const AActor* TargetActor) const;
 
 	// =========================================================================
-	// AutoFire (Server only)
+	// Fire Command Stream (Local only)
 	// =========================================================================
-	void StartAutoFire_Server(float IntervalSec);
-	void StopAutoFire_Server();
-	void AutoFireTick_Server();
+	bool IsLocallyControlledOwner() const;
+	void LatchShotTimeOffset_Local();
+	void EmitShot_Local(double ShotLocalTimeSec);
+	void PredictShot_Local(const FMosesFireShotCommand& Shot);
+
+	// Projectile 무기: 서버와 같은 원점/방향으로 예측 Projectile (ProjectileManager)
+	void PredictProjectileLaunch_Local(const FMosesFireShotCommand& Shot, const UMosesWeaponData* WeaponData, APawn* Pawn);
+
+	// Hit Confirm
+	void RecordPredictedShot_Local(uint16 ShotSeq, bool bHit, bool bHeadshot);
+	void ReconcileShotAck_Local(const FMosesShotAck& Ack);
+	void Server_QueueShotAck(uint16 ShotSeq, EMosesShotAckResult Result);
+	void Server_FlushShotAcks();
+	void SendRecentShots_Local();
+
+	// 트리거 Hold 동안만 컴포넌트 Tick ON → 스케줄러 Advance
+	void StopAutoFire_Local();
+	void AutoFireTick_Local();
+	bool CanEmitShot_Local(int32 ShotsEmittedThisBatch, bool& bOutShouldStop) const;
 
 private:
 	// =========================================================================
 	// Replicated SSOT
 	// =========================================================================
-	UPROPERTY(ReplicatedUsing = OnRep_CurrentSlot)
-	int32 CurrentSlot = 1;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot1WeaponId)
-	FGameplayTag Slot1WeaponId;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot2WeaponId)
-	FGameplayTag Slot2WeaponId;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot3WeaponId)
-	FGameplayTag Slot3WeaponId;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot4WeaponId)
-	FGameplayTag Slot4WeaponId;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot1Ammo)
-	int32 Slot1MagAmmo = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot1Ammo)
-	int32 Slot1ReserveAmmo = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot1Ammo)
-	int32 Slot1ReserveMax = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot2Ammo)
-	int32 Slot2MagAmmo = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot2Ammo)
-	int32 Slot2ReserveAmmo = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot2Ammo)
-	int32 Slot2ReserveMax = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot3Ammo)
-	int32 Slot3MagAmmo = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot3Ammo)
-	int32 Slot3ReserveAmmo = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot3Ammo)
-	int32 Slot3ReserveMax = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot4Ammo)
-	int32 Slot4MagAmmo = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot4Ammo)
-	int32 Slot4ReserveAmmo = 0;
-
-	UPROPERTY(ReplicatedUsing = OnRep_Slot4Ammo)
-	int32 Slot4ReserveMax = 0;
+	// 슬롯 4개 + CurrentSlot + Swap 정보 (Packed, 바뀐 슬롯만 Delta 전송)
+	UPROPERTY(ReplicatedUsing = OnRep_SlotState)
+	FMosesPackedSlotState SlotState;
 
 	UPROPERTY(ReplicatedUsing = OnRep_IsDead)
 	bool bIsDead = false;
@@ -369,14 +435,9 @@ private:
 	UPROPERTY(ReplicatedUsing = OnRep_IsReloading)
 	bool bIsReloading = false;
 
-	UPROPERTY(ReplicatedUsing = OnRep_SwapSerial)
-	int32 SwapSerial = 0;
-
-	UPROPERTY(Replicated)
-	int32 LastSwapFromSlot = 1;
-
+	// 생명 단위 스프레드 시드 (Respawn마다 서버가 재발급)
 	UPROPERTY(Replicated)
-	int32 LastSwapToSlot = 1;
+	uint32 SpreadLifeSeed = 0;
 
 	// =========================================================================
 	// Transient (Server runtime)
@@ -387,6 +448,10 @@ private:
 	UPROPERTY(Transient)
 	double SlotLastFireTimeSec[4] = { -9999.0, -9999.0, -9999.0, -9999.0 };
 
+	// 슬롯별 Resolve 결과 (Index = Slot - 1)
+	UPROPERTY(Transient)
+	FMosesWeaponSlotRuntime SlotRuntime[4];
+
 	FTimerHandle ReloadTimerHandle;
 
 	// =========================================================================
@@ -404,6 +469,10 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire")
 	float HeadshotDamageMultiplier = 2.0f;
 
+	// 팔/다리 (HitZone=Limb) 데미지 배율
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire")
+	float LimbDamageMultiplier = 1.0f;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire")
 	float DefaultFireIntervalSec = 0.05f;
 
@@ -413,12 +482,35 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|GAS")
 	TSoftClassPtr<UGameplayEffect> DamageGE_SetByCaller;
 
+	// Lag Compensation: Hitscan 판정 시 타겟을 슈터 클라 시점으로 되감는다
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|LagComp")
+	bool bEnableLagCompensation = true;
+
+	// Hitscan Trace를 프레임 단위로 모아 일괄 처리 (false면 RPC 처리 중 즉시 Trace)
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire")
+	bool bUseHitscanBatch = true;
+
+	// 최대 되감기 시간 (이보다 높은 핑은 이 값으로 Clamp)
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|LagComp", meta = (ClampMin = "0.0", ClampMax = "0.4"))
+	float MaxLagCompensationSec = 0.25f;
+
+	// RTT 외 추가 보정(클라 보간/스무딩 지연)
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|LagComp", meta = (ClampMin = "0.0"))
+	float LagCompensationExtraSec = 0.0f;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Debug")
 	bool bServerTraceDebugDraw = true;
 
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Debug")
 	float ServerTraceDebugDrawTime = 1.5f;
 
+	// 발사자 로컬 트레이서/임팩트 (서버와 같은 시드 스프레드로 재현)
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Tracer")
+	bool bPlayLocalShotTracer = true;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Tracer", meta = (ClampMin = "0.0"))
+	float LocalTracerDrawTime = 0.1f;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Reload")
 	bool bAutoReloadOnEmpty = true;
 
@@ -426,40 +518,98 @@ private:
 	TSubclassOf<AMosesGrenadeProjectile> GrenadeProjectileClass;
 
 	// =========================================================================
-	// AutoFire (Server runtime)
+	// Fire Command Stream (Local runtime)
 	// =========================================================================
-	FTimerHandle AutoFireTimerHandle;
+	FMosesFireScheduler LocalFireScheduler;
 
-	// “Stop 이후에도 남아있는 Timer tick” 무력화 토큰
-	uint32 FireRequestToken = 0;
-	uint32 ActiveFireToken = 0;
+	uint16 LocalNextShotSeq = 1;
 
-	float CachedAutoFireIntervalSec = 0.12f;
+	// 로컬 시각 → 서버 시간축 오프셋 (트리거 당김마다 1회 래치)
+	double LocalShotServerTimeOffset = 0.0;
 
-	UPROPERTY(Transient)
-	bool bWantsToFire = false;
+	// 최근 N발 링 (Index 0 = 최신)
+	FMosesFireShotCommand LocalRecentShots[FMosesFireCommandPacket::MaxRedundantShots];
+	int32 LocalRecentShotCount = 0;
 
-	// 서버에서 마지막으로 "버튼 유지중" 신호를 받은 시간
-	UPROPERTY(Transient)
-	double LastFireHeldHeartbeatSec = -9999.0;
+	// 이 시간보다 오래된 샷은 중복 전송에서 제외
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Stream")
+	float RedundantShotWindowSec = 0.5f;
 
-	// 서버: heartbeat 끊기면 연사 강제 종료까지 허용 시간
-	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire")
-	float FireHeldHeartbeatTimeoutSec = 0.25f; // 0.2~0.35 추천
+	// =========================================================================
+	// Fire Command Stream (Server runtime)
+	// =========================================================================
+	uint16 ServerLastShotSeq = 0;
+	bool bServerHasShotSeq = false;
 
-	// 클라: 버튼 누르는 동안 heartbeat를 보내는 타이머
-	FTimerHandle ClientFireHeldHeartbeatHandle;
+	// 마지막 승인 샷 시각 (클라 타임스탬프를 서버 시계 창으로 Clamp한 값)
+	double ServerLastShotTimeSec = -1.0;
 
-	// 클라: heartbeat 동작 여부(타이머 active로도 판단 가능하지만, 디버깅용으로 둠)
-	UPROPERTY(Transient)
-	bool bClientFireHeldHeartbeatRunning = false;
+	// 샷 간격이 Interval × 이 값 이상이면 통과 (타임스탬프 ms 양자화/프레임 지터 여유)
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Stream", meta = (ClampMin = "0.5", ClampMax = "1.0"))
+	float ShotIntervalTolerance = 0.9f;
 
-	// 클라: heartbeat 주기(너무 빠를 필요 없음)
-	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire")
-	float ClientFireHeldHeartbeatIntervalSec = 0.05f; // 20Hz
+	// 클라 타임스탬프 허용 창: [서버 Now - 이 값, Now] (유실 복구 지연 여유, 과거로 몰아 보내는 버스트 차단)
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Stream", meta = (ClampMin = "0.05"))
+	float MaxShotClockAgeSec = 0.25f;
+
+	// 클라 조준이 서버 ControlRotation과 이 각도 이상 다르면 서버 값 사용
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Stream")
+	float MaxShotAimDeviationDeg = 15.0f;
+
+	// 클라 스프레드(0~1)를 서버 이동 속도 추정치 ± 이 값으로 Clamp (속도 복제 지연 여유)
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|Stream", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MaxShotSpreadFactorDeviation = 0.25f;
+
+	// 펠릿 샷 Resolve 누적 (같은 ShotSeq 연속 요청 → 마지막 펠릿에서 타겟별 GE 1회)
+	struct FServerPelletHit
+	{
+		TWeakObjectPtr<AActor> Target;
+
+		// 몸통/팔다리 펠릿 (대표 Hit = 첫 펠릿)
+		FHitResult BodyHit;
+		EMosesHitZone BodyZone{}; // 첫 몸통 펠릿에서 설정
+		float BodyDamage = 0.0f;
+		int32 NumBodyPellets = 0;
+
+		// 헤드 펠릿 (대표 Hit = 첫 헤드 펠릿)
+		FHitResult HeadHit;
+		float HeadDamage = 0.0f;
+		int32 NumHeadPellets = 0;
+	};
+
+	TArray<FServerPelletHit, TInlineAllocator<4>> ServerPelletHits;
+	uint16 ServerPelletShotSeq = 0;
+
+	// =========================================================================
+	// Hit Confirm (Local prediction / Server ack batch)
+	// =========================================================================
+	struct FPredictedShot
+	{
+		uint16 ShotSeq = 0;
+		bool bPending = false;
+		bool bHit = false;
+		bool bHeadshot = false;
+	};
+
+	// ShotSeq % N 슬롯 (덮어쓸 때 아직 Pending이면 Ack 유실)
+	static constexpr int32 MaxPredictedShots = 32;
+	FPredictedShot LocalPredictedShots[MaxPredictedShots];
+
+	FMosesHitConfirmStats LocalHitConfirmStats;
+
+	// 이 발수마다 불일치율 로그
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire|HitConfirm", meta = (ClampMin = "1"))
+	int32 HitConfirmLogEveryNShots = 50;
+
+	FMosesShotAckBatch ServerPendingAcks;
+	bool bServerAckFlushScheduled = false;
 
 	bool Server_ApplyAmmoCostToSelf_GAS(float AmmoCost, const class UMosesWeaponData* WeaponData) const;
 
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|GAS")
 	TSoftClassPtr<UGameplayEffect> AmmoCostGE_SetByCaller;
+
+	// GE 클래스 캐시 (CombatAssetSubsystem이 Pin → 첫 Resolve 이후 포인터 읽기만)
+	mutable TSubclassOf<UGameplayEffect> CachedDamageGE;
+	mutable TSubclassOf<UGameplayEffect> CachedAmmoCostGE;
 };
@@ -15,10 +15,14 @@
 #include "UE5_Multi_Shooter/System/MosesAuthorityGuards.h"
 #include "UE5_Multi_Shooter/MosesLogChannels.h"
 #include "UE5_Multi_Shooter/Camera/MosesCameraComponent.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesLagCompensationSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesHitZoneSubsystem.h"
 
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/SkeletalMeshSocket.h"
 
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimMontage.h"
@@ -203,6 +207,22 @@ void APlayerCharacter::BeginPlay()
 	{
 		ApplyAttachmentPlan_Immediate(CachedCombatComponent->GetCurrentSlot());
 	}
+
+	// [ADD] Lag Compensation 히트볼륨 등록(서버): 캡슐 + 메시 + HeadHitBox
+	if (HasAuthority())
+	{
+		if (UMosesLagCompensationSubsystem* LagComp = GetWorld() ? GetWorld()->GetSubsystem<UMosesLagCompensationSubsystem>() : nullptr)
+		{
+			LagComp->RegisterTarget_Server(this, GetCapsuleComponent(), GetMesh(), HeadHitBox);
+		}
+	}
+
+	// [MOD] HitZone 등록(모든 NetMode): 클라 예측 분류도 HeadHitBox = Head로 판정
+	if (UMosesHitZoneSubsystem* HitZones = GetWorld() ? GetWorld()->GetSubsystem<UMosesHitZoneSubsystem>() : nullptr)
+	{
+		HitZones->RegisterComponentZone(HeadHitBox, EMosesHitZone::Head);
+		HitZones->RegisterTaggedComponents(this);
+	}
 }
 
 void APlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -210,6 +230,19 @@ void APlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	StopAutoFire_Local();
 	UnbindCombatComponent();
 
+	if (HasAuthority())
+	{
+		if (UMosesLagCompensationSubsystem* LagComp = GetWorld() ? GetWorld()->GetSubsystem<UMosesLagCompensationSubsystem>() : nullptr)
+		{
+			LagComp->UnregisterTarget_Server(this);
+		}
+	}
+
+	if (UMosesHitZoneSubsystem* HitZones = GetWorld() ? GetWorld()->GetSubsystem<UMosesHitZoneSubsystem>() : nullptr)
+	{
+		HitZones->UnregisterActor(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -236,6 +269,9 @@ void APlayerCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(APlayerCharacter, bIsSprinting);
+
+	// 발사자 본인은 로컬 즉시 재생 → 자기 자신에게는 보내지 않는다
+	DOREPLIFETIME_CONDITION(APlayerCharacter, FireBurst, COND_SkipOwner);
 }
 
 // ============================================================================
@@ -493,64 +529,11 @@ void APlayerCharacter::Input_FireReleased()
 	GAS_InputReleased(FireInputID);
 }
 
-void APlayerCharacter::StartAutoFire_Local()
-{
-	APlayerController* PC = GetController<APlayerController>();
-	if (!PC || !PC->IsLocalController())
-	{
-		UE_LOG(LogMosesCombat, Warning, TEXT("[FIRE][CL] AutoFire START blocked (NotLocal) Pawn=%s"), *GetNameSafe(this));
-		return;
-	}
-
-	if (GetWorldTimerManager().IsTimerActive(AutoFireTimerHandle))
-	{
-		return;
-	}
-
-	GetWorldTimerManager().SetTimer(
-		AutoFireTimerHandle,
-		this,
-		&ThisClass::HandleAutoFireTick_Local,
-		AutoFireTickRate,
-		true,
-		AutoFireTickRate);
-
-	UE_LOG(LogMosesCombat, Warning, TEXT("[FIRE][CL] AutoFire START OK Rate=%.3f Pawn=%s"),
-		AutoFireTickRate,
-		*GetNameSafe(this));
-}
-
 void APlayerCharacter::StopAutoFire_Local()
 {
-	bFireHeldLocal = false;
-	GetWorldTimerManager().ClearTimer(AutoFireTimerHandle);
-
-	UE_LOG(LogMosesCombat, Warning, TEXT("[FIRE][CL] AutoFire STOP OK Pawn=%s"), *GetNameSafe(this));
-}
-
-void APlayerCharacter::HandleAutoFireTick_Local()
-{
-	APlayerController* PC = GetController<APlayerController>();
-	if (!PC || !PC->IsLocalController())
-	{
-		StopAutoFire_Local();
-		return;
-	}
-
-	if (!bFireHeldLocal)
-	{
-		return;
-	}
-
-	if (CachedCombatComponent && CachedCombatComponent->IsDead())
-	{
-		StopAutoFire_Local();
-		return;
-	}
-
-	if (UMosesCombatComponent* CombatComp = GetCombatComponent_Checked())
+	if (CachedCombatComponent)
 	{
-		CombatComp->RequestFire();
+		CachedCombatComponent->RequestStopFire();
 	}
 }
 
@@ -689,6 +672,7 @@ void APlayerCharacter::BindCombatComponent()
 	UnbindCombatComponent();
 
 	CachedCombatComponent = NewComp;
+	InvalidateFireOrigin();
 
 	CachedCombatComponent->OnEquippedChanged.AddUObject(this, &APlayerCharacter::HandleEquippedChanged);
 	CachedCombatComponent->OnDeadChanged.AddUObject(this, &APlayerCharacter::HandleDeadChanged);
@@ -748,6 +732,7 @@ void APlayerCharacter::HandleEquippedChanged(int32 SlotIndex, FGameplayTag Weapo
 		*GetNameSafe(this));
 
 	RefreshAllWeaponMeshes_FromSSOT();
+	InvalidateFireOrigin();
 
 	// 스왑 몽타주 중에는 Notify가 Attach 교체를 담당하므로 중간 덮어쓰기 금지
 	if (!bSwapInProgress && CachedCombatComponent)
@@ -1001,12 +986,21 @@ void APlayerCharacter::RefreshAllWeaponMeshes_FromSSOT()
 		CacheSlotMeshMapping();
 	}
 
+	// Fire Origin이 가리키는 메시의 에셋이 바뀌면 머즐 소켓도 바뀜 → 무효화
+	const USkeletalMeshComponent* FireOriginMesh = FireOriginCache.WeaponMesh.Get();
+	const USkeletalMesh* PrevFireOriginAsset = FireOriginMesh ? FireOriginMesh->GetSkeletalMeshAsset() : nullptr;
+
 	for (int32 Slot = 1; Slot <= 4; ++Slot)
 	{
 		const FGameplayTag WeaponId = CachedCombatComponent->GetWeaponIdForSlot(Slot);
 		USkeletalMeshComponent* TargetComp = GetMeshCompForSlot(Slot);
 		RefreshWeaponMesh_ForSlot(Slot, WeaponId, TargetComp);
 	}
+
+	if (FireOriginMesh && FireOriginMesh->GetSkeletalMeshAsset() != PrevFireOriginAsset)
+	{
+		InvalidateFireOrigin();
+	}
 }
 
 void APlayerCharacter::RefreshWeaponMesh_ForSlot(int32 SlotIndex, FGameplayTag WeaponId, USkeletalMeshComponent* TargetMeshComp)
@@ -1117,6 +1111,101 @@ void APlayerCharacter::ApplyAttachmentPlan_Immediate(int32 EquippedSlot)
 		*GetNameSafe(this));
 }
 
+// ============================================================================
+// Fire Origin Cache
+// ============================================================================
+
+bool FMosesFireOriginCache::GetMuzzleLocation(FVector& OutLocation) const
+{
+	const USkeletalMeshComponent* Mesh = WeaponMesh.Get();
+	if (!Mesh || MuzzleBoneIndex == INDEX_NONE)
+	{
+		if (const APawn* Pawn = FallbackPawn.Get())
+		{
+			OutLocation = Pawn->GetPawnViewLocation();
+		}
+		return false;
+	}
+
+	OutLocation = (MuzzleLocalTransform * Mesh->GetBoneTransform(MuzzleBoneIndex)).GetLocation();
+	return true;
+}
+
+void FMosesFireOriginCache::BuildTraceParams(const APawn* Pawn, USkeletalMeshComponent* InWeaponMesh, FCollisionQueryParams& OutCamParams, FCollisionQueryParams& OutMuzzleParams)
+{
+	OutCamParams = FCollisionQueryParams(SCENE_QUERY_STAT(Moses_FireTrace_Cam), true);
+	OutMuzzleParams = FCollisionQueryParams(SCENE_QUERY_STAT(Moses_FireTrace_Muzzle), true);
+
+	if (!Pawn)
+	{
+		return;
+	}
+
+	OutCamParams.AddIgnoredActor(Pawn);
+	OutMuzzleParams.AddIgnoredActor(Pawn);
+
+	const ACharacter* Char = Cast<ACharacter>(Pawn);
+	USkeletalMeshComponent* BodyMesh = Char ? Char->GetMesh() : Pawn->FindComponentByClass<USkeletalMeshComponent>();
+	if (BodyMesh)
+	{
+		OutCamParams.AddIgnoredComponent(BodyMesh);
+		OutMuzzleParams.AddIgnoredComponent(BodyMesh);
+	}
+
+	if (InWeaponMesh)
+	{
+		OutMuzzleParams.AddIgnoredComponent(InWeaponMesh);
+	}
+}
+
+const FMosesFireOriginCache& APlayerCharacter::GetFireOrigin() const
+{
+	// 메시 없는 폴백도 캐시 → 재구성은 무효화(장착/스왑/메시 교체) 또는 캐시한 메시가 사라졌을 때만
+	if (bFireOriginDirty || (FireOriginCache.bHasWeaponMesh && !FireOriginCache.WeaponMesh.IsValid()))
+	{
+		RebuildFireOrigin();
+	}
+
+	return FireOriginCache;
+}
+
+void APlayerCharacter::RebuildFireOrigin() const
+{
+	bFireOriginDirty = false;
+
+	FireOriginCache.MuzzleBoneIndex = INDEX_NONE;
+	FireOriginCache.MuzzleLocalTransform = FTransform::Identity;
+
+	// 손 소켓에 붙는 컴포넌트 = 현재 장착 슬롯의 메시 (슬롯 1 고정 아님)
+	const int32 EquippedSlot = CachedCombatComponent ? CachedCombatComponent->GetCurrentSlot() : 1;
+	USkeletalMeshComponent* HandComp = GetMeshCompForSlot(EquippedSlot);
+	FireOriginCache.WeaponMesh = HandComp;
+	FireOriginCache.bHasWeaponMesh = (HandComp != nullptr);
+	FireOriginCache.FallbackPawn = this;
+
+	FMosesFireOriginCache::BuildTraceParams(this, HandComp, FireOriginCache.CamParams, FireOriginCache.MuzzleParams);
+
+	const FName MuzzleSocketName = CachedCombatComponent ? CachedCombatComponent->GetEquippedSlotRuntime().MuzzleSocketName : NAME_None;
+	if (!HandComp || MuzzleSocketName.IsNone())
+	{
+		return;
+	}
+
+	const USkeletalMeshSocket* Socket = HandComp->GetSocketByName(MuzzleSocketName);
+	if (!Socket)
+	{
+		UE_LOG(LogMosesWeapon, Verbose, TEXT("[WEAPON][FireOrigin] Muzzle socket missing Socket=%s Mesh=%s Pawn=%s"),
+			*MuzzleSocketName.ToString(), *GetNameSafe(HandComp->GetSkeletalMeshAsset()), *GetNameSafe(this));
+		return;
+	}
+
+	FireOriginCache.MuzzleBoneIndex = HandComp->GetBoneIndex(Socket->BoneName);
+	FireOriginCache.MuzzleLocalTransform = Socket->GetSocketLocalTransform();
+
+	UE_LOG(LogMosesWeapon, Verbose, TEXT("[WEAPON][FireOrigin] Rebuild Slot=%d Socket=%s BoneIndex=%d Pawn=%s"),
+		EquippedSlot, *MuzzleSocketName.ToString(), FireOriginCache.MuzzleBoneIndex, *GetNameSafe(this));
+}
+
 // ============================================================================
 // Swap runtime (Cosmetic only)
 // ============================================================================
@@ -1241,6 +1330,7 @@ void APlayerCharacter::HandleSwapAttachNotify()
 	}
 
 	ToComp->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, GetHandSocketName());
+	InvalidateFireOrigin();
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[SWAP][COS][ATTACH] ToSlot=%d -> HandSocket=%s Pawn=%s"),
 		ToSlot,
@@ -1426,7 +1516,53 @@ void APlayerCharacter::ApplyDeadCosmetics_Local() const
 	}
 }
 
-void APlayerCharacter::Multicast_PlayFireMontage_Implementation(FGameplayTag WeaponId)
+// ============================================================================
+// Fire Burst - 샷당 RPC 대신 복제 카운터
+// ============================================================================
+
+void APlayerCharacter::Server_NotifyFired(const FGameplayTag& WeaponId)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	const UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr;
+
+	// ForceNetUpdate 하지 않음: 다음 NetUpdate에 몰아서 1회 전송
+	FireBurst.Counter++;
+	FireBurst.WeaponIndex = Registry ? Registry->GetWeaponNetIndex(WeaponId) : 0;
+
+	// ListenServer 호스트 화면: 원격 플레이어 샷은 OnRep가 없으므로 직접 재생
+	if (GetNetMode() == NM_ListenServer && !IsLocallyControlled())
+	{
+		PlayFireCosmetics_Local(WeaponId);
+	}
+}
+
+void APlayerCharacter::OnRep_FireBurst()
+{
+	// 최초 Relevancy 진입 시 스냅샷은 재생하지 않는다 (과거 샷)
+	if (!HasActorBegunPlay())
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	const UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr;
+	if (!Registry)
+	{
+		return;
+	}
+
+	// NetUpdate 사이 여러 발이 하나로 합쳐져도 1회 재생 (몽타주는 어차피 재시작)
+	PlayFireCosmetics_Local(Registry->GetWeaponIdByNetIndex(FireBurst.WeaponIndex));
+}
+
+void APlayerCharacter::PlayFireCosmetics_Local(const FGameplayTag& WeaponId)
 {
 	if (GetNetMode() == NM_DedicatedServer)
 	{
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Components/SphereComponent.h"
+#include "CollisionQueryParams.h"
 #include "UE5_Multi_Shooter/Match/Characters/Player/MosesCharacter.h"
 #include "PlayerCharacter.generated.h"
 
@@ -21,6 +22,54 @@ class UAbilitySystemComponent;
 class USkeletalMeshComponent;
 class UAnimMontage;
 
+// ============================================================================
+// Fire Origin Cache
+// - 서버 Fire Trace가 매 샷 읽는 시작점/무시 목록
+// - Equip/Swap 시에만 무효화 → 샷당 컴포넌트 스캔/소켓 검색 없음
+// ============================================================================
+
+struct FMosesFireOriginCache
+{
+	/** 손 소켓에 붙은 현재 장착 무기 메시 */
+	TWeakObjectPtr<USkeletalMeshComponent> WeaponMesh;
+	bool bHasWeaponMesh = false;
+
+	/** 무기 메시/머즐 소켓이 없을 때 시작점 = 이 Pawn의 시점 위치 (폴백도 캐시) */
+	TWeakObjectPtr<const APawn> FallbackPawn;
+
+	/** 머즐 소켓 = 부모 본 인덱스 + 로컬 트랜스폼 (INDEX_NONE이면 머즐 없음) */
+	int32 MuzzleBoneIndex = INDEX_NONE;
+	FTransform MuzzleLocalTransform = FTransform::Identity;
+
+	FCollisionQueryParams CamParams;
+	FCollisionQueryParams MuzzleParams;
+
+	/** 머즐 소켓 위치, 없으면 FallbackPawn 시점 위치. @return 머즐 소켓을 썼으면 true */
+	bool GetMuzzleLocation(FVector& OutLocation) const;
+
+	/** Cam: Pawn + 캐릭터 메시 무시 / Muzzle: + 무기 메시 무시 */
+	static void BuildTraceParams(const APawn* Pawn, USkeletalMeshComponent* InWeaponMesh, FCollisionQueryParams& OutCamParams, FCollisionQueryParams& OutMuzzleParams);
+};
+
+// ============================================================================
+// Fire Burst (Server -> Simulated Proxy)
+// - 승인된 샷마다 Counter++ (WeaponIndex = Registry NetIndex)
+// - 시뮬 프록시는 OnRep에서 몽타주/머즐/사운드를 파생 재생
+//   → 코스메틱 트래픽 = 연사 속도가 아니라 NetUpdateFrequency, Relevancy 컬링 자동
+// ============================================================================
+
+USTRUCT()
+struct FMosesFireBurst
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint8 Counter = 0;
+
+	UPROPERTY()
+	uint8 WeaponIndex = 0;
+};
+
 UCLASS()
 class UE5_MULTI_SHOOTER_API APlayerCharacter : public AMosesCharacter
 {
@@ -61,6 +110,16 @@ public:
 
 	USphereComponent* GetHeadHitBox() const { return HeadHitBox; }
 
+	// Fire Origin (서버 Fire Trace용, 무효화 상태면 1회 재구성)
+	const FMosesFireOriginCache& GetFireOrigin() const;
+	void InvalidateFireOrigin() { bFireOriginDirty = true; }
+
+	// Fire Cosmetics
+	// - Server: 승인된 샷마다 Burst Counter 증가 (RPC 없음)
+	// - Local: 발사자 본인은 입력 시점에 즉시 재생 (Burst는 SkipOwner)
+	void Server_NotifyFired(const FGameplayTag& WeaponId);
+	void PlayFireCosmetics_Local(const FGameplayTag& WeaponId);
+
 protected:
 	// Engine
 	virtual void BeginPlay() override;
@@ -78,9 +137,6 @@ protected:
 
 public:
 	// Cosmetics (server -> multicast)
-	UFUNCTION(NetMulticast, Unreliable)
-	void Multicast_PlayFireMontage(FGameplayTag WeaponId);
-
 	UFUNCTION(NetMulticast, Unreliable)
 	void Multicast_PlayHitReactMontage();
 
@@ -102,6 +158,9 @@ private:
 	UFUNCTION()
 	void OnRep_IsSprinting();
 
+	UFUNCTION()
+	void OnRep_FireBurst();
+
 	UFUNCTION(NetMulticast, Unreliable)
 	void Multicast_PlaySprintMontage(bool bStart);
 
@@ -149,10 +208,8 @@ private:
 	void ApplyDeadCosmetics_Local() const;
 
 private:
-	// Hold-to-fire (Local only)
-	void StartAutoFire_Local();
+	// Hold-to-fire (Local only) - 연사 타이밍은 CombatComponent FireScheduler 단일 소스
 	void StopAutoFire_Local();
-	void HandleAutoFireTick_Local();
 
 private:
 	UAbilitySystemComponent* ResolveASC_FromPlayerState() const;
@@ -230,6 +287,9 @@ private:
 	UPROPERTY(ReplicatedUsing = OnRep_IsSprinting)
 	bool bIsSprinting = false;
 
+	UPROPERTY(ReplicatedUsing = OnRep_FireBurst)
+	FMosesFireBurst FireBurst;
+
 	UPROPERTY(Transient)
 	bool bLocalPredictedSprinting = false;
 
@@ -244,16 +304,6 @@ private:
 	UPROPERTY(Transient)
 	FVector2D LastMoveInputLocal = FVector2D::ZeroVector;
 
-private:
-	// Hold-to-fire runtime
-	UPROPERTY(Transient)
-	bool bFireHeldLocal = false;
-
-	FTimerHandle AutoFireTimerHandle;
-
-	UPROPERTY(EditDefaultsOnly, Category = "Moses|Fire")
-	float AutoFireTickRate = 0.06f;
-
 private:
 	// Swap runtime (Cosmetic only)
 	UPROPERTY(Transient)
@@ -280,6 +330,13 @@ private:
 	UPROPERTY(Transient)
 	bool bSwapAttachDone = false;
 
+private:
+	// Fire Origin runtime (Equip/Swap 시 무효화)
+	void RebuildFireOrigin() const;
+
+	mutable FMosesFireOriginCache FireOriginCache;
+	mutable bool bFireOriginDirty = true;
+
 private:
 	// Headshot 판정용 HitBox (Head 소켓에 부착)
 	UPROPERTY(VisibleAnywhere, Category = "Moses|HitBox")
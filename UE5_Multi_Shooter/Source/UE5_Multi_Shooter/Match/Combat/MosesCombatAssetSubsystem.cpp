@@ -0,0 +1,140 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesCombatAssetSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesCombatAssetSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/MosesPlayerState.h"
+#include "UE5_Multi_Shooter/Match/GameState/MosesMatchGameState.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+void UMosesCombatAssetSubsystem::Deinitialize()
+{
+	if (ResidencyHandle.IsValid())
+	{
+		ResidencyHandle->CancelHandle();
+		ResidencyHandle.Reset();
+	}
+
+	PinnedAssets.Reset();
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// Residency
+// ============================================================================
+
+void UMosesCombatAssetSubsystem::CollectResidencyPaths(const UWorld* World, TArray<FSoftObjectPath>& OutPaths) const
+{
+	// 서버만 GE를 적용한다 (클라는 GameMode 없음 → 수집 0)
+	const AGameModeBase* GM = World ? World->GetAuthGameMode() : nullptr;
+	if (!GM || !GM->PlayerStateClass)
+	{
+		return;
+	}
+
+	if (const AMosesPlayerState* PSCDO = Cast<AMosesPlayerState>(GM->PlayerStateClass->GetDefaultObject()))
+	{
+		PSCDO->AppendCombatResidencyAssets(OutPaths);
+	}
+}
+
+void UMosesCombatAssetSubsystem::RequestResidency(const UWorld* World, FSimpleDelegate OnComplete)
+{
+	TArray<FSoftObjectPath> Paths;
+	CollectResidencyPaths(World, Paths);
+
+	if (Paths.Num() == 0)
+	{
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	UE_LOG(LogMosesCombat, Log, TEXT("[ASSET][SV] CombatResidency Request Count=%d"), Paths.Num());
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+
+	TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(Paths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	if (!Handle.IsValid())
+	{
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	ResidencyHandle = Handle;
+
+	// 이미 모두 메모리에 있으면 즉시 완료
+	if (Handle->HasLoadCompleted())
+	{
+		OnResidencyLoaded(Handle, OnComplete);
+		return;
+	}
+
+	Handle->BindCompleteDelegate(FStreamableDelegate::CreateUObject(this, &ThisClass::OnResidencyLoaded, Handle, OnComplete));
+}
+
+void UMosesCombatAssetSubsystem::OnResidencyLoaded(TSharedPtr<FStreamableHandle> Handle, FSimpleDelegate OnComplete)
+{
+	if (Handle.IsValid())
+	{
+		TArray<UObject*> Loaded;
+		Handle->GetLoadedAssets(Loaded);
+
+		for (UObject* Asset : Loaded)
+		{
+			if (Asset)
+			{
+				PinnedAssets.Add(Asset);
+			}
+		}
+
+		UE_LOG(LogMosesCombat, Log, TEXT("[ASSET][SV] CombatResidency Loaded Count=%d Pinned=%d"), Loaded.Num(), PinnedAssets.Num());
+	}
+
+	OnComplete.ExecuteIfBound();
+}
+
+// ============================================================================
+// Hot Path (SyncLoad fallback)
+// ============================================================================
+
+void UMosesCombatAssetSubsystem::NoteSyncLoad(const UObject* WorldContext, const FSoftObjectPath& Path, UObject* Loaded)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	UMosesCombatAssetSubsystem* Self = GI ? GI->GetSubsystem<UMosesCombatAssetSubsystem>() : nullptr;
+	if (!Self)
+	{
+		return;
+	}
+
+	// 다음부터는 상주 (포인터 캐싱 대상이 GC되지 않도록)
+	if (Loaded)
+	{
+		Self->PinnedAssets.Add(Loaded);
+	}
+
+	++Self->SyncLoadCount;
+
+	const AMosesMatchGameState* GS = World->GetGameState<AMosesMatchGameState>();
+	if (GS && GS->GetMatchPhase() == EMosesMatchPhase::Combat)
+	{
+		++Self->CombatPhaseSyncLoadCount;
+
+		UE_LOG(LogMosesCombat, Warning, TEXT("[ASSET][SV] SyncLoad during Combat Count=%d Path=%s (Missing from residency set)"),
+			Self->CombatPhaseSyncLoadCount, *Path.ToString());
+		return;
+	}
+
+	UE_LOG(LogMosesCombat, Log, TEXT("[ASSET][SV] SyncLoad Count=%d Path=%s"), Self->SyncLoadCount, *Path.ToString());
+}
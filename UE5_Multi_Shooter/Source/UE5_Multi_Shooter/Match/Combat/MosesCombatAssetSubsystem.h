@@ -0,0 +1,82 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesCombatAssetSubsystem.h
+// ----------------------------------------------------------------------------
+// Combat Asset Residency Set (Server)
+// - 전투 중 사용되는 GE 클래스(Damage Player/Zombie, AmmoCost, ShieldRegen 등)를
+//   Experience 로딩 단계에서 비동기 로드 + Pin (GC/Evict 방지)
+// - Hot Path는 ResolveClass()로 이미 상주한 클래스 포인터만 읽는다
+// - 상주하지 않아 SyncLoad가 발생하면 카운트 + Combat 페이즈면 경고
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "MosesCombatAssetSubsystem.generated.h"
+
+class UWorld;
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesCombatAssetSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// =========================================================================
+	// Residency (Experience 로딩 단계)
+	// =========================================================================
+
+	/**
+	 * 현재 월드(서버) 기준 Residency Set 수집 → 비동기 로드 → Pin 후 OnComplete.
+	 * - 수집할 것이 없거나 이미 모두 상주하면 즉시 OnComplete
+	 */
+	void RequestResidency(const UWorld* World, FSimpleDelegate OnComplete);
+
+	// =========================================================================
+	// Hot Path
+	// =========================================================================
+
+	/** 상주 클래스면 포인터 읽기만. 아니면 SyncLoad(카운트/경고) 후 Pin */
+	template<typename T>
+	static TSubclassOf<T> ResolveClass(const UObject* WorldContext, const TSoftClassPtr<T>& SoftClass)
+	{
+		if (UClass* Resident = SoftClass.Get())
+		{
+			return Resident;
+		}
+
+		if (SoftClass.IsNull())
+		{
+			return nullptr;
+		}
+
+		UClass* Loaded = SoftClass.LoadSynchronous();
+		NoteSyncLoad(WorldContext, SoftClass.ToSoftObjectPath(), Loaded);
+		return Loaded;
+	}
+
+	// =========================================================================
+	// Debug
+	// =========================================================================
+	int32 GetSyncLoadCount() const { return SyncLoadCount; }
+	int32 GetCombatPhaseSyncLoadCount() const { return CombatPhaseSyncLoadCount; }
+
+private:
+	static void NoteSyncLoad(const UObject* WorldContext, const FSoftObjectPath& Path, UObject* Loaded);
+
+	void CollectResidencyPaths(const UWorld* World, TArray<FSoftObjectPath>& OutPaths) const;
+	void OnResidencyLoaded(TSharedPtr<FStreamableHandle> Handle, FSimpleDelegate OnComplete);
+
+private:
+	/** Pin: 하드 레퍼런스로 유지 (GameInstance 수명) */
+	UPROPERTY(Transient)
+	TSet<TObjectPtr<UObject>> PinnedAssets;
+
+	TSharedPtr<FStreamableHandle> ResidencyHandle;
+
+	int32 SyncLoadCount = 0;
+	int32 CombatPhaseSyncLoadCount = 0;
+};
@@ -0,0 +1,225 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesDamageAccumulatorSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesDamageAccumulatorSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/MosesStats.h"
+#include "UE5_Multi_Shooter/MosesPlayerState.h"
+#include "UE5_Multi_Shooter/Match/GAS/MosesGameplayTags.h"
+
+#include "Engine/World.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+
+namespace MosesDamageAccum_Private
+{
+	static bool IsServerWorld(const UWorld* World)
+	{
+		return World && World->GetNetMode() != NM_Client;
+	}
+
+	/** 플레이어 ASC는 PlayerState 소유 → 같은 프레임 앞 묶음에서 이미 사망했으면 스킵 */
+	static bool IsTargetDead(const UAbilitySystemComponent* TargetASC)
+	{
+		const AMosesPlayerState* TargetPS = TargetASC ? Cast<AMosesPlayerState>(TargetASC->GetOwner()) : nullptr;
+		return TargetPS && TargetPS->IsDead();
+	}
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesDamageAccumulatorSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesDamageAccumulatorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PendingDamage.Reserve(32);
+	FlushingDamage.Reserve(32);
+}
+
+void UMosesDamageAccumulatorSubsystem::Deinitialize()
+{
+	PendingDamage.Reset();
+	FlushingDamage.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UMosesDamageAccumulatorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMosesDamageAccumulatorSubsystem, STATGROUP_Tickables);
+}
+
+void UMosesDamageAccumulatorSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!MosesDamageAccum_Private::IsServerWorld(GetWorld()))
+	{
+		return;
+	}
+
+	Flush_Server();
+}
+
+// ============================================================================
+// Accumulate
+// ============================================================================
+
+bool UMosesDamageAccumulatorSubsystem::AddDamage_Server(const FMosesDamageEvent& Event)
+{
+	if (!MosesDamageAccum_Private::IsServerWorld(GetWorld()))
+	{
+		return false;
+	}
+
+	if (!Event.SourceASC.IsValid() || !Event.TargetASC.IsValid() || !Event.DamageGE)
+	{
+		return false;
+	}
+
+	const AActor* OriginalInstigator = Event.Context.GetOriginalInstigator();
+
+	// 같은 묶음 탐색 (프레임당 묶음 수 = 공격자 x 타겟, 선형 탐색으로 충분)
+	FPendingDamage* Pending = PendingDamage.FindByPredicate([&Event, OriginalInstigator](const FPendingDamage& Existing)
+	{
+		return Existing.Event.TargetASC == Event.TargetASC
+			&& Existing.Event.SourceASC == Event.SourceASC
+			&& Existing.Event.DamageGE == Event.DamageGE
+			&& Existing.OriginalInstigator.Get() == OriginalInstigator
+			&& Existing.Event.bHeadshot == Event.bHeadshot;
+	});
+
+	if (!Pending)
+	{
+		Pending = &PendingDamage.AddDefaulted_GetRef();
+		Pending->Event = Event;
+		Pending->OriginalInstigator = OriginalInstigator;
+		Pending->NumHits = 1;
+
+		++PendingHits;
+		return true;
+	}
+
+	FMosesDamageEvent& Merged = Pending->Event;
+
+	// 대표 Context: 마지막 히트 (묶음 안은 모두 같은 Headshot 여부)
+	Merged.Context = Event.Context;
+	Merged.CueSourceObject = Event.CueSourceObject;
+	Merged.Magnitude += Event.Magnitude;
+
+	if (Event.ImpactCueTag.IsValid())
+	{
+		Merged.ImpactCueTag = Event.ImpactCueTag;
+	}
+
+	++Pending->NumHits;
+
+	++PendingHits;
+	return true;
+}
+
+// ============================================================================
+// Flush
+// ============================================================================
+
+void UMosesDamageAccumulatorSubsystem::Flush_Server()
+{
+	if (PendingDamage.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_MosesDamageFlush);
+
+	// Apply 중 사망 처리 등에서 재누적되면 다음 Flush로
+	Swap(PendingDamage, FlushingDamage);
+	const int32 NumHits = PendingHits;
+	PendingHits = 0;
+
+	int32 NumApplied = 0;
+	for (const FPendingDamage& Pending : FlushingDamage)
+	{
+		if (ApplyNow_Server(Pending.Event, Pending.NumHits))
+		{
+			++NumApplied;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_MosesDamageHits, NumHits);
+	SET_DWORD_STAT(STAT_MosesDamageSpecsApplied, NumApplied);
+
+	UE_LOG(LogMosesGAS, VeryVerbose, TEXT("[GAS][SV] DamageFlush Hits=%d Groups=%d Applied=%d"),
+		NumHits, FlushingDamage.Num(), NumApplied);
+
+	FlushingDamage.Reset();
+}
+
+bool UMosesDamageAccumulatorSubsystem::ApplyNow_Server(const FMosesDamageEvent& Event, int32 NumHits)
+{
+	UAbilitySystemComponent* SourceASC = Event.SourceASC.Get();
+	UAbilitySystemComponent* TargetASC = Event.TargetASC.Get();
+	if (!SourceASC || !TargetASC || !Event.DamageGE)
+	{
+		return false;
+	}
+
+	if (MosesDamageAccum_Private::IsTargetDead(TargetASC))
+	{
+		UE_LOG(LogMosesGAS, Verbose, TEXT("[GAS][SV] DamageFlush SKIP (TargetAlreadyDead) Target=%s Hits=%d"),
+			*GetNameSafe(TargetASC->GetOwner()), NumHits);
+		return false;
+	}
+
+	const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(Event.DamageGE, 1.0f, Event.Context);
+	if (!SpecHandle.IsValid() || !SpecHandle.Data.IsValid())
+	{
+		return false;
+	}
+
+	if (Event.bHeadshot)
+	{
+		SpecHandle.Data->AddDynamicAssetTag(FMosesGameplayTags::Get().Hit_Headshot);
+	}
+
+	SpecHandle.Data->SetSetByCallerMagnitude(FMosesGameplayTags::Get().Data_Damage, Event.Magnitude);
+
+	const FActiveGameplayEffectHandle Applied = SourceASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
+	if (!Applied.WasSuccessfullyApplied())
+	{
+		return false;
+	}
+
+	if (Event.ImpactCueTag.IsValid())
+	{
+		FGameplayCueParameters Params;
+		Params.EffectContext = Event.Context;
+		Params.SourceObject = const_cast<UObject*>(Event.CueSourceObject.Get());
+
+		TargetASC->ExecuteGameplayCue(Event.ImpactCueTag, Params);
+	}
+
+	UE_LOG(LogMosesGAS, Verbose, TEXT("[GAS][SV] DamageFlush APPLY Target=%s Instigator=%s Damage=%.1f Hits=%d Headshot=%d GE=%s"),
+		*GetNameSafe(TargetASC->GetOwner()),
+		*GetNameSafe(Event.Context.GetOriginalInstigator()),
+		Event.Magnitude,
+		NumHits,
+		Event.bHeadshot ? 1 : 0,
+		*GetNameSafe(Event.DamageGE.Get()));
+
+	return true;
+}
@@ -0,0 +1,100 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesDamageAccumulatorSubsystem.h
+// ----------------------------------------------------------------------------
+// Damage Accumulator (Server)
+// - 히트마다 Spec 생성/Apply 하지 않고 프레임 동안 (Target, Source, GE, Instigator, Headshot)
+//   묶음으로 데미지만 합산 → Flush 시 묶음당 Spec 1개 Apply
+//   · 여러 명이 좀비 1마리를 동시에 때려도 GE Apply = 공격자 수 (히트 수 아님)
+// - 묶음 = 인스티게이터 단위 → EffectContext(OriginalInstigator) 그대로 유지
+//   → 킬 귀속(ResolveKillerPlayerState_FromEffectContext_Server) 변화 없음
+// - 헤드/몸통 히트는 별도 묶음 → Hit.Headshot 태그는 헤드 묶음 Spec에만
+//   → 헤드샷 크레딧 = 킬을 낸 묶음 기준 (몸통 킬에 헤드 1발 섞여도 헤드샷 아님)
+// - 대표 Context: 묶음의 마지막 히트 (HitResult/Bone 정보 유지)
+// - Flush 순서 = 묶음의 첫 히트 순서 (같은 프레임 막타는 묶음 단위로 판정)
+// - Flush 지점: Hitscan Batch Resolve 직후 + 자체 Tick (그 외 경로 잔여분)
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayEffectTypes.h"
+#include "GameplayTagContainer.h"
+#include "Templates/SubclassOf.h"
+#include "MosesDamageAccumulatorSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+// ============================================================================
+// Damage Event (히트 1건)
+// ============================================================================
+
+struct FMosesDamageEvent
+{
+	TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+	TWeakObjectPtr<UAbilitySystemComponent> TargetASC;
+	TSubclassOf<UGameplayEffect> DamageGE;
+
+	/** Instigator/Causer/HitResult/SourceObject가 채워진 Context */
+	FGameplayEffectContextHandle Context;
+
+	/** Data.Damage SetByCaller 값 (GE 파이프라인 부호 그대로) */
+	float Magnitude = 0.0f;
+
+	bool bHeadshot = false;
+
+	/** Apply 성공 시 TargetASC에서 실행할 Cue (비어 있으면 생략) */
+	FGameplayTag ImpactCueTag;
+	TWeakObjectPtr<const UObject> CueSourceObject;
+};
+
+// ============================================================================
+// UMosesDamageAccumulatorSubsystem
+// ============================================================================
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesDamageAccumulatorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// =========================================================================
+	// Accumulate / Flush (Server only)
+	// =========================================================================
+
+	/** 이번 프레임 누적. 서버 월드가 아니면 false (호출측 즉시 Apply 폴백) */
+	bool AddDamage_Server(const FMosesDamageEvent& Event);
+
+	/** 누적분을 묶음당 Spec 1개로 Apply */
+	void Flush_Server();
+
+	/** 누적 없이 즉시 Apply (서브시스템이 없는 월드 폴백). NumHits는 로그용 */
+	static bool ApplyNow_Server(const FMosesDamageEvent& Event, int32 NumHits = 1);
+
+private:
+	struct FPendingDamage
+	{
+		/** 합산된 이벤트 (Magnitude = 합, Context = 대표) */
+		FMosesDamageEvent Event;
+		TWeakObjectPtr<const AActor> OriginalInstigator;
+		int32 NumHits = 0;
+	};
+
+private:
+	/** 이번 프레임 묶음 (추가 순서 = 첫 히트 순서) / Flush 중 버퍼 */
+	TArray<FPendingDamage> PendingDamage;
+	TArray<FPendingDamage> FlushingDamage;
+
+	int32 PendingHits = 0;
+};
@@ -0,0 +1,102 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesFireCommandTypes.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesFireCommandTypes.h"
+
+bool FMosesFireCommandPacket::NetSerialize(FArchive& Ar, UPackageMap* /*Map*/, bool& bOutSuccess)
+{
+	// NumShots: 0~4 (3bit)
+	uint32 Count = FMath::Min<uint32>(NumShots, MaxRedundantShots);
+	Ar.SerializeInt(Count, MaxRedundantShots + 1);
+
+	if (Ar.IsLoading())
+	{
+		NumShots = static_cast<uint8>(FMath::Min<uint32>(Count, MaxRedundantShots));
+	}
+
+	if (NumShots == 0)
+	{
+		bOutSuccess = true;
+		return true;
+	}
+
+	// 최신 샷: Seq(16) + Time(32) + Aim(32) + Spread(8)
+	FMosesFireShotCommand& Newest = Shots[0];
+	Ar << Newest.ShotSeq;
+	Ar << Newest.ClientTimeSec;
+	Ar << Newest.AimPitch;
+	Ar << Newest.AimYaw;
+	Ar << Newest.SpreadFactorQ;
+
+	// 과거 샷: Seq는 연속이므로 생략, TimeDelta(16, ms) + Aim(32) + Spread(8)
+	for (int32 Index = 1; Index < NumShots; ++Index)
+	{
+		FMosesFireShotCommand& Shot = Shots[Index];
+
+		uint16 DeltaMs = 0;
+		if (Ar.IsSaving())
+		{
+			const float DeltaSec = FMath::Max(0.0f, Newest.ClientTimeSec - Shot.ClientTimeSec);
+			DeltaMs = static_cast<uint16>(FMath::Min(FMath::RoundToInt(DeltaSec * 1000.0f), 0xFFFF));
+		}
+
+		Ar << DeltaMs;
+		Ar << Shot.AimPitch;
+		Ar << Shot.AimYaw;
+		Ar << Shot.SpreadFactorQ;
+
+		if (Ar.IsLoading())
+		{
+			Shot.ShotSeq = static_cast<uint16>(Newest.ShotSeq - Index);
+			Shot.ClientTimeSec = Newest.ClientTimeSec - (DeltaMs * 0.001f);
+		}
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+bool FMosesShotAckBatch::NetSerialize(FArchive& Ar, UPackageMap* /*Map*/, bool& bOutSuccess)
+{
+	// NumAcks: 0~16 (5bit)
+	uint32 Count = FMath::Min<uint32>(NumAcks, MaxAcks);
+	Ar.SerializeInt(Count, MaxAcks + 1);
+
+	if (Ar.IsLoading())
+	{
+		NumAcks = static_cast<uint8>(FMath::Min<uint32>(Count, MaxAcks));
+	}
+
+	for (int32 Index = 0; Index < NumAcks; ++Index)
+	{
+		FMosesShotAck& Ack = Acks[Index];
+
+		// Seq: 첫 항목만 16bit, 이후는 직전 대비 Delta (Packed)
+		if (Index == 0)
+		{
+			Ar << Ack.ShotSeq;
+		}
+		else
+		{
+			uint32 Delta = Ar.IsSaving() ? static_cast<uint16>(Ack.ShotSeq - Acks[Index - 1].ShotSeq) : 0;
+			Ar.SerializeIntPacked(Delta);
+
+			if (Ar.IsLoading())
+			{
+				Ack.ShotSeq = static_cast<uint16>(Acks[Index - 1].ShotSeq + Delta);
+			}
+		}
+
+		uint32 Result = static_cast<uint32>(Ack.Result);
+		Ar.SerializeInt(Result, 4);
+
+		if (Ar.IsLoading())
+		{
+			Ack.Result = static_cast<EMosesShotAckResult>(Result);
+		}
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
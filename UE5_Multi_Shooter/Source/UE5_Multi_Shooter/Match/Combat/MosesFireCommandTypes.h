@@ -0,0 +1,154 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesFireCommandTypes.h
+// ----------------------------------------------------------------------------
+// Fire Command Stream (Client -> Server, Unreliable)
+// - 발사 1회 = ShotSeq(순번) + 클라 타임스탬프(서버시간 기준) + 양자화된 조준/스프레드
+// - 패킷마다 "최근 N발"을 중복 전송 → 패킷 하나가 유실돼도 다음 패킷으로 복구
+// - 서버는 ShotSeq로 중복 제거, FireIntervalSec로 연사 속도 검증
+// - 판정 결과는 ShotSeq 단위 Ack 묶음으로 발사자에게 회신 (Hit Confirm 예측 보정)
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MosesFireCommandTypes.generated.h"
+
+// ============================================================================
+// ShotSeq Helpers (uint16 wrap-around)
+// ============================================================================
+
+namespace MosesFireSeq
+{
+	/** A가 B보다 최신인가 (wrap-around 고려) */
+	FORCEINLINE bool IsNewer(uint16 A, uint16 B)
+	{
+		return A != B && static_cast<uint16>(A - B) < 0x8000;
+	}
+}
+
+// ============================================================================
+// FMosesFireShotCommand
+// ============================================================================
+
+/** 발사 1회 명령 */
+USTRUCT()
+struct FMosesFireShotCommand
+{
+	GENERATED_BODY()
+
+	uint16 ShotSeq = 0;
+
+	/** 클라가 발사한 시점 (AGameStateBase::GetServerWorldTimeSeconds 기준) */
+	float ClientTimeSec = 0.0f;
+
+	/** FRotator::CompressAxisToShort 양자화 */
+	uint16 AimPitch = 0;
+	uint16 AimYaw = 0;
+
+	/** 클라 예측에 쓴 이동 스프레드(0~1), 8bit 양자화 (서버는 자체 추정치 근처로 Clamp) */
+	uint8 SpreadFactorQ = 0;
+
+	void SetSpreadFactor01(float InFactor01)
+	{
+		SpreadFactorQ = static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(InFactor01, 0.0f, 1.0f) * 255.0f));
+	}
+
+	float GetSpreadFactor01() const
+	{
+		return SpreadFactorQ / 255.0f;
+	}
+
+	void SetAimRotation(const FRotator& InAim)
+	{
+		AimPitch = FRotator::CompressAxisToShort(InAim.Pitch);
+		AimYaw = FRotator::CompressAxisToShort(InAim.Yaw);
+	}
+
+	FRotator GetAimRotation() const
+	{
+		return FRotator(
+			FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(AimPitch)),
+			FRotator::DecompressAxisFromShort(AimYaw),
+			0.0f);
+	}
+};
+
+// ============================================================================
+// FMosesFireCommandPacket
+// ============================================================================
+
+/**
+ * 최근 N발 묶음 (Shots[0] = 최신)
+ * - ShotSeq는 연속이라 최신 Seq 하나만 보내고 나머지는 -i 로 복원
+ * - 과거 샷 시간은 최신 기준 ms Delta(16bit)로 전송
+ */
+USTRUCT()
+struct FMosesFireCommandPacket
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxRedundantShots = 4;
+
+	FMosesFireShotCommand Shots[MaxRedundantShots];
+	uint8 NumShots = 0;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMosesFireCommandPacket> : public TStructOpsTypeTraitsBase2<FMosesFireCommandPacket>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+// ============================================================================
+// Shot Ack (Server -> Owner Client, Unreliable)
+// ============================================================================
+
+/** 서버 확정 결과 (2bit) */
+enum class EMosesShotAckResult : uint8
+{
+	Miss = 0,
+	Hit,
+	Headshot,
+	Rejected,		// 연사/상태 검증 거절 (판정 자체 없음)
+};
+
+struct FMosesShotAck
+{
+	uint16 ShotSeq = 0;
+	EMosesShotAckResult Result = EMosesShotAckResult::Miss;
+};
+
+/**
+ * 한 프레임 동안 판정된 샷 결과 묶음
+ * - 첫 Seq만 16bit, 이후는 직전 Seq와의 차이(대부분 1 → 1byte)
+ * - 결과는 샷당 2bit
+ * - Unreliable: 유실된 Ack는 클라가 타임아웃으로 처리 (예측 유지)
+ */
+USTRUCT()
+struct FMosesShotAckBatch
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxAcks = 16;
+
+	FMosesShotAck Acks[MaxAcks];
+	uint8 NumAcks = 0;
+
+	bool IsFull() const { return NumAcks >= MaxAcks; }
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMosesShotAckBatch> : public TStructOpsTypeTraitsBase2<FMosesShotAckBatch>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
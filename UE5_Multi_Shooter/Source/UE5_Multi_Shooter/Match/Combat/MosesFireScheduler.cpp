@@ -0,0 +1,111 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesFireScheduler.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesFireScheduler.h"
+
+// ============================================================================
+// Control
+// ============================================================================
+
+void FMosesFireScheduler::Configure(float IntervalSec)
+{
+	// 최소 1ms (0 나눗셈/무한 루프 방지)
+	IntervalTicks = FMath::Max<int64>(SecondsToTicks(IntervalSec), TicksPerSecond / 1000);
+}
+
+void FMosesFireScheduler::Start(double NowSec)
+{
+	if (bTriggerHeld)
+	{
+		return;
+	}
+
+	bTriggerHeld = true;
+
+	// 쿨다운이 끝났으면 지금부터, 아니면 예정 시각 유지
+	NextShotTicks = FMath::Max(NextShotTicks, SecondsToTicks(NowSec));
+}
+
+void FMosesFireScheduler::Stop()
+{
+	bTriggerHeld = false;
+}
+
+void FMosesFireScheduler::Reset()
+{
+	NextShotTicks = MIN_int64;
+	ShotCount = 0;
+	bTriggerHeld = false;
+}
+
+int32 FMosesFireScheduler::Advance(double NowSec, double* OutShotTimesSec)
+{
+	if (!bTriggerHeld)
+	{
+		return 0;
+	}
+
+	const int64 NowTicks = SecondsToTicks(NowSec);
+
+	int32 NumShots = 0;
+	while (NextShotTicks <= NowTicks && NumShots < MaxCatchUpShots)
+	{
+		if (OutShotTimesSec)
+		{
+			OutShotTimesSec[NumShots] = TicksToSeconds(NextShotTicks);
+		}
+
+		NextShotTicks += IntervalTicks;
+		++NumShots;
+	}
+
+	// 히치로 MaxCatchUpShots 이상 밀렸으면 초과분은 버리고 위상만 유지
+	if (NextShotTicks <= NowTicks)
+	{
+		const int64 Behind = NowTicks - NextShotTicks;
+		NextShotTicks += ((Behind / IntervalTicks) + 1) * IntervalTicks;
+	}
+
+	ShotCount += NumShots;
+	return NumShots;
+}
+
+bool FMosesFireScheduler::TryConsumeSingleShot(double NowSec)
+{
+	const int64 NowTicks = SecondsToTicks(NowSec);
+	if (NowTicks < NextShotTicks)
+	{
+		return false;
+	}
+
+	NextShotTicks = NowTicks + IntervalTicks;
+	++ShotCount;
+	return true;
+}
+
+// ============================================================================
+// Query
+// ============================================================================
+
+float FMosesFireScheduler::GetTimeUntilNextShotSec(double NowSec) const
+{
+	if (NextShotTicks == MIN_int64)
+	{
+		return 0.0f;
+	}
+
+	const int64 Remaining = NextShotTicks - SecondsToTicks(NowSec);
+	return Remaining > 0 ? static_cast<float>(TicksToSeconds(Remaining)) : 0.0f;
+}
+
+float FMosesFireScheduler::GetCooldownAlpha(double NowSec) const
+{
+	const float IntervalSec = GetIntervalSec();
+	if (IntervalSec <= KINDA_SMALL_NUMBER)
+	{
+		return 1.0f;
+	}
+
+	return FMath::Clamp(1.0f - (GetTimeUntilNextShotSec(NowSec) / IntervalSec), 0.0f, 1.0f);
+}
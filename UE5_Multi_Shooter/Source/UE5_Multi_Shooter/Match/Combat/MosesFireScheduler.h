@@ -0,0 +1,83 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesFireScheduler.h
+// ----------------------------------------------------------------------------
+// Deterministic Fire Scheduler (로컬 발사 / HUD / GA 공용)
+// - 연사 타이밍을 고정소수점(μs) 누산기로 계산
+//   → 프레임레이트와 무관하게 같은 입력 = 같은 발수/같은 발사 시각
+// - 샷 시각은 "예정 시각"(NextShotTicks)을 그대로 사용 → Interval 간격이 정확히 유지
+// - FTimerManager/AbilityTask를 쓰지 않는다 (소유자가 Tick에서 Advance 호출)
+// - HUD/GA는 Query API(GetTimeUntilNextShotSec/GetCooldownAlpha 등)로 같은 상태를 읽는다
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct UE5_MULTI_SHOOTER_API FMosesFireScheduler
+{
+public:
+	/** 1 Tick = 1μs */
+	static constexpr int64 TicksPerSecond = 1000000;
+
+	/** 한 번의 Advance에서 따라잡을 수 있는 최대 발수 (히치 대비, 초과분은 버린다) */
+	static constexpr int32 MaxCatchUpShots = 4;
+
+	static int64 SecondsToTicks(double Seconds)
+	{
+		return static_cast<int64>(FMath::RoundToDouble(Seconds * static_cast<double>(TicksPerSecond)));
+	}
+
+	static double TicksToSeconds(int64 Ticks)
+	{
+		return static_cast<double>(Ticks) / static_cast<double>(TicksPerSecond);
+	}
+
+public:
+	// =========================================================================
+	// Control
+	// =========================================================================
+
+	/** 무기 연사 간격 설정 (Start 전에 호출) */
+	void Configure(float IntervalSec);
+
+	/** 트리거 Down. 이전 샷의 쿨다운은 유지된다 (연타로 연사 속도 초과 불가) */
+	void Start(double NowSec);
+
+	/** 트리거 Up */
+	void Stop();
+
+	/** 쿨다운 포함 전부 초기화 */
+	void Reset();
+
+	/**
+	 * NowSec까지 발사 예정인 샷을 계산한다.
+	 * @param OutShotTimesSec 예정 발사 시각 (MaxCatchUpShots 크기)
+	 * @return 이번에 발사할 샷 수
+	 */
+	int32 Advance(double NowSec, double* OutShotTimesSec);
+
+	/** 단발: 쿨다운이 끝났으면 1발 소비 */
+	bool TryConsumeSingleShot(double NowSec);
+
+	// =========================================================================
+	// Query (HUD / GA 공용)
+	// =========================================================================
+	bool IsTriggerHeld() const { return bTriggerHeld; }
+	float GetIntervalSec() const { return static_cast<float>(TicksToSeconds(IntervalTicks)); }
+	uint32 GetShotCount() const { return ShotCount; }
+
+	/** 다음 샷까지 남은 시간 (0 = 즉시 발사 가능) */
+	float GetTimeUntilNextShotSec(double NowSec) const;
+
+	/** 0 = 방금 발사, 1 = 발사 가능 (크로스헤어/탄 UI 용) */
+	float GetCooldownAlpha(double NowSec) const;
+
+private:
+	int64 IntervalTicks = SecondsToTicks(0.1);
+
+	/** 다음 샷 예정 시각. 발사한 적 없으면 MIN */
+	int64 NextShotTicks = MIN_int64;
+
+	uint32 ShotCount = 0;
+	bool bTriggerHeld = false;
+};
@@ -0,0 +1,258 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesHitZoneSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesHitZoneSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+
+#include "Engine/World.h"
+#include "Engine/HitResult.h"
+#include "Engine/SkeletalMesh.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+
+namespace MosesHitZone_Private
+{
+	static const FName TagHead(TEXT("HitZone.Head"));
+	static const FName TagBody(TEXT("HitZone.Body"));
+	static const FName TagLimb(TEXT("HitZone.Limb"));
+
+	// 빌드 시 1회만 사용 (소문자 부분일치)
+	static const TCHAR* LimbKeywords[] =
+	{
+		TEXT("clavicle"), TEXT("arm"), TEXT("hand"), TEXT("finger"), TEXT("thumb"),
+		TEXT("thigh"), TEXT("calf"), TEXT("leg"), TEXT("foot"), TEXT("toe"), TEXT("ball"),
+	};
+
+	static EMosesHitZone ClassifyBone(const FReferenceSkeleton& RefSkeleton, FName BoneName, FName HeadBoneName)
+	{
+		// 자신 또는 조상이 Head면 Head (턱/눈 등 하위 본 포함)
+		int32 BoneIndex = RefSkeleton.FindBoneIndex(BoneName);
+		while (BoneIndex != INDEX_NONE)
+		{
+			const FName Name = RefSkeleton.GetBoneName(BoneIndex);
+			if (Name == HeadBoneName || Name.ToString().ToLower().Contains(TEXT("head")))
+			{
+				return EMosesHitZone::Head;
+			}
+
+			BoneIndex = RefSkeleton.GetParentIndex(BoneIndex);
+		}
+
+		const FString BoneLower = BoneName.ToString().ToLower();
+		if (BoneLower.Contains(TEXT("head")))
+		{
+			return EMosesHitZone::Head;
+		}
+
+		for (const TCHAR* Keyword : LimbKeywords)
+		{
+			if (BoneLower.Contains(Keyword))
+			{
+				return EMosesHitZone::Limb;
+			}
+		}
+
+		return EMosesHitZone::Body;
+	}
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesHitZoneSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesHitZoneSubsystem::Deinitialize()
+{
+	ComponentZones.Reset();
+	MeshHeadBones.Reset();
+	Tables.Reset();
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// Register
+// ============================================================================
+
+void UMosesHitZoneSubsystem::RegisterComponentZone(UPrimitiveComponent* Component, EMosesHitZone Zone)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	ComponentZones.Add(Component, Zone);
+}
+
+void UMosesHitZoneSubsystem::RegisterTaggedComponents(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	TInlineComponentArray<UPrimitiveComponent*> Prims(Actor);
+	for (UPrimitiveComponent* Prim : Prims)
+	{
+		if (!Prim)
+		{
+			continue;
+		}
+
+		if (Prim->ComponentHasTag(MosesHitZone_Private::TagHead))
+		{
+			ComponentZones.Add(Prim, EMosesHitZone::Head);
+		}
+		else if (Prim->ComponentHasTag(MosesHitZone_Private::TagLimb))
+		{
+			ComponentZones.Add(Prim, EMosesHitZone::Limb);
+		}
+		else if (Prim->ComponentHasTag(MosesHitZone_Private::TagBody))
+		{
+			ComponentZones.Add(Prim, EMosesHitZone::Body);
+		}
+	}
+}
+
+void UMosesHitZoneSubsystem::RegisterSkeletalMesh(USkeletalMeshComponent* SkelComp, FName HeadBoneName)
+{
+	if (!SkelComp || HeadBoneName.IsNone())
+	{
+		return;
+	}
+
+	MeshHeadBones.Add(SkelComp, HeadBoneName);
+	FindOrBuildTable(SkelComp, HeadBoneName);
+}
+
+void UMosesHitZoneSubsystem::UnregisterActor(AActor* Actor)
+{
+	if (!Actor || (ComponentZones.Num() == 0 && MeshHeadBones.Num() == 0))
+	{
+		return;
+	}
+
+	TInlineComponentArray<UPrimitiveComponent*> Prims(Actor);
+	for (UPrimitiveComponent* Prim : Prims)
+	{
+		ComponentZones.Remove(Prim);
+
+		if (USkeletalMeshComponent* SkelComp = Cast<USkeletalMeshComponent>(Prim))
+		{
+			MeshHeadBones.Remove(SkelComp);
+		}
+	}
+}
+
+// ============================================================================
+// Query
+// ============================================================================
+
+EMosesHitZone UMosesHitZoneSubsystem::ClassifyHit(const FHitResult& Hit, FName DefaultHeadBoneName)
+{
+	const UPrimitiveComponent* HitComp = Hit.GetComponent();
+	if (!HitComp)
+	{
+		return EMosesHitZone::Body;
+	}
+
+	// 1) 전용 히트박스
+	if (const EMosesHitZone* Registered = ComponentZones.Find(HitComp))
+	{
+		return *Registered;
+	}
+
+	// 2) 스켈레탈 본 (PhysicsAsset 테이블)
+	const USkeletalMeshComponent* SkelComp = Cast<USkeletalMeshComponent>(HitComp);
+	if (!SkelComp || Hit.BoneName.IsNone())
+	{
+		return EMosesHitZone::Body;
+	}
+
+	// 등록된 메시는 자기 Head 본 기준 (호출자마다 다른 본으로 분류되지 않게)
+	const FName* RegisteredHeadBone = MeshHeadBones.Find(SkelComp);
+	const FMosesHitZoneTable* Table = FindOrBuildTable(SkelComp, RegisteredHeadBone ? *RegisteredHeadBone : DefaultHeadBoneName);
+	if (!Table)
+	{
+		return EMosesHitZone::Body;
+	}
+
+	// Hit.Item = BodyIndex (BoneName으로 검증 후 배열 조회)
+	const int32 BodyIndex = Hit.Item;
+	if (Table->ZoneByBodyIndex.IsValidIndex(BodyIndex) && Table->BoneNameByBodyIndex[BodyIndex] == Hit.BoneName)
+	{
+		return Table->ZoneByBodyIndex[BodyIndex];
+	}
+
+	const EMosesHitZone* ByName = Table->ZoneByBoneName.Find(Hit.BoneName);
+	return ByName ? *ByName : EMosesHitZone::Body;
+}
+
+const FMosesHitZoneTable* UMosesHitZoneSubsystem::FindOrBuildTable(const USkeletalMeshComponent* SkelComp, FName HeadBoneName)
+{
+	UPhysicsAsset* PhysAsset = SkelComp ? SkelComp->GetPhysicsAsset() : nullptr;
+	const USkeletalMesh* Mesh = SkelComp ? SkelComp->GetSkeletalMeshAsset() : nullptr;
+	if (!PhysAsset || !Mesh)
+	{
+		return nullptr;
+	}
+
+	FMosesHitZoneTableKey Key;
+	Key.Mesh = Mesh;
+	Key.PhysicsAsset = PhysAsset;
+	Key.HeadBoneName = HeadBoneName;
+
+	if (const FMosesHitZoneTable* Existing = Tables.Find(Key))
+	{
+		return Existing;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = Mesh->GetRefSkeleton();
+
+	FMosesHitZoneTable& Table = Tables.Add(Key);
+
+	const int32 NumBodies = PhysAsset->SkeletalBodySetups.Num();
+	Table.ZoneByBodyIndex.SetNumUninitialized(NumBodies);
+	Table.BoneNameByBodyIndex.SetNumUninitialized(NumBodies);
+	Table.ZoneByBoneName.Reserve(NumBodies);
+
+	int32 NumHead = 0;
+	int32 NumLimb = 0;
+
+	for (int32 BodyIndex = 0; BodyIndex < NumBodies; ++BodyIndex)
+	{
+		const USkeletalBodySetup* Setup = PhysAsset->SkeletalBodySetups[BodyIndex];
+		const FName BoneName = Setup ? Setup->BoneName : NAME_None;
+
+		const EMosesHitZone Zone = BoneName.IsNone()
+			? EMosesHitZone::Body
+			: MosesHitZone_Private::ClassifyBone(RefSkeleton, BoneName, HeadBoneName);
+
+		Table.ZoneByBodyIndex[BodyIndex] = Zone;
+		Table.BoneNameByBodyIndex[BodyIndex] = BoneName;
+		Table.ZoneByBoneName.Add(BoneName, Zone);
+
+		NumHead += (Zone == EMosesHitZone::Head) ? 1 : 0;
+		NumLimb += (Zone == EMosesHitZone::Limb) ? 1 : 0;
+	}
+
+	UE_LOG(LogMosesCombat, Log, TEXT("[HITZONE] Build Table Mesh=%s PhysAsset=%s HeadBone=%s Bodies=%d Head=%d Limb=%d"),
+		*GetNameSafe(Mesh), *GetNameSafe(PhysAsset), *HeadBoneName.ToString(), NumBodies, NumHead, NumLimb);
+
+	return &Table;
+}
@@ -0,0 +1,110 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesHitZoneSubsystem.h
+// ----------------------------------------------------------------------------
+// Hit Zone Registry (Server + Client)
+// - 서버 판정과 클라 예측(Hit Confirm)이 같은 등록/테이블로 분류 → 예측 헤드샷 일치
+// - 히트 부위(Head/Body/Limb) 분류를 "한 번만" 계산해 캐싱
+//   · SkeletalMesh: (Mesh, PhysicsAsset, HeadBone) 단위 BodyIndex -> Zone 테이블
+//     메시 등록 시 1회 빌드 (등록 안 된 메시는 최초 히트 시, 호출자 HeadBone 기준)
+//   · 전용 히트박스(Player HeadHitBox, "HitZone.*" 태그 컴포넌트): 등록 시 1회
+// - 히트 1회 = 배열 인덱스 1번 (FString 생성/소문자 변환/Contains 없음)
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MosesHitZoneSubsystem.generated.h"
+
+class AActor;
+class UPhysicsAsset;
+class USkeletalMesh;
+class UPrimitiveComponent;
+class USkeletalMeshComponent;
+struct FHitResult;
+
+// ============================================================================
+// Hit Zone
+// ============================================================================
+
+UENUM(BlueprintType)
+enum class EMosesHitZone : uint8
+{
+	Body,
+	Head,
+	Limb,
+};
+
+/** 테이블 키: 같은 PhysicsAsset이라도 메시/Head 본이 다르면 별도 테이블 */
+struct FMosesHitZoneTableKey
+{
+	TObjectKey<USkeletalMesh> Mesh;
+	TObjectKey<UPhysicsAsset> PhysicsAsset;
+	FName HeadBoneName;
+
+	bool operator==(const FMosesHitZoneTableKey& Other) const
+	{
+		return Mesh == Other.Mesh && PhysicsAsset == Other.PhysicsAsset && HeadBoneName == Other.HeadBoneName;
+	}
+
+	friend uint32 GetTypeHash(const FMosesHitZoneTableKey& Key)
+	{
+		return HashCombineFast(HashCombineFast(GetTypeHash(Key.Mesh), GetTypeHash(Key.PhysicsAsset)), GetTypeHash(Key.HeadBoneName));
+	}
+};
+
+/** PhysicsAsset 1개 분량의 분류 테이블 */
+struct FMosesHitZoneTable
+{
+	TArray<EMosesHitZone> ZoneByBodyIndex;
+	TArray<FName> BoneNameByBodyIndex;			// Hit.Item 검증용
+	TMap<FName, EMosesHitZone> ZoneByBoneName;	// Hit.Item 없을 때 폴백 (FName 해시)
+};
+
+// ============================================================================
+// UMosesHitZoneSubsystem
+// ============================================================================
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesHitZoneSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// =========================================================================
+	// Register (모든 NetMode: 서버 판정 + 클라 예측 공용)
+	// =========================================================================
+
+	/** 전용 히트박스 등록 (예: Player HeadHitBox) */
+	void RegisterComponentZone(UPrimitiveComponent* Component, EMosesHitZone Zone);
+
+	/** "HitZone.Head/Body/Limb" 태그가 붙은 컴포넌트를 1회 스캔해 등록 */
+	void RegisterTaggedComponents(AActor* Actor);
+
+	/** 스켈레탈 메시의 Head 본 등록 + 테이블 즉시 빌드 (이후 분류는 호출자와 무관하게 이 본 기준) */
+	void RegisterSkeletalMesh(USkeletalMeshComponent* SkelComp, FName HeadBoneName);
+
+	void UnregisterActor(AActor* Actor);
+
+	// =========================================================================
+	// Query
+	// =========================================================================
+
+	/**
+	 * 히트 부위 분류
+	 * @param DefaultHeadBoneName 등록되지 않은 메시의 Head 루트 본 (하위 본도 Head)
+	 */
+	EMosesHitZone ClassifyHit(const FHitResult& Hit, FName DefaultHeadBoneName);
+
+private:
+	const FMosesHitZoneTable* FindOrBuildTable(const USkeletalMeshComponent* SkelComp, FName HeadBoneName);
+
+private:
+	TMap<TObjectKey<UPrimitiveComponent>, EMosesHitZone> ComponentZones;
+	TMap<TObjectKey<USkeletalMeshComponent>, FName> MeshHeadBones;
+	TMap<FMosesHitZoneTableKey, FMosesHitZoneTable> Tables;
+};
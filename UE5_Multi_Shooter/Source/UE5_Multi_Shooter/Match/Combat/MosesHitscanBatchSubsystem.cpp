@@ -0,0 +1,280 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesHitscanBatchSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesHitscanBatchSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/MosesStats.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesLagCompensationSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesDamageAccumulatorSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Characters/Player/Components/MosesCombatComponent.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Async/ParallelFor.h"
+#include "Algo/StableSort.h"
+
+namespace MosesHitscan_Private
+{
+	static bool IsServerWorld(const UWorld* World)
+	{
+		return World && World->GetNetMode() != NM_Client;
+	}
+
+	/** 같은 키 = 같은 양자화 Rewind 시각 (Rewind 없음은 INDEX_NONE 묶음) */
+	static int64 GetBucketKey(const FMosesHitscanRequest& Request)
+	{
+		if (!Request.bRewind)
+		{
+			return INDEX_NONE;
+		}
+
+		return FMath::Max<int64>(0, FMath::RoundToInt64(Request.RewindTimeSec / UMosesHitscanBatchSubsystem::GetRewindQuantumSec()));
+	}
+
+	static double GetBucketRewindTimeSec(int64 Key)
+	{
+		return static_cast<double>(Key) * UMosesHitscanBatchSubsystem::GetRewindQuantumSec();
+	}
+
+	static FVector GetImpactOrEnd(const FHitResult& Hit, bool bHit, const FVector& End)
+	{
+		return bHit ? (Hit.Location.IsNearlyZero() ? Hit.ImpactPoint : Hit.Location) : End;
+	}
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesHitscanBatchSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesHitscanBatchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Pending.Reserve(64);
+	Flushing.Reserve(64);
+	BucketOrder.Reserve(64);
+	BucketSegments.Reserve(128);
+}
+
+void UMosesHitscanBatchSubsystem::Deinitialize()
+{
+	Pending.Reset();
+	Flushing.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UMosesHitscanBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMosesHitscanBatchSubsystem, STATGROUP_Tickables);
+}
+
+void UMosesHitscanBatchSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!MosesHitscan_Private::IsServerWorld(GetWorld()))
+	{
+		return;
+	}
+
+	Flush_Server();
+}
+
+// ============================================================================
+// Queue
+// ============================================================================
+
+bool UMosesHitscanBatchSubsystem::Enqueue_Server(FMosesHitscanRequest&& Request)
+{
+	if (!MosesHitscan_Private::IsServerWorld(GetWorld()))
+	{
+		return false;
+	}
+
+	FPendingEntry& Entry = Pending.AddDefaulted_GetRef();
+	Entry.Request = MoveTemp(Request);
+	Entry.EnqueuePlatformSec = FPlatformTime::Seconds();
+	return true;
+}
+
+bool UMosesHitscanBatchSubsystem::Enqueue_Server(TArrayView<FMosesHitscanRequest> Requests)
+{
+	if (!MosesHitscan_Private::IsServerWorld(GetWorld()))
+	{
+		return false;
+	}
+
+	const double NowPlatformSec = FPlatformTime::Seconds();
+	for (FMosesHitscanRequest& Request : Requests)
+	{
+		FPendingEntry& Entry = Pending.AddDefaulted_GetRef();
+		Entry.Request = MoveTemp(Request);
+		Entry.EnqueuePlatformSec = NowPlatformSec;
+	}
+	return true;
+}
+
+double UMosesHitscanBatchSubsystem::GetRewindQuantumSec()
+{
+	return UMosesLagCompensationSubsystem::MinRecordIntervalSec;
+}
+
+void UMosesHitscanBatchSubsystem::ExecuteTracePair(const UWorld* World, const FMosesHitscanRequest& Request, FMosesHitscanTraceResult& OutResult)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	// (1) Cam Trace: 화면 중앙 기준 조준점
+	OutResult.bCamHit = World->LineTraceSingleByChannel(OutResult.CamHit, Request.CamStart, Request.CamEnd, Request.TraceChannel, Request.CamParams);
+	OutResult.CamImpact = MosesHitscan_Private::GetImpactOrEnd(OutResult.CamHit, OutResult.bCamHit, Request.CamEnd);
+
+	// (2) Muzzle Trace: 총구 → 조준점 (벽 뒤 조준 차단)
+	OutResult.MuzzleEnd = OutResult.CamImpact;
+	if (FVector::Dist(Request.MuzzleStart, OutResult.MuzzleEnd) < 10.0f)
+	{
+		OutResult.MuzzleEnd = Request.MuzzleStart + (Request.SpreadDir * 10.0f);
+	}
+
+	OutResult.bFinalHit = World->LineTraceSingleByChannel(OutResult.FinalHit, Request.MuzzleStart, OutResult.MuzzleEnd, Request.TraceChannel, Request.MuzzleParams);
+	OutResult.FinalImpact = MosesHitscan_Private::GetImpactOrEnd(OutResult.FinalHit, OutResult.bFinalHit, OutResult.MuzzleEnd);
+}
+
+// ============================================================================
+// Flush
+// ============================================================================
+
+void UMosesHitscanBatchSubsystem::Flush_Server()
+{
+	if (Pending.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_MosesHitscanFlush);
+
+	UWorld* World = GetWorld();
+	UMosesLagCompensationSubsystem* LagComp = World ? World->GetSubsystem<UMosesLagCompensationSubsystem>() : nullptr;
+
+	Swap(Pending, Flushing);
+	const int32 NumRequests = Flushing.Num();
+
+	// -------------------------------------------------------------------------
+	// (1) 양자화 Rewind 시각 기준 안정 정렬 (같은 묶음 안에서는 큐잉 순서 유지)
+	// -------------------------------------------------------------------------
+	BucketOrder.Reset();
+	for (int32 Index = 0; Index < NumRequests; ++Index)
+	{
+		BucketOrder.Add(Index);
+	}
+
+	Algo::StableSort(BucketOrder, [this](int32 A, int32 B)
+	{
+		return MosesHitscan_Private::GetBucketKey(Flushing[A].Request) < MosesHitscan_Private::GetBucketKey(Flushing[B].Request);
+	});
+
+	// -------------------------------------------------------------------------
+	// (2) 묶음 단위: Rewind 1회 → Trace 병렬 → 복구
+	// -------------------------------------------------------------------------
+	int32 NumBuckets = 0;
+
+	for (int32 BucketStart = 0; BucketStart < NumRequests; )
+	{
+		const FMosesHitscanRequest& First = Flushing[BucketOrder[BucketStart]].Request;
+		const int64 Key = MosesHitscan_Private::GetBucketKey(First);
+
+		int32 BucketEnd = BucketStart + 1;
+		while (BucketEnd < NumRequests && MosesHitscan_Private::GetBucketKey(Flushing[BucketOrder[BucketEnd]].Request) == Key)
+		{
+			++BucketEnd;
+		}
+
+		const int32 BucketNum = BucketEnd - BucketStart;
+
+		bool bRewound = false;
+		if (LagComp && First.bRewind && !LagComp->IsRewindActive())
+		{
+			// 슈터가 1명뿐이면 본인 제외 (동기 경로와 동일), 여러 명이면 서로가 타겟
+			const AActor* IgnoreActor = First.ShooterPawn.Get();
+
+			BucketSegments.Reset();
+			for (int32 Local = 0; Local < BucketNum; ++Local)
+			{
+				const FMosesHitscanRequest& Request = Flushing[BucketOrder[BucketStart + Local]].Request;
+				BucketSegments.Add(Request.CamStart);
+				BucketSegments.Add(Request.CamEnd);
+
+				if (Request.ShooterPawn.Get() != IgnoreActor)
+				{
+					IgnoreActor = nullptr;
+				}
+			}
+
+			LagComp->BeginRewind_Server(MosesHitscan_Private::GetBucketRewindTimeSec(Key), IgnoreActor, BucketSegments);
+			bRewound = true;
+		}
+
+		// 결과는 요청별 슬롯에만 기록 → 스레드 실행 순서와 무관하게 결정적
+		ParallelFor(BucketNum, [this, World, BucketStart](int32 Local)
+		{
+			FPendingEntry& Entry = Flushing[BucketOrder[BucketStart + Local]];
+			ExecuteTracePair(World, Entry.Request, Entry.Result);
+		},
+		BucketNum < MinParallelRequests ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		if (bRewound)
+		{
+			LagComp->EndRewind_Server();
+		}
+
+		++NumBuckets;
+		BucketStart = BucketEnd;
+	}
+
+	// -------------------------------------------------------------------------
+	// (3) Resolve: 큐잉 순서(= RPC 도착 순서) 단일 패스
+	// -------------------------------------------------------------------------
+	const double NowPlatformSec = FPlatformTime::Seconds();
+	double MaxLatencySec = 0.0;
+
+	for (FPendingEntry& Entry : Flushing)
+	{
+		MaxLatencySec = FMath::Max(MaxLatencySec, NowPlatformSec - Entry.EnqueuePlatformSec);
+
+		if (UMosesCombatComponent* Shooter = Entry.Request.Shooter.Get())
+		{
+			Shooter->Server_ResolveHitscanResult(Entry.Request, Entry.Result);
+		}
+	}
+
+	// 이번 프레임 히트 데미지를 같은 프레임에 Apply (Accumulator Tick 순서와 무관)
+	if (UMosesDamageAccumulatorSubsystem* DamageAccumulator = World ? World->GetSubsystem<UMosesDamageAccumulatorSubsystem>() : nullptr)
+	{
+		DamageAccumulator->Flush_Server();
+	}
+
+	SET_DWORD_STAT(STAT_MosesHitscanRequests, NumRequests);
+	SET_DWORD_STAT(STAT_MosesHitscanTraces, NumRequests * 2);
+	SET_DWORD_STAT(STAT_MosesHitscanRewindBuckets, NumBuckets);
+	SET_FLOAT_STAT(STAT_MosesHitscanLatencyMaxMs, static_cast<float>(MaxLatencySec * 1000.0));
+
+	UE_LOG(LogMosesCombat, VeryVerbose, TEXT("[FIRE][SV] HitscanBatch Flush Requests=%d Buckets=%d LatencyMax=%.3fms"),
+		NumRequests, NumBuckets, MaxLatencySec * 1000.0);
+
+	Flushing.Reset();
+}
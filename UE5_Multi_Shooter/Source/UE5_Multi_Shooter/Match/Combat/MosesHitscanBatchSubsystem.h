@@ -0,0 +1,138 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesHitscanBatchSubsystem.h
+// ----------------------------------------------------------------------------
+// Hitscan Trace Batch (Server)
+// - Fire RPC 처리 중에는 Trace를 실행하지 않고 요청(Cam/Muzzle 쌍)만 큐잉
+// - 프레임 고정 지점(Tickable = 액터 Tick 이후)에서 일괄 처리
+//   · Rewind 시각을 히스토리 샘플 간격(1/60s)으로 양자화해 묶음 → 묶음당
+//     Rewind 1회 → Scene Query 병렬 발행 → 복구 (슈터별 RTT가 달라도 같은 묶음)
+//   · 데미지 Resolve는 큐잉 순서(= RPC 도착 순서) 그대로 단일 패스
+//   → 동기 경로와 판정/적용 순서 동일
+// - 펠릿 샷은 펠릿 N개 요청을 연속 큐잉 → 같은 묶음에서 Trace, Resolve도 연속
+//   (발사자가 마지막 펠릿에서 타겟별 합산 데미지 적용)
+// - Resolve 직후 Damage Accumulator Flush → 히트 데미지는 같은 프레임에 GE 적용
+// - AsyncLineTraceByChannel은 결과가 다음 프레임이고 Rewind 스코프를
+//   프레임 경계 너머로 유지할 수 없어 ParallelFor + 동기 Scene Query로 대체
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionQueryParams.h"
+#include "Engine/HitResult.h"
+#include "MosesHitscanBatchSubsystem.generated.h"
+
+class AController;
+class APawn;
+class UMosesCombatComponent;
+class UMosesLagCompensationSubsystem;
+class UMosesWeaponData;
+
+// ============================================================================
+// Request / Result
+// ============================================================================
+
+/** 샷 1발 분량의 Trace 요청 (Fire 시점에 조준/시작점/무시 목록 확정) */
+struct FMosesHitscanRequest
+{
+	TWeakObjectPtr<UMosesCombatComponent> Shooter;
+	TWeakObjectPtr<APawn> ShooterPawn;
+	TWeakObjectPtr<AController> ShooterController;
+	TWeakObjectPtr<const UMosesWeaponData> WeaponData;
+
+	FVector CamStart = FVector::ZeroVector;
+	FVector CamEnd = FVector::ZeroVector;
+	FVector MuzzleStart = FVector::ZeroVector;
+	FVector SpreadDir = FVector::ForwardVector;
+
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+	FCollisionQueryParams CamParams;
+	FCollisionQueryParams MuzzleParams;
+
+	/** bRewind=false면 현재 시점 그대로 Trace */
+	bool bRewind = false;
+	double RewindTimeSec = 0.0;
+
+	/** 발사자 Hit Confirm Ack 대상 (Fire Command Stream ShotSeq) */
+	uint16 ShotSeq = 0;
+	bool bAckToShooter = false;
+
+	/** 펠릿 샷: 같은 ShotSeq의 PelletCount개 요청이 연속 (단일 히트스캔 = 1) */
+	uint8 PelletIndex = 0;
+	uint8 PelletCount = 1;
+};
+
+/** Cam → Muzzle 2단계 Trace 결과 */
+struct FMosesHitscanTraceResult
+{
+	FHitResult CamHit;
+	bool bCamHit = false;
+	FVector CamImpact = FVector::ZeroVector;
+
+	FVector MuzzleEnd = FVector::ZeroVector;
+
+	FHitResult FinalHit;
+	bool bFinalHit = false;
+	FVector FinalImpact = FVector::ZeroVector;
+};
+
+// ============================================================================
+// UMosesHitscanBatchSubsystem
+// ============================================================================
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesHitscanBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// =========================================================================
+	// Queue (Server only)
+	// =========================================================================
+
+	/** 이번 프레임 Flush 대상으로 큐잉. 서버 월드가 아니면 false (호출측 동기 폴백) */
+	bool Enqueue_Server(FMosesHitscanRequest&& Request);
+
+	/** 펠릿 샷: 요청 묶음을 연속으로 큐잉 (Resolve 순서 보장). Requests는 Move됨 */
+	bool Enqueue_Server(TArrayView<FMosesHitscanRequest> Requests);
+
+	/** 동기 폴백 / 배치 내부 공용: Cam → Muzzle Trace (Rewind는 호출측 책임) */
+	static void ExecuteTracePair(const UWorld* World, const FMosesHitscanRequest& Request, FMosesHitscanTraceResult& OutResult);
+
+public:
+	/** Rewind 묶음 양자화 간격 = Lag Compensation 히스토리 샘플 간격 (오차 최대 절반) */
+	static double GetRewindQuantumSec();
+
+	/** 이 개수 미만 묶음은 단일 스레드로 처리 (태스크 디스패치 비용 > Trace 비용) */
+	static constexpr int32 MinParallelRequests = 4;
+
+private:
+	void Flush_Server();
+
+private:
+	struct FPendingEntry
+	{
+		FMosesHitscanRequest Request;
+		FMosesHitscanTraceResult Result;
+		double EnqueuePlatformSec = 0.0;
+	};
+
+	/** 이번 프레임 큐 / Flush 중 버퍼 (Resolve 중 재큐잉은 다음 프레임으로) */
+	TArray<FPendingEntry> Pending;
+	TArray<FPendingEntry> Flushing;
+
+	/** Flush 임시 버퍼 (Steady-State 무할당) */
+	TArray<int32> BucketOrder;
+	TArray<FVector> BucketSegments;
+};
@@ -0,0 +1,376 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesLagCompensationSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesLagCompensationSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerState.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
+
+namespace MosesLagComp_Private
+{
+	static bool IsServerWorld(const UWorld* World)
+	{
+		return World && World->GetNetMode() != NM_Client;
+	}
+
+	static FTransform MakeRootTransform(const FVector3f& Location, float Yaw)
+	{
+		return FTransform(FRotator(0.0f, Yaw, 0.0f), FVector(Location));
+	}
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesLagCompensationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesLagCompensationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SampleCapacity = FMath::CeilToInt(HistoryWindowSec / MinRecordIntervalSec) + 2;
+
+	Histories.Reserve(64);
+}
+
+void UMosesLagCompensationSubsystem::Deinitialize()
+{
+	if (bRewindActive)
+	{
+		EndRewind_Server();
+	}
+
+	Histories.Reset();
+	RestoreEntries.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UMosesLagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMosesLagCompensationSubsystem, STATGROUP_Tickables);
+}
+
+void UMosesLagCompensationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	if (!MosesLagComp_Private::IsServerWorld(World))
+	{
+		return;
+	}
+
+	const double NowSec = World->GetTimeSeconds();
+	if (LastRecordTimeSec >= 0.0 && (NowSec - LastRecordTimeSec) < MinRecordIntervalSec)
+	{
+		return;
+	}
+
+	LastRecordTimeSec = NowSec;
+	RecordAll_Server(NowSec);
+}
+
+// ============================================================================
+// Register
+// ============================================================================
+
+void UMosesLagCompensationSubsystem::RegisterTarget_Server(AActor* TargetActor, UPrimitiveComponent* InRootBody, USkeletalMeshComponent* InMeshBody, UPrimitiveComponent* InHeadBody)
+{
+	if (!TargetActor || !InRootBody || !MosesLagComp_Private::IsServerWorld(GetWorld()))
+	{
+		return;
+	}
+
+	for (const FMosesHitboxHistory& Existing : Histories)
+	{
+		if (Existing.Actor.Get() == TargetActor)
+		{
+			return;
+		}
+	}
+
+	FMosesHitboxHistory& History = Histories.AddDefaulted_GetRef();
+	History.Actor = TargetActor;
+	History.RootBody = InRootBody;
+	History.MeshBody = InMeshBody;
+	History.HeadBody = InHeadBody;
+	History.Samples.SetNum(SampleCapacity);
+
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[LAGCOMP][SV] Register Target=%s Head=%d Capacity=%d Num=%d"),
+		*GetNameSafe(TargetActor), InHeadBody ? 1 : 0, SampleCapacity, Histories.Num());
+}
+
+void UMosesLagCompensationSubsystem::UnregisterTarget_Server(AActor* TargetActor)
+{
+	if (!TargetActor)
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < Histories.Num(); ++Index)
+	{
+		if (Histories[Index].Actor.Get() == TargetActor)
+		{
+			Histories.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+			UE_LOG(LogMosesCombat, Verbose, TEXT("[LAGCOMP][SV] Unregister Target=%s Num=%d"),
+				*GetNameSafe(TargetActor), Histories.Num());
+			return;
+		}
+	}
+}
+
+// ============================================================================
+// Record
+// ============================================================================
+
+void UMosesLagCompensationSubsystem::RecordAll_Server(double NowSec)
+{
+	for (int32 Index = Histories.Num() - 1; Index >= 0; --Index)
+	{
+		FMosesHitboxHistory& History = Histories[Index];
+
+		const AActor* Actor = History.Actor.Get();
+		const UPrimitiveComponent* RootBody = History.RootBody.Get();
+		if (!Actor || !RootBody)
+		{
+			// Destroy된 타겟은 여기서 정리 (Unregister 누락 대비)
+			Histories.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		FMosesHitboxSample& Sample = History.Samples[History.NextWriteIndex];
+		Sample.ServerTimeSec = NowSec;
+		Sample.RootLocation = FVector3f(RootBody->GetComponentLocation());
+		Sample.RootYaw = RootBody->GetComponentRotation().Yaw;
+
+		const UPrimitiveComponent* HeadBody = History.HeadBody.Get();
+		Sample.HeadLocation = HeadBody ? FVector3f(HeadBody->GetComponentLocation()) : Sample.RootLocation;
+
+		History.NextWriteIndex = (History.NextWriteIndex + 1) % SampleCapacity;
+		History.NumValid = FMath::Min(History.NumValid + 1, SampleCapacity);
+	}
+}
+
+bool UMosesLagCompensationSubsystem::SampleAtTime(const FMosesHitboxHistory& History, double TargetTimeSec, FMosesHitboxSample& OutSample) const
+{
+	if (History.NumValid <= 0)
+	{
+		return false;
+	}
+
+	// 최신 → 과거 순으로 내려가며 TargetTime을 감싸는 두 샘플을 찾는다
+	const FMosesHitboxSample* Newer = nullptr;
+
+	for (int32 Step = 1; Step <= History.NumValid; ++Step)
+	{
+		const int32 SampleIndex = (History.NextWriteIndex - Step + SampleCapacity) % SampleCapacity;
+		const FMosesHitboxSample& Older = History.Samples[SampleIndex];
+
+		if (Older.ServerTimeSec <= TargetTimeSec)
+		{
+			if (!Newer)
+			{
+				// TargetTime이 최신 기록보다 미래 → 최신 그대로
+				OutSample = Older;
+				return true;
+			}
+
+			const double Span = Newer->ServerTimeSec - Older.ServerTimeSec;
+			const float Alpha = (Span > UE_KINDA_SMALL_NUMBER) ? static_cast<float>((TargetTimeSec - Older.ServerTimeSec) / Span) : 0.0f;
+
+			OutSample.ServerTimeSec = TargetTimeSec;
+			OutSample.RootLocation = FMath::Lerp(Older.RootLocation, Newer->RootLocation, Alpha);
+			OutSample.RootYaw = Older.RootYaw + FMath::FindDeltaAngleDegrees(Older.RootYaw, Newer->RootYaw) * Alpha;
+			OutSample.HeadLocation = FMath::Lerp(Older.HeadLocation, Newer->HeadLocation, Alpha);
+			return true;
+		}
+
+		Newer = &Older;
+	}
+
+	// 윈도우보다 과거 → 가장 오래된 샘플로 Clamp
+	OutSample = *Newer;
+	return true;
+}
+
+// ============================================================================
+// Rewind
+// ============================================================================
+
+double UMosesLagCompensationSubsystem::EstimateClientViewTime_Server(const APlayerState* ShooterPS, float MaxRewindSec, float ExtraRewindSec) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0;
+	}
+
+	const double NowSec = World->GetTimeSeconds();
+	if (!ShooterPS)
+	{
+		return NowSec;
+	}
+
+	// PlayerState Ping = RTT(ms). 원격 타겟은 클라 화면에서 대략 RTT 만큼 과거 위치로 보인다.
+	const float RttSec = ShooterPS->GetPingInMilliseconds() * 0.001f;
+	const float RewindSec = FMath::Clamp(RttSec + ExtraRewindSec, 0.0f, FMath::Min(MaxRewindSec, HistoryWindowSec));
+
+	return NowSec - RewindSec;
+}
+
+int32 UMosesLagCompensationSubsystem::BeginRewind_Server(double TargetServerTimeSec, const AActor* IgnoreActor, const FVector& SegmentStart, const FVector& SegmentEnd)
+{
+	const FVector SegmentPoints[2] = { SegmentStart, SegmentEnd };
+	return BeginRewind_Server(TargetServerTimeSec, IgnoreActor, MakeArrayView(SegmentPoints));
+}
+
+bool UMosesLagCompensationSubsystem::IsNearAnySegment(const FVector& Point, TConstArrayView<FVector> SegmentPoints, float RadiusSq)
+{
+	for (int32 Index = 0; Index + 1 < SegmentPoints.Num(); Index += 2)
+	{
+		if (FMath::PointDistToSegmentSquared(Point, SegmentPoints[Index], SegmentPoints[Index + 1]) <= RadiusSq)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32 UMosesLagCompensationSubsystem::BeginRewind_Server(double TargetServerTimeSec, const AActor* IgnoreActor, TConstArrayView<FVector> SegmentPoints)
+{
+	if (bRewindActive || !MosesLagComp_Private::IsServerWorld(GetWorld()))
+	{
+		return 0;
+	}
+
+	bRewindActive = true;
+	RestoreEntries.Reset();
+
+	// 복구 목록은 추적 중인 전체 바디 수(캡슐 + 메시 본 + 헤드)로 확보 → 이후 리와인드 무할당
+	int32 NumTrackedBodies = 0;
+	for (const FMosesHitboxHistory& History : Histories)
+	{
+		const USkeletalMeshComponent* MeshBody = History.MeshBody.Get();
+		NumTrackedBodies += 1 + (History.HeadBody.IsValid() ? 1 : 0) + (MeshBody ? MeshBody->Bodies.Num() : 0);
+	}
+	RestoreEntries.Reserve(NumTrackedBodies);
+
+	const float CullRadiusSq = FMath::Square(RewindCullRadius);
+	int32 NumRewound = 0;
+
+	for (const FMosesHitboxHistory& History : Histories)
+	{
+		const AActor* Actor = History.Actor.Get();
+		UPrimitiveComponent* RootBody = History.RootBody.Get();
+		if (!Actor || !RootBody || Actor == IgnoreActor)
+		{
+			continue;
+		}
+
+		FMosesHitboxSample Sample;
+		if (!SampleAtTime(History, TargetServerTimeSec, Sample))
+		{
+			continue;
+		}
+
+		const FVector RewoundLoc(Sample.RootLocation);
+		if (!IsNearAnySegment(RewoundLoc, SegmentPoints, CullRadiusSq)
+			&& !IsNearAnySegment(RootBody->GetComponentLocation(), SegmentPoints, CullRadiusSq))
+		{
+			continue;
+		}
+
+		const FTransform CurrentRoot = RootBody->GetComponentTransform();
+		const FTransform RewoundRoot = MosesLagComp_Private::MakeRootTransform(Sample.RootLocation, Sample.RootYaw);
+
+		// Root(캡슐)
+		MoveBody_ForRewind(RootBody->GetBodyInstance(), RewoundRoot);
+
+		// Mesh 본 바디: 현재 포즈 유지 + 루트 기준 상대 이동
+		if (USkeletalMeshComponent* MeshBody = History.MeshBody.Get())
+		{
+			for (FBodyInstance* Body : MeshBody->Bodies)
+			{
+				if (Body && Body->IsValidBodyInstance())
+				{
+					const FTransform BodyWorld = Body->GetUnrealWorldTransform();
+					MoveBody_ForRewind(Body, BodyWorld.GetRelativeTransform(CurrentRoot) * RewoundRoot);
+				}
+			}
+		}
+
+		// HeadHitBox: 기록된 월드 위치 그대로
+		if (UPrimitiveComponent* HeadBody = History.HeadBody.Get())
+		{
+			FBodyInstance* HeadInstance = HeadBody->GetBodyInstance();
+			if (HeadInstance && HeadInstance->IsValidBodyInstance())
+			{
+				FTransform HeadTransform = HeadInstance->GetUnrealWorldTransform();
+				HeadTransform.SetLocation(FVector(Sample.HeadLocation));
+				MoveBody_ForRewind(HeadInstance, HeadTransform);
+			}
+		}
+
+		++NumRewound;
+	}
+
+	UE_LOG(LogMosesCombat, VeryVerbose, TEXT("[LAGCOMP][SV] Rewind Dt=%.3f Targets=%d Bodies=%d"),
+		GetWorld()->GetTimeSeconds() - TargetServerTimeSec, NumRewound, RestoreEntries.Num());
+
+	return NumRewound;
+}
+
+void UMosesLagCompensationSubsystem::EndRewind_Server()
+{
+	if (!bRewindActive)
+	{
+		return;
+	}
+
+	// 역순 복구 (같은 Body가 중복 등록돼도 최초 원본으로 돌아감)
+	for (int32 Index = RestoreEntries.Num() - 1; Index >= 0; --Index)
+	{
+		const FMosesHitboxRestoreEntry& Entry = RestoreEntries[Index];
+		if (Entry.Body && Entry.Body->IsValidBodyInstance())
+		{
+			Entry.Body->SetBodyTransform(Entry.OriginalTransform, ETeleportType::TeleportPhysics);
+		}
+	}
+
+	RestoreEntries.Reset();
+	bRewindActive = false;
+}
+
+void UMosesLagCompensationSubsystem::MoveBody_ForRewind(FBodyInstance* Body, const FTransform& NewTransform)
+{
+	if (!Body || !Body->IsValidBodyInstance())
+	{
+		return;
+	}
+
+	FMosesHitboxRestoreEntry& Entry = RestoreEntries.AddDefaulted_GetRef();
+	Entry.Body = Body;
+	Entry.OriginalTransform = Body->GetUnrealWorldTransform();
+
+	Body->SetBodyTransform(NewTransform, ETeleportType::TeleportPhysics);
+}
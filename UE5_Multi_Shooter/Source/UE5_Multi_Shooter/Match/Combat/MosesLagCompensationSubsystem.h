@@ -0,0 +1,176 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesLagCompensationSubsystem.h
+// ----------------------------------------------------------------------------
+// Server-side Lag Compensation (Hitbox Rewind)
+// - 서버가 매 프레임 Player/Zombie 히트 볼륨(몸통 캡슐 + HeadHitBox) 위치를 링버퍼에 기록
+// - Hitscan 판정 직전, 슈터 클라가 보던 시점으로 타겟을 되감고 Trace 후 즉시 복구
+// - 컴포넌트 Transform은 건드리지 않고 BodyInstance만 이동한다
+//   → Overlap/Replication/Movement 부작용 없음 (Scene Query에만 반영)
+// - 등록 시 1회 할당 이후 Steady-State 무할당
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MosesLagCompensationSubsystem.generated.h"
+
+class AActor;
+class APlayerState;
+class UPrimitiveComponent;
+class USkeletalMeshComponent;
+struct FBodyInstance;
+
+// ============================================================================
+// History Types
+// ============================================================================
+
+/** 한 프레임 분량의 히트 볼륨 스냅샷 (캐릭터 루트는 Yaw만 회전하므로 Yaw만 저장) */
+struct FMosesHitboxSample
+{
+	double ServerTimeSec = 0.0;
+	FVector3f RootLocation = FVector3f::ZeroVector;
+	float RootYaw = 0.0f;
+	FVector3f HeadLocation = FVector3f::ZeroVector;
+};
+
+/** 타겟 1명의 고정 크기 링버퍼 */
+struct FMosesHitboxHistory
+{
+	TWeakObjectPtr<AActor> Actor;
+	TWeakObjectPtr<UPrimitiveComponent> RootBody;			// 몸통 캡슐
+	TWeakObjectPtr<USkeletalMeshComponent> MeshBody;		// 스켈레탈 메시(본 바디)
+	TWeakObjectPtr<UPrimitiveComponent> HeadBody;			// Player HeadHitBox (Zombie는 null)
+
+	TArray<FMosesHitboxSample> Samples;						// 등록 시 Capacity 만큼 1회 할당
+	int32 NextWriteIndex = 0;
+	int32 NumValid = 0;
+};
+
+/** 리와인드 스코프 동안 원래 Body Transform 보관 */
+struct FMosesHitboxRestoreEntry
+{
+	FBodyInstance* Body = nullptr;
+	FTransform OriginalTransform = FTransform::Identity;
+};
+
+// ============================================================================
+// UMosesLagCompensationSubsystem
+// ============================================================================
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// =========================================================================
+	// Register (Server only)
+	// =========================================================================
+	void RegisterTarget_Server(AActor* TargetActor, UPrimitiveComponent* InRootBody, USkeletalMeshComponent* InMeshBody, UPrimitiveComponent* InHeadBody);
+	void UnregisterTarget_Server(AActor* TargetActor);
+
+	// =========================================================================
+	// Rewind (Server only)
+	// =========================================================================
+
+	/** 슈터 클라가 화면에서 보던 서버 시간 추정 (Now - RTT - Extra, MaxRewindSec로 Clamp) */
+	double EstimateClientViewTime_Server(const APlayerState* ShooterPS, float MaxRewindSec, float ExtraRewindSec) const;
+
+	/**
+	 * TargetServerTimeSec 시점으로 세그먼트 주변 타겟만 되감는다.
+	 * - IgnoreActor(슈터 본인)는 제외
+	 * - 반드시 EndRewind_Server()로 복구해야 한다 (FMosesScopedHitboxRewind 사용 권장)
+	 * @return 되감은 타겟 수
+	 */
+	int32 BeginRewind_Server(double TargetServerTimeSec, const AActor* IgnoreActor, const FVector& SegmentStart, const FVector& SegmentEnd);
+
+	/**
+	 * 여러 세그먼트(Start/End 쌍)를 한 번에 되감는다 (Hitscan Batch: 같은 Rewind 시각 묶음)
+	 * - 어느 세그먼트에든 CullRadius 안이면 되감는다
+	 */
+	int32 BeginRewind_Server(double TargetServerTimeSec, const AActor* IgnoreActor, TConstArrayView<FVector> SegmentPoints);
+
+	void EndRewind_Server();
+
+	bool IsRewindActive() const { return bRewindActive; }
+
+public:
+	/** 링버퍼가 보관하는 최대 시간 (MaxRewindSec보다 커야 함) */
+	static constexpr float HistoryWindowSec = 0.4f;
+
+	/** 기록 최소 간격 (서버 프레임이 이보다 빠르면 스킵 → 링버퍼 크기 상한 보장) */
+	static constexpr float MinRecordIntervalSec = 1.0f / 60.0f;
+
+	/** 세그먼트로부터 이 반경 밖 타겟은 되감지 않는다 (캡슐 크기 + 윈도우 내 이동량 여유) */
+	static constexpr float RewindCullRadius = 400.0f;
+
+private:
+	void RecordAll_Server(double NowSec);
+	static bool IsNearAnySegment(const FVector& Point, TConstArrayView<FVector> SegmentPoints, float RadiusSq);
+	bool SampleAtTime(const FMosesHitboxHistory& History, double TargetTimeSec, FMosesHitboxSample& OutSample) const;
+
+	void MoveBody_ForRewind(FBodyInstance* Body, const FTransform& NewTransform);
+
+private:
+	TArray<FMosesHitboxHistory> Histories;
+	TArray<FMosesHitboxRestoreEntry> RestoreEntries;
+
+	int32 SampleCapacity = 0;
+	double LastRecordTimeSec = -1.0;
+	bool bRewindActive = false;
+};
+
+// ============================================================================
+// FMosesScopedHitboxRewind
+// - 스코프 진입 시 Rewind, 이탈 시 자동 복구 (Trace 구간만 감싸서 사용)
+// ============================================================================
+
+struct FMosesScopedHitboxRewind
+{
+	FMosesScopedHitboxRewind(UMosesLagCompensationSubsystem* InSubsystem, double TargetServerTimeSec, const AActor* IgnoreActor, const FVector& SegmentStart, const FVector& SegmentEnd)
+		: Subsystem(InSubsystem)
+	{
+		if (Subsystem && !Subsystem->IsRewindActive())
+		{
+			NumRewound = Subsystem->BeginRewind_Server(TargetServerTimeSec, IgnoreActor, SegmentStart, SegmentEnd);
+			bOwnsRewind = true;
+		}
+	}
+
+	// 여러 세그먼트 (펠릿 샷 동기 폴백)
+	FMosesScopedHitboxRewind(UMosesLagCompensationSubsystem* InSubsystem, double TargetServerTimeSec, const AActor* IgnoreActor, TConstArrayView<FVector> SegmentPoints)
+		: Subsystem(InSubsystem)
+	{
+		if (Subsystem && !Subsystem->IsRewindActive())
+		{
+			NumRewound = Subsystem->BeginRewind_Server(TargetServerTimeSec, IgnoreActor, SegmentPoints);
+			bOwnsRewind = true;
+		}
+	}
+
+	~FMosesScopedHitboxRewind()
+	{
+		if (Subsystem && bOwnsRewind)
+		{
+			Subsystem->EndRewind_Server();
+		}
+	}
+
+	int32 GetNumRewound() const { return NumRewound; }
+
+private:
+	UMosesLagCompensationSubsystem* Subsystem = nullptr;
+	int32 NumRewound = 0;
+	bool bOwnsRewind = false;
+};
@@ -0,0 +1,103 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesPlayerSpatialHashSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesPlayerSpatialHashSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesStats.h"
+#include "UE5_Multi_Shooter/MosesPlayerState.h"
+
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+
+namespace MosesPlayerSpatialHash_Private
+{
+	static bool IsServerWorld(const UWorld* World)
+	{
+		return World && World->GetNetMode() != NM_Client;
+	}
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesPlayerSpatialHashSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesPlayerSpatialHashSubsystem::Deinitialize()
+{
+	Entries.Reset();
+	Cells.Reset();
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// Build
+// ============================================================================
+
+void UMosesPlayerSpatialHashSubsystem::RefreshIfStale_Server()
+{
+	if (LastBuildFrame == GFrameCounter || !MosesPlayerSpatialHash_Private::IsServerWorld(GetWorld()))
+	{
+		return;
+	}
+
+	LastBuildFrame = GFrameCounter;
+	Rebuild_Server();
+}
+
+void UMosesPlayerSpatialHashSubsystem::Rebuild_Server()
+{
+	SCOPE_CYCLE_COUNTER(STAT_MosesPlayerHashRebuild);
+
+	Entries.Reset();
+
+	// 셀 배열은 비우기만 (플레이어 수가 적어 빈 셀이 남아도 비용 없음, 할당 재사용)
+	for (TPair<FIntPoint, TArray<int32, TInlineAllocator<4>>>& Pair : Cells)
+	{
+		Pair.Value.Reset();
+	}
+
+	const AGameStateBase* GS = GetWorld()->GetGameState();
+	if (!GS)
+	{
+		return;
+	}
+
+	// PlayerArray = 접속 플레이어 전체 (Controller 순회 없이 PS → Pawn)
+	for (const APlayerState* PS : GS->PlayerArray)
+	{
+		const AMosesPlayerState* MosesPS = Cast<AMosesPlayerState>(PS);
+		if (!MosesPS || MosesPS->IsDead())
+		{
+			continue;
+		}
+
+		APawn* Pawn = MosesPS->GetPawn();
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		const int32 Index = Entries.Num();
+
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Pawn = Pawn;
+		Entry.Location = Pawn->GetActorLocation();
+
+		Cells.FindOrAdd(ToCell(Entry.Location)).Add(Index);
+	}
+
+	SET_DWORD_STAT(STAT_MosesPlayerHashTracked, Entries.Num());
+}
@@ -0,0 +1,104 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesPlayerSpatialHashSubsystem.h
+// ----------------------------------------------------------------------------
+// Player Spatial Hash (Server)
+// - 살아 있는 플레이어 Pawn을 XY 균일 격자(CellSize)에 등록
+//   · 매 프레임 틱 재구성 없음 → 질의하는 쪽이 RefreshIfStale_Server (프레임당 최대 1회)
+// - 질의 = 반경이 걸치는 셀의 엔트리만 방문 (ForEachPlayerInRadius)
+//   · 좀비 일괄 선정(UMosesZombieDirectorSubsystem): 좀비마다 획득 반경 셀만 후보
+//   · 엔트리 인덱스 = GetTrackedPawn/GetTrackedLocation 인덱스 (SoA 입력과 정렬 일치)
+// - 갱신 후 질의는 읽기 전용 → 워커 스레드에서 동시 질의 가능
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MosesPlayerSpatialHashSubsystem.generated.h"
+
+class APawn;
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesPlayerSpatialHashSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// =========================================================================
+	// Build (Server)
+	// =========================================================================
+
+	/** 이번 프레임에 아직 안 만들었으면 재구성 (질의 전 게임 스레드에서 호출) */
+	void RefreshIfStale_Server();
+
+	// =========================================================================
+	// Query (Server, 읽기 전용)
+	// =========================================================================
+
+	/**
+	 * Origin 기준 Radius가 걸치는 셀의 플레이어마다 Visitor(Index)
+	 * - 셀 단위 후보 → 정확한 거리 판정은 호출자 (GetTrackedLocation)
+	 */
+	template <typename VisitorType>
+	void ForEachPlayerInRadius(const FVector& Origin, float Radius, VisitorType&& Visitor) const;
+
+	int32 GetNumTracked() const { return Entries.Num(); }
+	APawn* GetTrackedPawn(int32 Index) const { return Entries[Index].Pawn.Get(); }
+	const FVector& GetTrackedLocation(int32 Index) const { return Entries[Index].Location; }
+
+public:
+	/** 셀 한 변 (cm). 좀비 획득 반경(1500) 기준 질의당 대략 3x3~4x4 셀 */
+	static constexpr float CellSize = 1000.0f;
+
+private:
+	void Rebuild_Server();
+
+	static FIntPoint ToCell(const FVector& Location)
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+	}
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		FVector Location = FVector::ZeroVector;
+	};
+
+	TArray<FEntry> Entries;
+
+	/** 셀 → Entries 인덱스 */
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> Cells;
+
+	uint64 LastBuildFrame = MAX_uint64;
+};
+
+template <typename VisitorType>
+void UMosesPlayerSpatialHashSubsystem::ForEachPlayerInRadius(const FVector& Origin, float Radius, VisitorType&& Visitor) const
+{
+	const FIntPoint MinCell = ToCell(Origin - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = ToCell(Origin + FVector(Radius, Radius, 0.0f));
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const TArray<int32, TInlineAllocator<4>>* Cell = Cells.Find(FIntPoint(CellX, CellY));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const int32 Index : *Cell)
+			{
+				Visitor(Index);
+			}
+		}
+	}
+}
@@ -0,0 +1,676 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesProjectileManagerSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectileManagerSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/MosesStats.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectileReplicator.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesRadialDamage.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesGrenadeProjectile.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponData.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponRegistrySubsystem.h"
+
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "Async/ParallelFor.h"
+#include "Kismet/GameplayStatics.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+
+namespace MosesProjectileManager_Private
+{
+	static float GetServerTime(const UWorld* World)
+	{
+		const AGameStateBase* GS = World ? World->GetGameState() : nullptr;
+		return GS ? GS->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0f);
+	}
+
+	static const UMosesWeaponRegistrySubsystem* GetRegistry(const UWorld* World)
+	{
+		const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		return GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr;
+	}
+
+	/** Sweep 1건 결과 슬롯 (ParallelFor 결과 → 순차 해석) */
+	struct FSweepResult
+	{
+		FHitResult Hit;
+		FVector NewPosition = FVector::ZeroVector;
+		bool bHit = false;
+	};
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesProjectileManagerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesProjectileManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Projectiles.Reserve(64);
+}
+
+void UMosesProjectileManagerSubsystem::Deinitialize()
+{
+	Projectiles.Reset();
+	TypeCache.Reset();
+	Replicator.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UMosesProjectileManagerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMosesProjectileManagerSubsystem, STATGROUP_Tickables);
+}
+
+void UMosesProjectileManagerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const bool bWasActive = Projectiles.Num() > 0;
+	if (bWasActive)
+	{
+		StepSimulation(DeltaTime);
+	}
+
+	// 마지막 Projectile이 빠진 프레임도 한 번 갱신 (ISM 비우기)
+	if ((bWasActive || bVisualsActive) && GetWorld()->GetNetMode() != NM_DedicatedServer)
+	{
+		UpdateVisuals_Local();
+		bVisualsActive = Projectiles.Num() > 0;
+	}
+}
+
+bool UMosesProjectileManagerSubsystem::IsServer() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+// ============================================================================
+// Type
+// ============================================================================
+
+const FMosesSimProjectileType* UMosesProjectileManagerSubsystem::ResolveType(uint8 WeaponNetIndex)
+{
+	if (const FMosesSimProjectileType* Cached = TypeCache.Find(WeaponNetIndex))
+	{
+		return Cached->WeaponData.IsValid() ? Cached : nullptr;
+	}
+
+	const UWorld* World = GetWorld();
+	const UMosesWeaponRegistrySubsystem* Registry = MosesProjectileManager_Private::GetRegistry(World);
+	const UMosesWeaponData* WeaponData = Registry ? Registry->ResolveWeaponData(Registry->GetWeaponIdByNetIndex(WeaponNetIndex)) : nullptr;
+	if (!WeaponData || !WeaponData->ProjectileClass)
+	{
+		return nullptr;
+	}
+
+	// ProjectileClass CDO = 탄도/FX 정의 (액터 경로와 같은 에셋을 그대로 사용)
+	const AMosesGrenadeProjectile* CDO = WeaponData->ProjectileClass->GetDefaultObject<AMosesGrenadeProjectile>();
+
+	FMosesSimProjectileType& Type = TypeCache.Add(WeaponNetIndex);
+	Type.WeaponData = WeaponData;
+	Type.GravityZ = World->GetGravityZ() * CDO->GetSimGravityScale();
+	Type.CollisionRadius = CDO->GetSimCollisionRadius();
+	Type.MaxLifetime = FMath::Max(0.1f, WeaponData->ProjectileMaxLifetime);
+	Type.ExplosionVFX = CDO->GetExplosionVFX();
+	Type.ExplosionSFX = CDO->GetExplosionSFX();
+	Type.Mesh = CDO->GetSimulatedMesh();
+
+	return &Type;
+}
+
+FVector UMosesProjectileManagerSubsystem::EvaluatePosition(const FMosesSimProjectile& Projectile, const FMosesSimProjectileType& Type, float Age) const
+{
+	return Projectile.Origin
+		+ Projectile.Velocity * Age
+		+ FVector(0.0f, 0.0f, 0.5f * Type.GravityZ * Age * Age);
+}
+
+// ============================================================================
+// Launch (Server)
+// ============================================================================
+
+uint32 UMosesProjectileManagerSubsystem::Launch_Server(
+	const UMosesWeaponData* WeaponData,
+	const FVector& Origin,
+	const FVector& Dir,
+	UAbilitySystemComponent* SourceASC,
+	TSubclassOf<UGameplayEffect> DamageGE,
+	float Damage,
+	AController* InstigatorController,
+	APawn* OwnerPawn,
+	uint16 PredictionShotSeq)
+{
+	if (!IsServer() || !WeaponData)
+	{
+		return 0;
+	}
+
+	if (Projectiles.Num() >= MaxActiveProjectiles)
+	{
+		UE_LOG(LogMosesCombat, Warning, TEXT("[PROJ][SV] Launch FAIL (Cap) Active=%d"), Projectiles.Num());
+		return 0;
+	}
+
+	const UMosesWeaponRegistrySubsystem* Registry = MosesProjectileManager_Private::GetRegistry(GetWorld());
+	const uint8 WeaponNetIndex = Registry ? Registry->GetWeaponNetIndex(WeaponData->WeaponId) : 0;
+	const FMosesSimProjectileType* Type = (WeaponNetIndex != 0) ? ResolveType(WeaponNetIndex) : nullptr;
+	if (!Type)
+	{
+		UE_LOG(LogMosesCombat, Warning, TEXT("[PROJ][SV] Launch FAIL (Type) Weapon=%s NetIndex=%d"),
+			*WeaponData->WeaponId.ToString(), WeaponNetIndex);
+		return 0;
+	}
+
+	AMosesProjectileReplicator* Rep = GetOrSpawnReplicator_Server();
+	if (!Rep)
+	{
+		return 0;
+	}
+
+	FMosesSimProjectile& Projectile = Projectiles.AddDefaulted_GetRef();
+	Projectile.ProjectileId = NextProjectileId++;
+	Projectile.WeaponNetIndex = WeaponNetIndex;
+	Projectile.Seed = static_cast<int32>(Projectile.ProjectileId * 2654435761u);
+	Projectile.Origin = Origin;
+	Projectile.Velocity = Dir.GetSafeNormal() * FMath::Max(1.0f, WeaponData->ProjectileSpeed);
+	Projectile.Position = Origin;
+	Projectile.IgnoreActor = OwnerPawn;
+	Projectile.SourceASC = SourceASC;
+	Projectile.DamageGE = DamageGE;
+	Projectile.InstigatorController = InstigatorController;
+	Projectile.Damage = FMath::Max(0.0f, Damage);
+
+	FMosesSimProjectileLaunch Launch;
+	Launch.ProjectileId = Projectile.ProjectileId;
+	Launch.WeaponNetIndex = WeaponNetIndex;
+	Launch.Origin = Projectile.Origin;
+	Launch.Velocity = Projectile.Velocity;
+	Launch.Seed = Projectile.Seed;
+	Launch.ServerLaunchTime = MosesProjectileManager_Private::GetServerTime(GetWorld());
+	Launch.IgnoreActor = OwnerPawn;
+	Launch.PredictionShotSeq = PredictionShotSeq;
+
+	Rep->AddLaunch_Server(Launch);
+
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[PROJ][SV] Launch Id=%u Weapon=%s Origin=%s Active=%d"),
+		Projectile.ProjectileId, *WeaponData->WeaponId.ToString(), *Origin.ToCompactString(), Projectiles.Num());
+
+	return Projectile.ProjectileId;
+}
+
+AMosesProjectileReplicator* UMosesProjectileManagerSubsystem::GetOrSpawnReplicator_Server()
+{
+	if (AMosesProjectileReplicator* Existing = Replicator.Get())
+	{
+		return Existing;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AMosesProjectileReplicator* Spawned = World->SpawnActor<AMosesProjectileReplicator>(AMosesProjectileReplicator::StaticClass(), FTransform::Identity, Params);
+	RegisterReplicator(Spawned);
+
+	return Spawned;
+}
+
+// ============================================================================
+// Prediction (Owning client)
+// ============================================================================
+
+void UMosesProjectileManagerSubsystem::PredictLaunch_Local(const UMosesWeaponData* WeaponData, const FVector& Origin, const FVector& Dir, APawn* OwnerPawn, uint16 ShotSeq)
+{
+	UWorld* World = GetWorld();
+	if (IsServer() || !WeaponData || !WeaponData->ProjectileClass || !OwnerPawn || Projectiles.Num() >= MaxActiveProjectiles)
+	{
+		return;
+	}
+
+	const UMosesWeaponRegistrySubsystem* Registry = MosesProjectileManager_Private::GetRegistry(World);
+	const uint8 WeaponNetIndex = Registry ? Registry->GetWeaponNetIndex(WeaponData->WeaponId) : 0;
+	const FMosesSimProjectileType* Type = (WeaponNetIndex != 0) ? ResolveType(WeaponNetIndex) : nullptr;
+	if (!Type)
+	{
+		return;
+	}
+
+	FMosesSimProjectile& Projectile = Projectiles.AddDefaulted_GetRef();
+	Projectile.WeaponNetIndex = WeaponNetIndex;
+	Projectile.Origin = Origin;
+	Projectile.Velocity = Dir.GetSafeNormal() * FMath::Max(1.0f, WeaponData->ProjectileSpeed);
+	Projectile.Position = Origin;
+	Projectile.IgnoreActor = OwnerPawn;
+	Projectile.bPredicted = true;
+	Projectile.PredictionShotSeq = ShotSeq;
+
+	// 시뮬레이션 메쉬가 없는 타입(액터 경로) → BP 비주얼 그대로 쓰는 로컬 코스메틱 액터
+	if (!Type->Mesh.IsValid())
+	{
+		FActorSpawnParameters Params;
+		Params.Owner = OwnerPawn;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		if (AMosesGrenadeProjectile* Cosmetic = World->SpawnActor<AMosesGrenadeProjectile>(WeaponData->ProjectileClass, Origin, Dir.Rotation(), Params))
+		{
+			Cosmetic->InitCosmetic_Local(PredictionTimeoutSec + 1.0f);
+			Projectile.CosmeticActor = Cosmetic;
+		}
+	}
+
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[PROJ][CL] Predict Seq=%u Weapon=%s Cosmetic=%d"),
+		ShotSeq, *WeaponData->WeaponId.ToString(), Projectile.CosmeticActor.IsValid() ? 1 : 0);
+}
+
+bool UMosesProjectileManagerSubsystem::ConsumePrediction_Local(const AActor* OwnerPawn, uint16 ShotSeq, FVector& OutPredictedLocation)
+{
+	const int32 Index = FindPrediction(OwnerPawn, ShotSeq);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutPredictedLocation = Projectiles[Index].Position;
+	RemoveProjectileAt(Index);
+
+	return true;
+}
+
+void UMosesProjectileManagerSubsystem::DiscardPrediction_Local(const AActor* OwnerPawn, uint16 ShotSeq)
+{
+	const int32 Index = FindPrediction(OwnerPawn, ShotSeq);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[PROJ][CL] Predict DISCARD (Rejected) Seq=%u"), ShotSeq);
+	RemoveProjectileAt(Index);
+}
+
+int32 UMosesProjectileManagerSubsystem::FindPrediction(const AActor* OwnerPawn, uint16 ShotSeq) const
+{
+	if (!OwnerPawn || ShotSeq == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	return Projectiles.IndexOfByPredicate([OwnerPawn, ShotSeq](const FMosesSimProjectile& Projectile)
+	{
+		return Projectile.bPredicted
+			&& Projectile.PredictionShotSeq == ShotSeq
+			&& Projectile.IgnoreActor.Get() == OwnerPawn;
+	});
+}
+
+void UMosesProjectileManagerSubsystem::RemoveProjectileAt(int32 Index)
+{
+	if (AActor* Cosmetic = Projectiles[Index].CosmeticActor.Get())
+	{
+		Cosmetic->Destroy();
+	}
+
+	Projectiles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// ============================================================================
+// Replicator callbacks
+// ============================================================================
+
+void UMosesProjectileManagerSubsystem::RegisterReplicator(AMosesProjectileReplicator* InReplicator)
+{
+	Replicator = InReplicator;
+}
+
+void UMosesProjectileManagerSubsystem::HandleLaunchReplicated_Local(const FMosesSimProjectileLaunch& Launch)
+{
+	if (IsServer())
+	{
+		return;
+	}
+
+	const FMosesSimProjectileType* Type = ResolveType(Launch.WeaponNetIndex);
+	if (!Type)
+	{
+		return;
+	}
+
+	// 발사자 본인 예측이 있으면 인수 (목록 변경 → 새 항목 추가 전에)
+	FVector PredictedLocation = FVector::ZeroVector;
+	const bool bHadPrediction = (Launch.PredictionShotSeq != 0)
+		&& ConsumePrediction_Local(Launch.IgnoreActor, Launch.PredictionShotSeq, PredictedLocation);
+
+	// 늦게 받은 만큼 앞당겨 시작 (수명 지났으면 스킵)
+	const float Age = FMath::Max(0.0f, MosesProjectileManager_Private::GetServerTime(GetWorld()) - Launch.ServerLaunchTime);
+	if (Age >= Type->MaxLifetime)
+	{
+		return;
+	}
+
+	FMosesSimProjectile& Projectile = Projectiles.AddDefaulted_GetRef();
+	Projectile.ProjectileId = Launch.ProjectileId;
+	Projectile.WeaponNetIndex = Launch.WeaponNetIndex;
+	Projectile.Seed = Launch.Seed;
+	Projectile.Origin = Launch.Origin;
+	Projectile.Velocity = Launch.Velocity;
+	Projectile.Age = Age;
+	Projectile.Position = EvaluatePosition(Projectile, *Type, Age);
+	Projectile.IgnoreActor = Launch.IgnoreActor;
+
+	if (bHadPrediction)
+	{
+		// 비주얼은 예측 위치에서 시작 → PredictionCorrectionSec 동안 권위 위치로
+		Projectile.VisualOffset = PredictedLocation - Projectile.Position;
+		Projectile.VisualOffsetRemaining = PredictionCorrectionSec;
+	}
+}
+
+void UMosesProjectileManagerSubsystem::HandleLaunchRemoved_Local(uint32 ProjectileId)
+{
+	if (IsServer())
+	{
+		return;
+	}
+
+	const int32 Index = Projectiles.IndexOfByPredicate([ProjectileId](const FMosesSimProjectile& Projectile)
+	{
+		return Projectile.ProjectileId == ProjectileId;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		RemoveProjectileAt(Index);
+	}
+}
+
+void UMosesProjectileManagerSubsystem::HandleImpact_Local(uint32 ProjectileId, uint8 WeaponNetIndex, const FVector& Location, const FVector& Normal)
+{
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	const int32 Index = Projectiles.IndexOfByPredicate([ProjectileId](const FMosesSimProjectile& Projectile)
+	{
+		return Projectile.ProjectileId == ProjectileId;
+	});
+
+	// 서버(리슨)는 StepSimulation에서 이미 제거됨 → 여기 오는 건 클라 사본
+	if (Index != INDEX_NONE)
+	{
+		RemoveProjectileAt(Index);
+	}
+
+	// 발사 항목을 못 받은 클라도 FX는 재생 (타입은 RPC로 전달)
+	if (const FMosesSimProjectileType* Type = ResolveType(WeaponNetIndex))
+	{
+		PlayImpactFX_Local(*Type, Location, Normal);
+	}
+}
+
+// ============================================================================
+// Simulation
+// ============================================================================
+
+void UMosesProjectileManagerSubsystem::StepSimulation(float DeltaTime)
+{
+	using namespace MosesProjectileManager_Private;
+
+	SCOPE_CYCLE_COUNTER(STAT_MosesSimProjectileTick);
+
+	UWorld* World = GetWorld();
+	const bool bServer = IsServer();
+
+	// -------------------------------------------------------------------------
+	// (1) 타입/무시 액터 해석 (게임 스레드: 캐시 조회 + WeakPtr 해제)
+	// -------------------------------------------------------------------------
+	const int32 Num = Projectiles.Num();
+
+	TArray<const FMosesSimProjectileType*, TInlineAllocator<64>> Types;
+	TArray<const AActor*, TInlineAllocator<64>> IgnoreActors;
+	Types.SetNumUninitialized(Num);
+	IgnoreActors.SetNumUninitialized(Num);
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		Types[Index] = ResolveType(Projectiles[Index].WeaponNetIndex);
+		IgnoreActors[Index] = Projectiles[Index].IgnoreActor.Get();
+	}
+
+	// -------------------------------------------------------------------------
+	// (2) Sweep 묶음 (읽기 전용 씬 쿼리 → 워커 병렬, 결과는 인덱스 슬롯)
+	// -------------------------------------------------------------------------
+	TArray<FSweepResult, TInlineAllocator<64>> Results;
+	Results.SetNum(Num);
+
+	ParallelFor(Num, [this, World, DeltaTime, &Types, &IgnoreActors, &Results](int32 Index)
+	{
+		const FMosesSimProjectile& Projectile = Projectiles[Index];
+		const FMosesSimProjectileType* Type = Types[Index];
+		FSweepResult& Result = Results[Index];
+
+		if (!Type || Projectile.bStopped)
+		{
+			Result.NewPosition = Projectile.Position;
+			return;
+		}
+
+		Result.NewPosition = EvaluatePosition(Projectile, *Type, Projectile.Age + DeltaTime);
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(Moses_SimProjectileSweep), false, IgnoreActors[Index]);
+
+		Result.bHit = World->SweepSingleByChannel(
+			Result.Hit,
+			Projectile.Position,
+			Result.NewPosition,
+			FQuat::Identity,
+			ECC_WorldDynamic,
+			FCollisionShape::MakeSphere(Type->CollisionRadius),
+			QueryParams);
+	},
+	Num < MinParallelSweeps ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// -------------------------------------------------------------------------
+	// (3) 순차 해석 (서버: 폭발/수명 만료, 클라: 정지/정리)
+	// -------------------------------------------------------------------------
+	for (int32 Index = Num - 1; Index >= 0; --Index)
+	{
+		FMosesSimProjectile& Projectile = Projectiles[Index];
+		const FMosesSimProjectileType* Type = Types[Index];
+		const FSweepResult& Result = Results[Index];
+
+		if (!Type)
+		{
+			RemoveProjectileAt(Index);
+			continue;
+		}
+
+		Projectile.Age += DeltaTime;
+		Projectile.VisualOffsetRemaining = FMath::Max(0.0f, Projectile.VisualOffsetRemaining - DeltaTime);
+
+		const bool bExpired = Projectile.Age >= Type->MaxLifetime;
+
+		if (bServer)
+		{
+			if (Result.bHit || bExpired)
+			{
+				const FVector Location = Result.bHit ? FVector(Result.Hit.ImpactPoint) : Result.NewPosition;
+				const FVector Normal = Result.bHit ? FVector(Result.Hit.ImpactNormal) : FVector::UpVector;
+
+				// Explode 내부 Multicast가 (리슨) 로컬 FX 처리 → 그 전에 목록에서 뺄 사본
+				const FMosesSimProjectile Exploded = Projectile;
+				Projectiles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+				Explode_Server(Exploded, *Type, Location, Normal);
+				continue;
+			}
+		}
+		else
+		{
+			// 권위 발사가 끝내 안 옴 (거절 Ack 유실/서버 스폰 실패)
+			if (Projectile.bPredicted && Projectile.Age >= PredictionTimeoutSec)
+			{
+				RemoveProjectileAt(Index);
+				continue;
+			}
+
+			if (Result.bHit && !Projectile.bStopped)
+			{
+				// 서버 폭발 Multicast / 항목 제거 대기 (충돌 지점에 정지)
+				Projectile.bStopped = true;
+				Projectile.Position = Result.Hit.Location;
+				continue;
+			}
+
+			// 서버 정리가 끝내 안 오면 로컬 수명 + 여유 후 제거
+			if (Projectile.Age >= Type->MaxLifetime + 1.0f)
+			{
+				RemoveProjectileAt(Index);
+				continue;
+			}
+		}
+
+		if (!Projectile.bStopped)
+		{
+			Projectile.Position = Result.NewPosition;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_MosesSimProjectilesActive, Projectiles.Num());
+}
+
+void UMosesProjectileManagerSubsystem::Explode_Server(const FMosesSimProjectile& Projectile, const FMosesSimProjectileType& Type, const FVector& Location, const FVector& Normal)
+{
+	UWorld* World = GetWorld();
+	const UMosesWeaponData* WeaponData = Type.WeaponData.Get();
+	if (!World || !WeaponData)
+	{
+		return;
+	}
+
+	AActor* IgnoreActor = Projectile.IgnoreActor.Get();
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(Moses_SimProjectileOverlap), false, IgnoreActor);
+
+	FMosesRadialDamageParams RadialParams;
+	RadialParams.BaseDamage = Projectile.Damage;
+	RadialParams.OuterRadius = FMath::Max(10.0f, WeaponData->ExplosionRadius);
+	RadialParams.InnerRadius = WeaponData->ResolveExplosionInnerRadius(RadialParams.OuterRadius);
+	RadialParams.FalloffExponent = WeaponData->ExplosionFalloffExponent;
+	RadialParams.MinDamageScale = WeaponData->ExplosionMinDamageScale;
+	RadialParams.bRequireLineOfSight = WeaponData->bExplosionRequiresLineOfSight;
+	RadialParams.ImpactNormal = Normal;
+
+	TArray<FMosesRadialDamageTarget> Targets;
+	FMosesRadialDamage::CollectTargets(World, Location, RadialParams, Params, Targets);
+
+	FMosesRadialDamageSource Source;
+	Source.SourceASC = Projectile.SourceASC.Get();
+	Source.DamageGE = Projectile.DamageGE;
+	Source.InstigatorController = Projectile.InstigatorController.Get();
+	Source.DamageCauser = IgnoreActor;
+	Source.WeaponData = WeaponData;
+
+	const int32 HitCount = FMosesRadialDamage::ApplyToTargets_Server(World, Location, Targets, Source);
+
+	if (AMosesProjectileReplicator* Rep = Replicator.Get())
+	{
+		Rep->RemoveLaunch_Server(Projectile.ProjectileId);
+		Rep->Multicast_Impact(Projectile.ProjectileId, Projectile.WeaponNetIndex, Location, Normal);
+	}
+
+	UE_LOG(LogMosesCombat, Log, TEXT("[PROJ][SV] Explode Id=%u Weapon=%s Loc=%s Age=%.2f Hits=%d"),
+		Projectile.ProjectileId,
+		*WeaponData->WeaponId.ToString(),
+		*Location.ToCompactString(),
+		Projectile.Age,
+		HitCount);
+}
+
+// ============================================================================
+// Local (FX / Visual)
+// ============================================================================
+
+void UMosesProjectileManagerSubsystem::PlayImpactFX_Local(const FMosesSimProjectileType& Type, const FVector& Location, const FVector& Normal) const
+{
+	UWorld* World = GetWorld();
+
+	if (UParticleSystem* VFX = Type.ExplosionVFX.Get())
+	{
+		UGameplayStatics::SpawnEmitterAtLocation(World, VFX, FTransform(Normal.Rotation(), Location));
+	}
+
+	if (USoundBase* SFX = Type.ExplosionSFX.Get())
+	{
+		UGameplayStatics::PlaySoundAtLocation(World, SFX, Location);
+	}
+}
+
+void UMosesProjectileManagerSubsystem::UpdateVisuals_Local()
+{
+	AMosesProjectileReplicator* Rep = Replicator.Get();
+	if (!Rep)
+	{
+		return;
+	}
+
+	// 타입별 Transform 묶음 → ISM 1회 갱신
+	TMap<uint8, TArray<FTransform>, TInlineSetAllocator<4>> TransformsByType;
+
+	for (const FMosesSimProjectile& Projectile : Projectiles)
+	{
+		const FVector Dir = Projectile.Velocity + FVector(0.0f, 0.0f, TypeCache.FindChecked(Projectile.WeaponNetIndex).GravityZ * Projectile.Age);
+
+		// Seed = 발사별 롤 변주 (같은 Projectile은 모든 머신에서 같은 모양)
+		FRotator Rotation = Dir.Rotation();
+		Rotation.Roll = static_cast<float>(Projectile.Seed & 0xFF) * (360.0f / 256.0f);
+
+		const float OffsetAlpha = Projectile.VisualOffsetRemaining / PredictionCorrectionSec;
+		const FVector VisualLocation = Projectile.Position + Projectile.VisualOffset * OffsetAlpha;
+
+		if (AActor* Cosmetic = Projectile.CosmeticActor.Get())
+		{
+			Cosmetic->SetActorLocationAndRotation(VisualLocation, Rotation);
+			continue;
+		}
+
+		TransformsByType.FindOrAdd(Projectile.WeaponNetIndex).Emplace(Rotation, VisualLocation);
+	}
+
+	TArray<uint8, TInlineAllocator<4>> ActiveTypes;
+	for (const TPair<uint8, TArray<FTransform>>& Pair : TransformsByType)
+	{
+		const FMosesSimProjectileType& Type = TypeCache.FindChecked(Pair.Key);
+		Rep->UpdateVisuals_Local(Pair.Key, Type.Mesh.Get(), Pair.Value);
+		ActiveTypes.Add(Pair.Key);
+	}
+
+	Rep->ClearVisualsExcept_Local(ActiveTypes);
+}
@@ -0,0 +1,198 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesProjectileManagerSubsystem.h
+// ----------------------------------------------------------------------------
+// Projectile Manager (Server 권위 + Client 로컬 시뮬레이션)
+// - Projectile = 구조체 (액터/컴포넌트/채널 없음) → 수백 발 동시 비행 목표
+// - 탄도 = 닫힌 식 P(t) = Origin + V*t + 0.5*G*t^2
+//   · 서버/클라가 같은 식 → 누적 오차 없음, 늦게 받은 클라는 경과 시간만큼 앞당겨 시작
+// - 충돌 = 프레임당 전 Projectile Sweep(직전 위치 → 현재 위치)을 한 묶음으로 (ParallelFor)
+//   → 결과 슬롯을 순서대로 해석 (서버: 폭발 / 클라: 정지 후 서버 폭발 대기)
+// - 타입 정의 = UMosesWeaponData (데미지/반경/감쇠/수명) + ProjectileClass CDO (중력/충돌 반경/FX/메쉬)
+//   → AMosesGrenadeProjectile은 "액터 경로"와 "시뮬레이션 타입 정의" 겸용
+// - 폭발 데미지 = FMosesRadialDamage (유탄 액터와 동일 경로)
+// - 발사자 클라 예측: 같은 발사 파라미터로 코스메틱 Projectile 즉시 시작
+//   → 권위 Projectile(액터/시뮬레이션)이 (발사자, ShotSeq)로 인수, 비주얼은 짧게 보간 보정
+//   → 서버 거절 Ack / 타임아웃이면 폐기
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+#include "MosesProjectileManagerSubsystem.generated.h"
+
+class AController;
+class APawn;
+class AMosesProjectileReplicator;
+class UAbilitySystemComponent;
+class UGameplayEffect;
+class UMosesWeaponData;
+class UParticleSystem;
+class USoundBase;
+class UStaticMesh;
+struct FMosesSimProjectileLaunch;
+
+/** 타입 캐시 (WeaponNetIndex 단위) */
+struct FMosesSimProjectileType
+{
+	TWeakObjectPtr<const UMosesWeaponData> WeaponData;
+
+	/** 월드 중력 * ProjectileGravityScale */
+	float GravityZ = 0.0f;
+	float CollisionRadius = 12.0f;
+	float MaxLifetime = 5.0f;
+
+	TWeakObjectPtr<UParticleSystem> ExplosionVFX;
+	TWeakObjectPtr<USoundBase> ExplosionSFX;
+	TWeakObjectPtr<UStaticMesh> Mesh;
+};
+
+/** 비행 중 Projectile 1발 */
+struct FMosesSimProjectile
+{
+	uint32 ProjectileId = 0;
+	uint8 WeaponNetIndex = 0;
+	int32 Seed = 0;
+
+	FVector Origin = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+
+	/** 발사 후 경과 시간 */
+	float Age = 0.0f;
+	FVector Position = FVector::ZeroVector;
+
+	TWeakObjectPtr<AActor> IgnoreActor;
+
+	/** 클라: 로컬 충돌로 정지 (서버 폭발/제거 대기) */
+	bool bStopped = false;
+
+	/** 발사자 클라 예측 (권위 Projectile 도착 전까지만) */
+	bool bPredicted = false;
+	uint16 PredictionShotSeq = 0;
+
+	/** 예측 → 권위 전환 보정 (남은 시간 동안 0으로 감쇠) */
+	FVector VisualOffset = FVector::ZeroVector;
+	float VisualOffsetRemaining = 0.0f;
+
+	/** 예측 비주얼: 타입 Mesh가 없으면 ProjectileClass 로컬 코스메틱 액터 */
+	TWeakObjectPtr<AActor> CosmeticActor;
+
+	// ---- Server only ----
+	TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
+	TSubclassOf<UGameplayEffect> DamageGE;
+	TWeakObjectPtr<AController> InstigatorController;
+	float Damage = 0.0f;
+};
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesProjectileManagerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// =========================================================================
+	// Launch (Server)
+	// =========================================================================
+
+	/**
+	 * 시뮬레이션 Projectile 발사
+	 * @return ProjectileId (0 = 실패/상한 → 호출측 액터 경로 폴백)
+	 */
+	uint32 Launch_Server(
+		const UMosesWeaponData* WeaponData,
+		const FVector& Origin,
+		const FVector& Dir,
+		UAbilitySystemComponent* SourceASC,
+		TSubclassOf<UGameplayEffect> DamageGE,
+		float Damage,
+		AController* InstigatorController,
+		APawn* OwnerPawn,
+		uint16 PredictionShotSeq = 0);
+
+	// =========================================================================
+	// Prediction (Owning client)
+	// =========================================================================
+
+	/** 발사자 클라: 서버와 같은 원점/방향/속도로 코스메틱 Projectile 시작 */
+	void PredictLaunch_Local(const UMosesWeaponData* WeaponData, const FVector& Origin, const FVector& Dir, APawn* OwnerPawn, uint16 ShotSeq);
+
+	/** 권위 Projectile 도착 → 예측 제거 + 현재 예측 위치 반환 (보정 시작점) */
+	bool ConsumePrediction_Local(const AActor* OwnerPawn, uint16 ShotSeq, FVector& OutPredictedLocation);
+
+	/** 서버 거절 → 예측 폐기 */
+	void DiscardPrediction_Local(const AActor* OwnerPawn, uint16 ShotSeq);
+
+	// =========================================================================
+	// Replicator callbacks
+	// =========================================================================
+	void RegisterReplicator(AMosesProjectileReplicator* InReplicator);
+
+	/** 클라: 복제된 발사 → 로컬 시뮬레이션 시작 */
+	void HandleLaunchReplicated_Local(const FMosesSimProjectileLaunch& Launch);
+
+	/** 클라: 발사 항목 제거 (폭발 RPC 유실 대비 정리) */
+	void HandleLaunchRemoved_Local(uint32 ProjectileId);
+
+	/** 폭발 Multicast 수신 (클라 정리 + FX, 데디는 스킵) */
+	void HandleImpact_Local(uint32 ProjectileId, uint8 WeaponNetIndex, const FVector& Location, const FVector& Normal);
+
+	int32 GetNumActive() const { return Projectiles.Num(); }
+
+public:
+	static constexpr int32 MaxActiveProjectiles = 512;
+
+	/** 이 개수 미만 Sweep은 단일 스레드 */
+	static constexpr int32 MinParallelSweeps = 16;
+
+	/** 권위 발사가 이 시간 안에 안 오면 예측 폐기 (유실/서버 스폰 실패) */
+	static constexpr float PredictionTimeoutSec = 1.0f;
+
+	/** 예측 위치 → 권위 위치 보간 시간 */
+	static constexpr float PredictionCorrectionSec = 0.15f;
+
+private:
+	const FMosesSimProjectileType* ResolveType(uint8 WeaponNetIndex);
+
+	AMosesProjectileReplicator* GetOrSpawnReplicator_Server();
+
+	int32 FindPrediction(const AActor* OwnerPawn, uint16 ShotSeq) const;
+
+	/** 목록 제거 (예측 코스메틱 액터 정리 포함) */
+	void RemoveProjectileAt(int32 Index);
+
+	FVector EvaluatePosition(const FMosesSimProjectile& Projectile, const FMosesSimProjectileType& Type, float Age) const;
+
+	/** 전 Projectile 한 스텝: Sweep 묶음 → 순차 해석 */
+	void StepSimulation(float DeltaTime);
+
+	void Explode_Server(const FMosesSimProjectile& Projectile, const FMosesSimProjectileType& Type, const FVector& Location, const FVector& Normal);
+
+	void PlayImpactFX_Local(const FMosesSimProjectileType& Type, const FVector& Location, const FVector& Normal) const;
+
+	void UpdateVisuals_Local();
+
+	bool IsServer() const;
+
+private:
+	TArray<FMosesSimProjectile> Projectiles;
+
+	TMap<uint8, FMosesSimProjectileType> TypeCache;
+
+	TWeakObjectPtr<AMosesProjectileReplicator> Replicator;
+
+	uint32 NextProjectileId = 1;
+
+	/** ISM에 인스턴스가 남아 있을 수 있음 */
+	bool bVisualsActive = false;
+};
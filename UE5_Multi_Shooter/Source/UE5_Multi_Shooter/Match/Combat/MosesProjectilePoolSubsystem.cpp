@@ -0,0 +1,186 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesProjectilePoolSubsystem.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectilePoolSubsystem.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesGrenadeProjectile.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponRegistrySubsystem.h"
+
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/Pawn.h"
+
+namespace MosesProjectilePool_Private
+{
+	static bool IsServerWorld(const UWorld* World)
+	{
+		return World && World->GetNetMode() != NM_Client;
+	}
+
+	/** 대기 위치: 월드 밖 (숨김 + 충돌 OFF라 위치는 Relevancy/컬링에만 영향) */
+	static const FVector DormantLocation(0.0f, 0.0f, -100000.0f);
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+bool UMosesProjectilePoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
+}
+
+void UMosesProjectilePoolSubsystem::Deinitialize()
+{
+	// 액터는 월드와 함께 정리된다
+	Pools.Reset();
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// Prewarm
+// ============================================================================
+
+void UMosesProjectilePoolSubsystem::PrewarmFromWeaponRegistry_Server()
+{
+	UWorld* World = GetWorld();
+	if (!MosesProjectilePool_Private::IsServerWorld(World))
+	{
+		return;
+	}
+
+	const UGameInstance* GI = World->GetGameInstance();
+	const UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr;
+	if (!Registry)
+	{
+		return;
+	}
+
+	TArray<TSubclassOf<AMosesGrenadeProjectile>> Classes;
+	Registry->GetProjectileClasses(Classes);
+
+	for (const TSubclassOf<AMosesGrenadeProjectile>& Class : Classes)
+	{
+		Prewarm_Server(Class, PrewarmCountPerClass);
+	}
+}
+
+void UMosesProjectilePoolSubsystem::Prewarm_Server(TSubclassOf<AMosesGrenadeProjectile> Class, int32 Count)
+{
+	if (!Class || !MosesProjectilePool_Private::IsServerWorld(GetWorld()))
+	{
+		return;
+	}
+
+	FClassPool& Pool = Pools.FindOrAdd(Class.Get());
+	Pool.Free.RemoveAll([](const TWeakObjectPtr<AMosesGrenadeProjectile>& Entry) { return !Entry.IsValid(); });
+
+	const int32 Target = FMath::Min(Count, MaxPooledPerClass);
+	int32 NumAdded = 0;
+
+	while (Pool.Free.Num() < Target && Pool.NumSpawned < MaxPooledPerClass)
+	{
+		AMosesGrenadeProjectile* Projectile = SpawnPooled_Server(Class, MosesProjectilePool_Private::DormantLocation, FRotator::ZeroRotator);
+		if (!Projectile)
+		{
+			break;
+		}
+
+		Projectile->DeactivateToPool_Server();
+		Pool.Free.Add(Projectile);
+		++NumAdded;
+	}
+
+	UE_LOG(LogMosesCombat, Log, TEXT("[GRENADE][SV] Pool Prewarm Class=%s Added=%d Free=%d Spawned=%d"),
+		*GetNameSafe(Class.Get()), NumAdded, Pool.Free.Num(), Pool.NumSpawned);
+}
+
+// ============================================================================
+// Acquire / Release
+// ============================================================================
+
+AMosesGrenadeProjectile* UMosesProjectilePoolSubsystem::Acquire_Server(TSubclassOf<AMosesGrenadeProjectile> Class, const FVector& Location, const FRotator& Rotation, APawn* OwnerPawn)
+{
+	if (!Class || !MosesProjectilePool_Private::IsServerWorld(GetWorld()))
+	{
+		return nullptr;
+	}
+
+	FClassPool& Pool = Pools.FindOrAdd(Class.Get());
+
+	AMosesGrenadeProjectile* Projectile = nullptr;
+	while (!Projectile && Pool.Free.Num() > 0)
+	{
+		Projectile = Pool.Free.Pop(EAllowShrinking::No).Get();
+	}
+
+	if (!Projectile)
+	{
+		// 풀 고갈: 즉석 스폰 (상한 이내면 반납 시 풀 편입)
+		Projectile = SpawnPooled_Server(Class, Location, Rotation);
+		if (!Projectile)
+		{
+			return nullptr;
+		}
+
+		UE_LOG(LogMosesCombat, Verbose, TEXT("[GRENADE][SV] Pool Miss Class=%s Spawned=%d"),
+			*GetNameSafe(Class.Get()), Pool.NumSpawned);
+	}
+
+	Projectile->ActivateFromPool_Server(Location, Rotation, OwnerPawn);
+	return Projectile;
+}
+
+void UMosesProjectilePoolSubsystem::Release_Server(AMosesGrenadeProjectile* Projectile)
+{
+	if (!Projectile || !Projectile->IsPooledActive())
+	{
+		return;
+	}
+
+	FClassPool& Pool = Pools.FindOrAdd(Projectile->GetClass());
+
+	if (Pool.Free.Num() >= MaxPooledPerClass)
+	{
+		--Pool.NumSpawned;
+		Projectile->Destroy();
+		return;
+	}
+
+	Projectile->DeactivateToPool_Server();
+	Projectile->SetActorLocation(MosesProjectilePool_Private::DormantLocation, false, nullptr, ETeleportType::TeleportPhysics);
+	Pool.Free.Add(Projectile);
+}
+
+AMosesGrenadeProjectile* UMosesProjectilePoolSubsystem::SpawnPooled_Server(TSubclassOf<AMosesGrenadeProjectile> Class, const FVector& Location, const FRotator& Rotation)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AMosesGrenadeProjectile* Projectile = World->SpawnActor<AMosesGrenadeProjectile>(Class, Location, Rotation, Params);
+	if (!Projectile)
+	{
+		UE_LOG(LogMosesCombat, Warning, TEXT("[GRENADE][SV] Pool Spawn FAIL Class=%s"), *GetNameSafe(Class.Get()));
+		return nullptr;
+	}
+
+	Projectile->MarkPooled_Server(this);
+	++Pools.FindOrAdd(Class.Get()).NumSpawned;
+
+	return Projectile;
+}
@@ -0,0 +1,65 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesProjectilePoolSubsystem.h
+// ----------------------------------------------------------------------------
+// Projectile Pool (Server)
+// - 유탄 Projectile을 클래스별로 미리 스폰(Dormant)해 두고 발사 시 재사용
+//   · 매 발사 SpawnActor/Destroy, 액터 채널 Open/Close, 컴포넌트 Register 비용 제거
+// - Prewarm: Warmup 진입 시 (무기 레지스트리의 ProjectileClass 기준)
+// - 풀이 비면 즉석 스폰 후 풀에 편입 (상한 초과분은 반납 시 Destroy)
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+#include "UObject/ObjectKey.h"
+#include "MosesProjectilePoolSubsystem.generated.h"
+
+class AMosesGrenadeProjectile;
+class APawn;
+
+UCLASS()
+class UE5_MULTI_SHOOTER_API UMosesProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// =========================================================================
+	// Pool (Server only)
+	// =========================================================================
+
+	/** 무기 레지스트리의 모든 ProjectileClass를 클래스당 PrewarmCountPerClass개까지 채운다 */
+	void PrewarmFromWeaponRegistry_Server();
+
+	/** Class의 대기 개수가 Count가 될 때까지 스폰 */
+	void Prewarm_Server(TSubclassOf<AMosesGrenadeProjectile> Class, int32 Count);
+
+	/** 대기 Projectile을 꺼내 발사 위치로 배치 (없으면 스폰). 이후 Init/Launch는 호출측 */
+	AMosesGrenadeProjectile* Acquire_Server(TSubclassOf<AMosesGrenadeProjectile> Class, const FVector& Location, const FRotator& Rotation, APawn* OwnerPawn);
+
+	/** 폭발 후 반납 (상한 초과면 Destroy) */
+	void Release_Server(AMosesGrenadeProjectile* Projectile);
+
+public:
+	static constexpr int32 PrewarmCountPerClass = 8;
+	static constexpr int32 MaxPooledPerClass = 32;
+
+private:
+	AMosesGrenadeProjectile* SpawnPooled_Server(TSubclassOf<AMosesGrenadeProjectile> Class, const FVector& Location, const FRotator& Rotation);
+
+private:
+	struct FClassPool
+	{
+		TArray<TWeakObjectPtr<AMosesGrenadeProjectile>> Free;
+		int32 NumSpawned = 0;
+	};
+
+	TMap<TObjectKey<UClass>, FClassPool> Pools;
+};
@@ -0,0 +1,176 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesProjectileReplicator.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectileReplicator.h"
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectileManagerSubsystem.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+namespace MosesProjectileReplicator_Private
+{
+	static UMosesProjectileManagerSubsystem* GetManager(const AActor* Actor)
+	{
+		UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+		return World ? World->GetSubsystem<UMosesProjectileManagerSubsystem>() : nullptr;
+	}
+}
+
+// ============================================================================
+// FastArray callbacks (Client)
+// ============================================================================
+
+void FMosesSimProjectileLaunch::PostReplicatedAdd(const FMosesSimProjectileList& InArraySerializer)
+{
+	if (UMosesProjectileManagerSubsystem* Manager = MosesProjectileReplicator_Private::GetManager(InArraySerializer.Owner.Get()))
+	{
+		Manager->HandleLaunchReplicated_Local(*this);
+	}
+}
+
+void FMosesSimProjectileLaunch::PreReplicatedRemove(const FMosesSimProjectileList& InArraySerializer)
+{
+	if (UMosesProjectileManagerSubsystem* Manager = MosesProjectileReplicator_Private::GetManager(InArraySerializer.Owner.Get()))
+	{
+		Manager->HandleLaunchRemoved_Local(ProjectileId);
+	}
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+AMosesProjectileReplicator::AMosesProjectileReplicator(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bReplicates = true;
+	bAlwaysRelevant = true;
+
+	// 발사 지연 = 복제 주기 → AddLaunch에서 ForceNetUpdate
+	SetNetUpdateFrequency(30.0f);
+
+	PrimaryActorTick.bCanEverTick = false;
+}
+
+void AMosesProjectileReplicator::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	Launches.Owner = this;
+}
+
+void AMosesProjectileReplicator::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 서버는 스폰한 쪽에서 이미 등록, 클라는 복제 도착 시 등록
+	if (UMosesProjectileManagerSubsystem* Manager = MosesProjectileReplicator_Private::GetManager(this))
+	{
+		Manager->RegisterReplicator(this);
+	}
+}
+
+void AMosesProjectileReplicator::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AMosesProjectileReplicator, Launches);
+}
+
+// ============================================================================
+// Launch (Server)
+// ============================================================================
+
+void AMosesProjectileReplicator::AddLaunch_Server(const FMosesSimProjectileLaunch& Launch)
+{
+	check(HasAuthority());
+
+	FMosesSimProjectileLaunch& Item = Launches.Items.Add_GetRef(Launch);
+	Launches.MarkItemDirty(Item);
+
+	ForceNetUpdate();
+}
+
+void AMosesProjectileReplicator::RemoveLaunch_Server(uint32 ProjectileId)
+{
+	check(HasAuthority());
+
+	const int32 Index = Launches.Items.IndexOfByPredicate([ProjectileId](const FMosesSimProjectileLaunch& Item)
+	{
+		return Item.ProjectileId == ProjectileId;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		Launches.Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Launches.MarkArrayDirty();
+	}
+}
+
+void AMosesProjectileReplicator::Multicast_Impact_Implementation(uint32 ProjectileId, uint8 WeaponNetIndex, FVector_NetQuantize Location, FVector_NetQuantizeNormal Normal)
+{
+	if (UMosesProjectileManagerSubsystem* Manager = MosesProjectileReplicator_Private::GetManager(this))
+	{
+		Manager->HandleImpact_Local(ProjectileId, WeaponNetIndex, Location, Normal);
+	}
+}
+
+// ============================================================================
+// Visual (Local)
+// ============================================================================
+
+void AMosesProjectileReplicator::UpdateVisuals_Local(uint8 WeaponNetIndex, UStaticMesh* Mesh, TConstArrayView<FTransform> Transforms)
+{
+	UInstancedStaticMeshComponent* ISM = FindOrCreateVisual_Local(WeaponNetIndex, Mesh);
+	if (!ISM)
+	{
+		return;
+	}
+
+	if (ISM->GetInstanceCount() != Transforms.Num())
+	{
+		ISM->ClearInstances();
+		ISM->AddInstances(TArray<FTransform>(Transforms), false, true);
+		return;
+	}
+
+	ISM->BatchUpdateInstancesTransforms(0, TArray<FTransform>(Transforms), true, true);
+}
+
+void AMosesProjectileReplicator::ClearVisualsExcept_Local(TConstArrayView<uint8> ActiveNetIndices)
+{
+	for (const TPair<uint8, TObjectPtr<UInstancedStaticMeshComponent>>& Pair : VisualsByType)
+	{
+		if (Pair.Value && Pair.Value->GetInstanceCount() > 0 && !ActiveNetIndices.Contains(Pair.Key))
+		{
+			Pair.Value->ClearInstances();
+		}
+	}
+}
+
+UInstancedStaticMeshComponent* AMosesProjectileReplicator::FindOrCreateVisual_Local(uint8 WeaponNetIndex, UStaticMesh* Mesh)
+{
+	if (!Mesh)
+	{
+		return nullptr;
+	}
+
+	if (const TObjectPtr<UInstancedStaticMeshComponent>* Found = VisualsByType.Find(WeaponNetIndex))
+	{
+		return Found->Get();
+	}
+
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(this);
+	ISM->SetStaticMesh(Mesh);
+	ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ISM->SetCastShadow(false);
+	ISM->SetMobility(EComponentMobility::Movable);
+	ISM->SetAbsolute(true, true, true);
+	ISM->RegisterComponent();
+
+	VisualsByType.Add(WeaponNetIndex, ISM);
+	return ISM;
+}
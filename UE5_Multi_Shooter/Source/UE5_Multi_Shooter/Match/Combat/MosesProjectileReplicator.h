@@ -0,0 +1,134 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesProjectileReplicator.h
+// ----------------------------------------------------------------------------
+// Projectile Replicator
+// - 액터 없는 Projectile(UMosesProjectileManagerSubsystem)의 네트워크 창구 (월드당 1개)
+// - 복제 = 발사 파라미터만 (FastArray: Id/무기/원점/속도/Seed/서버 발사 시각)
+//   → 클라가 같은 탄도식으로 로컬 시뮬레이션 (위치 복제 없음)
+// - 폭발 = Unreliable Multicast (FX 코스메틱). 유실돼도 FastArray 제거로 정리
+// - 클라 비주얼 = 무기 타입별 ISM 1개 (Projectile마다 컴포넌트/액터 없음)
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "MosesProjectileReplicator.generated.h"
+
+class AMosesProjectileReplicator;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+USTRUCT()
+struct FMosesSimProjectileLaunch : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+public:
+	// FastArray callbacks
+	void PostReplicatedAdd(const struct FMosesSimProjectileList& InArraySerializer);
+	void PreReplicatedRemove(const struct FMosesSimProjectileList& InArraySerializer);
+
+public:
+	UPROPERTY()
+	uint32 ProjectileId = 0;
+
+	/** UMosesWeaponRegistrySubsystem NetIndex (타입 = WeaponData + ProjectileClass CDO) */
+	UPROPERTY()
+	uint8 WeaponNetIndex = 0;
+
+	UPROPERTY()
+	FVector_NetQuantize Origin;
+
+	UPROPERTY()
+	FVector_NetQuantize Velocity;
+
+	/** 비주얼 변주용 (회전 등) */
+	UPROPERTY()
+	int32 Seed = 0;
+
+	/** AGameStateBase::GetServerWorldTimeSeconds 기준 */
+	UPROPERTY()
+	float ServerLaunchTime = 0.0f;
+
+	/** 발사자 Pawn (Sweep 무시) */
+	UPROPERTY()
+	TObjectPtr<AActor> IgnoreActor = nullptr;
+
+	/** 발사자 클라 예측 매칭 키 (= ShotSeq, 0 = 예측 없음) */
+	UPROPERTY()
+	uint16 PredictionShotSeq = 0;
+};
+
+USTRUCT()
+struct FMosesSimProjectileList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+public:
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FMosesSimProjectileLaunch, FMosesSimProjectileList>(Items, DeltaParams, *this);
+	}
+
+public:
+	UPROPERTY()
+	TArray<FMosesSimProjectileLaunch> Items;
+
+	UPROPERTY(NotReplicated)
+	TWeakObjectPtr<AMosesProjectileReplicator> Owner;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMosesSimProjectileList> : public TStructOpsTypeTraitsBase2<FMosesSimProjectileList>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+UCLASS(NotPlaceable, Transient)
+class UE5_MULTI_SHOOTER_API AMosesProjectileReplicator : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+	AMosesProjectileReplicator(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+protected:
+	// =========================================================================
+	// Engine
+	// =========================================================================
+	virtual void PostInitializeComponents() override;
+	virtual void BeginPlay() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+public:
+	// =========================================================================
+	// Launch (Server)
+	// =========================================================================
+	void AddLaunch_Server(const FMosesSimProjectileLaunch& Launch);
+	void RemoveLaunch_Server(uint32 ProjectileId);
+
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_Impact(uint32 ProjectileId, uint8 WeaponNetIndex, FVector_NetQuantize Location, FVector_NetQuantizeNormal Normal);
+
+	// =========================================================================
+	// Visual (Local)
+	// =========================================================================
+
+	/** 타입별 ISM 인스턴스를 Transforms로 맞춘다 (개수 변화 시 재구성) */
+	void UpdateVisuals_Local(uint8 WeaponNetIndex, UStaticMesh* Mesh, TConstArrayView<FTransform> Transforms);
+
+	/** 이번 프레임 갱신되지 않은 타입 ISM 비우기 */
+	void ClearVisualsExcept_Local(TConstArrayView<uint8> ActiveNetIndices);
+
+private:
+	UInstancedStaticMeshComponent* FindOrCreateVisual_Local(uint8 WeaponNetIndex, UStaticMesh* Mesh);
+
+private:
+	UPROPERTY(Replicated)
+	FMosesSimProjectileList Launches;
+
+	UPROPERTY(Transient)
+	TMap<uint8, TObjectPtr<UInstancedStaticMeshComponent>> VisualsByType;
+};
@@ -0,0 +1,306 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesRadialDamage.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesRadialDamage.h"
+
+#include "UE5_Multi_Shooter/MosesLogChannels.h"
+#include "UE5_Multi_Shooter/MosesStats.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesDamageAccumulatorSubsystem.h"
+
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "Async/ParallelFor.h"
+#include "Kismet/GameplayStatics.h"
+
+#include "AbilitySystemInterface.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+
+namespace MosesRadialDamage_Private
+{
+	struct FCandidate
+	{
+		AActor* Actor = nullptr;
+		FVector Probes[FMosesRadialDamage::MaxProbesPerTarget];
+		int32 NumProbes = 0;
+		int32 FirstTrace = 0;
+	};
+
+	static void AddProbe(FCandidate& Candidate, const FVector& Point)
+	{
+		if (Candidate.NumProbes >= FMosesRadialDamage::MaxProbesPerTarget)
+		{
+			return;
+		}
+
+		for (int32 Index = 0; Index < Candidate.NumProbes; ++Index)
+		{
+			if (FVector::DistSquared(Candidate.Probes[Index], Point) < 1.0f)
+			{
+				return;
+			}
+		}
+
+		Candidate.Probes[Candidate.NumProbes++] = Point;
+	}
+}
+
+float FMosesRadialDamage::CalcFalloffScale(const FMosesRadialDamageParams& Params, float Distance)
+{
+	if (Distance > Params.OuterRadius)
+	{
+		return 0.0f;
+	}
+
+	if (Distance <= Params.InnerRadius || Params.OuterRadius <= Params.InnerRadius)
+	{
+		return 1.0f;
+	}
+
+	// 0(Inner) → 1(Outer)
+	const float Alpha = (Distance - Params.InnerRadius) / (Params.OuterRadius - Params.InnerRadius);
+	const float Curve = FMath::Pow(FMath::Clamp(Alpha, 0.0f, 1.0f), FMath::Max(0.1f, Params.FalloffExponent));
+
+	return FMath::Lerp(1.0f, FMath::Clamp(Params.MinDamageScale, 0.0f, 1.0f), Curve);
+}
+
+int32 FMosesRadialDamage::CollectTargets(
+	const UWorld* World,
+	const FVector& Center,
+	const FMosesRadialDamageParams& Params,
+	const FCollisionQueryParams& QueryParams,
+	TArray<FMosesRadialDamageTarget>& OutTargets)
+{
+	using namespace MosesRadialDamage_Private;
+
+	OutTargets.Reset();
+
+	if (!World || Params.OuterRadius <= 0.0f)
+	{
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_MosesRadialDamageCollect);
+
+	// -------------------------------------------------------------------------
+	// (1) Overlap 1회 → 액터 단위 중복 제거, 컴포넌트 = 프로브
+	// -------------------------------------------------------------------------
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByChannel(Overlaps, Center, FQuat::Identity, Params.TargetChannel, FCollisionShape::MakeSphere(Params.OuterRadius), QueryParams);
+
+	TArray<FCandidate, TInlineAllocator<16>> Candidates;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		AActor* Actor = Overlap.GetActor();
+		const UPrimitiveComponent* Component = Overlap.GetComponent();
+		if (!Actor || !Component)
+		{
+			continue;
+		}
+
+		FCandidate* Candidate = Candidates.FindByPredicate([Actor](const FCandidate& Existing)
+		{
+			return Existing.Actor == Actor;
+		});
+
+		if (!Candidate)
+		{
+			Candidate = &Candidates.AddDefaulted_GetRef();
+			Candidate->Actor = Actor;
+		}
+
+		AddProbe(*Candidate, Component->Bounds.Origin);
+	}
+
+	if (Candidates.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 볼륨이 1개뿐이면 상단(머리 높이) 프로브 추가 → 낮은 엄폐물 뒤 판정 완화
+	for (FCandidate& Candidate : Candidates)
+	{
+		if (Candidate.NumProbes == 1)
+		{
+			const FBox ActorBounds = Candidate.Actor->GetComponentsBoundingBox(false);
+			if (ActorBounds.IsValid)
+			{
+				AddProbe(Candidate, ActorBounds.GetCenter() + FVector(0.0f, 0.0f, ActorBounds.GetExtent().Z * 0.8f));
+			}
+		}
+	}
+
+	// -------------------------------------------------------------------------
+	// (2) 가시성: 모든 프로브 Trace를 한 묶음으로 (결과는 인덱스별 슬롯 → 결정적)
+	// -------------------------------------------------------------------------
+	TArray<FVector, TInlineAllocator<32>> TraceEnds;
+	for (FCandidate& Candidate : Candidates)
+	{
+		Candidate.FirstTrace = TraceEnds.Num();
+		for (int32 Index = 0; Index < Candidate.NumProbes; ++Index)
+		{
+			TraceEnds.Add(Candidate.Probes[Index]);
+		}
+	}
+
+	const int32 NumTraces = TraceEnds.Num();
+
+	TArray<bool, TInlineAllocator<32>> Visible;
+	Visible.SetNumZeroed(NumTraces);
+
+	if (Params.bRequireLineOfSight)
+	{
+		const FCollisionObjectQueryParams OccluderParams(ECC_WorldStatic);
+
+		// 충돌 지점은 벽/바닥 표면 위 → 법선 방향으로 띄워서 Trace (거리/감쇠는 Center 기준 그대로)
+		const FVector TraceOrigin = Center + Params.ImpactNormal.GetSafeNormal() * LineOfSightOriginOffset;
+
+		ParallelFor(NumTraces, [World, &TraceOrigin, &TraceEnds, &Visible, &QueryParams, &OccluderParams](int32 Index)
+		{
+			Visible[Index] = !World->LineTraceTestByObjectType(TraceOrigin, TraceEnds[Index], OccluderParams, QueryParams);
+		},
+		NumTraces < MinParallelTraces ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		SET_DWORD_STAT(STAT_MosesRadialDamageTraces, NumTraces);
+	}
+	else
+	{
+		for (bool& bVisible : Visible)
+		{
+			bVisible = true;
+		}
+	}
+
+	// -------------------------------------------------------------------------
+	// (3) 타겟별: 가장 가까운 보이는 프로브 거리 → 감쇠
+	// -------------------------------------------------------------------------
+	for (const FCandidate& Candidate : Candidates)
+	{
+		float BestDistSq = TNumericLimits<float>::Max();
+		FVector BestPoint = FVector::ZeroVector;
+
+		for (int32 Index = 0; Index < Candidate.NumProbes; ++Index)
+		{
+			if (!Visible[Candidate.FirstTrace + Index])
+			{
+				continue;
+			}
+
+			const float DistSq = FVector::DistSquared(Center, Candidate.Probes[Index]);
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestPoint = Candidate.Probes[Index];
+			}
+		}
+
+		if (BestDistSq == TNumericLimits<float>::Max())
+		{
+			continue;
+		}
+
+		// 큰 볼륨은 중심이 반경 밖일 수 있음 → 경계값으로 Clamp (오버랩 = 피해 대상)
+		const float Distance = FMath::Min(FMath::Sqrt(BestDistSq), Params.OuterRadius);
+		const float Scale = CalcFalloffScale(Params, Distance);
+		if (Scale <= 0.0f)
+		{
+			continue;
+		}
+
+		FMosesRadialDamageTarget& Target = OutTargets.AddDefaulted_GetRef();
+		Target.Actor = Candidate.Actor;
+		Target.Distance = Distance;
+		Target.DamageScale = Scale;
+		Target.Damage = Params.BaseDamage * Scale;
+		Target.ClosestPoint = BestPoint;
+	}
+
+	return OutTargets.Num();
+}
+
+int32 FMosesRadialDamage::ApplyToTargets_Server(
+	UWorld* World,
+	const FVector& Center,
+	TConstArrayView<FMosesRadialDamageTarget> Targets,
+	const FMosesRadialDamageSource& Source)
+{
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		return 0;
+	}
+
+	UMosesDamageAccumulatorSubsystem* DamageAccumulator = World->GetSubsystem<UMosesDamageAccumulatorSubsystem>();
+	APawn* InstPawn = Source.InstigatorController ? Source.InstigatorController->GetPawn() : nullptr;
+
+	int32 HitCount = 0;
+
+	for (const FMosesRadialDamageTarget& RadialTarget : Targets)
+	{
+		AActor* Target = RadialTarget.Actor.Get();
+		if (!Target || RadialTarget.Damage <= 0.0f)
+		{
+			continue;
+		}
+
+		bool bAppliedByGAS = false;
+
+		// GAS 통일 적용
+		const IAbilitySystemInterface* TargetASI = Cast<IAbilitySystemInterface>(Target);
+		UAbilitySystemComponent* TargetASC = TargetASI ? TargetASI->GetAbilitySystemComponent() : nullptr;
+
+		if (Source.SourceASC && TargetASC && Source.DamageGE)
+		{
+			FGameplayEffectContextHandle Ctx = Source.SourceASC->MakeEffectContext();
+
+			// Instigator: 발사자 Pawn/Controller (킬 귀속), SourceObject: Projectile/무기
+			Ctx.AddInstigator(InstPawn, Source.InstigatorController);
+			Ctx.AddOrigin(Center);
+
+			if (Source.SourceObject)
+			{
+				Ctx.AddSourceObject(Source.SourceObject);
+			}
+
+			if (Source.WeaponData)
+			{
+				Ctx.AddSourceObject(Source.WeaponData);
+			}
+
+			// Spec/Apply는 Damage Accumulator (같은 프레임 히트와 타겟별 합산)
+			FMosesDamageEvent DamageEvent;
+			DamageEvent.SourceASC = Source.SourceASC;
+			DamageEvent.TargetASC = TargetASC;
+			DamageEvent.DamageGE = Source.DamageGE;
+			DamageEvent.Context = Ctx;
+
+			// 데미지는 음수로(기존 파이프라인 유지)
+			DamageEvent.Magnitude = -FMath::Abs(RadialTarget.Damage);
+
+			bAppliedByGAS = (DamageAccumulator && DamageAccumulator->AddDamage_Server(DamageEvent))
+				|| UMosesDamageAccumulatorSubsystem::ApplyNow_Server(DamageEvent);
+		}
+
+		// 폴백(ASC 없는 대상 대응)
+		if (!bAppliedByGAS)
+		{
+			UGameplayStatics::ApplyDamage(Target, RadialTarget.Damage, Source.InstigatorController, Source.DamageCauser, nullptr);
+		}
+
+		UE_LOG(LogMosesCombat, Verbose,
+			TEXT("[DAMAGE][SV] Radial %s To=%s Dist=%.1f Scale=%.2f Amount=%.1f"),
+			bAppliedByGAS ? TEXT("GAS") : TEXT("Fallback"),
+			*GetNameSafe(Target),
+			RadialTarget.Distance,
+			RadialTarget.DamageScale,
+			RadialTarget.Damage);
+
+		++HitCount;
+	}
+
+	return HitCount;
+}
@@ -0,0 +1,110 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesRadialDamage.h
+// ----------------------------------------------------------------------------
+// Radial Damage (Server)
+// - Overlap 1회 → 액터 단위 중복 제거 (멀티 컴포넌트 액터도 타겟 1개)
+// - 타겟별 프로브(오버랩된 히트 볼륨 중심, 최대 MaxProbesPerTarget개)
+//   → 폭발 중심에서 프로브까지 가시성 Trace를 한 묶음으로 발행 (ParallelFor)
+//   · 차폐 = WorldStatic만 (다른 Pawn은 파편을 막지 않는다)
+//   · Trace 시작점 = 충돌 지점에서 ImpactNormal 방향으로 LineOfSightOriginOffset
+//     (충돌면 자체에 Trace가 막혀 전원 차폐되는 것 방지)
+// - 거리 감쇠: InnerRadius 안은 1, OuterRadius 경계에서 MinDamageScale (지수 곡선)
+// - 적용: ApplyToTargets_Server → Damage Accumulator (ASC 없으면 ApplyDamage 폴백)
+//   · 유탄 액터 / 액터 없는 시뮬레이션 Projectile 공용
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionQueryParams.h"
+
+class AActor;
+class AController;
+class UAbilitySystemComponent;
+class UGameplayEffect;
+class UMosesWeaponData;
+class UWorld;
+
+struct FMosesRadialDamageParams
+{
+	float BaseDamage = 0.0f;
+
+	float InnerRadius = 0.0f;
+	float OuterRadius = 450.0f;
+
+	float FalloffExponent = 1.0f;
+	float MinDamageScale = 0.0f;
+
+	bool bRequireLineOfSight = true;
+
+	/** 충돌면 법선 (가시성 Trace 시작점 오프셋, 0이면 오프셋 없음) */
+	FVector ImpactNormal = FVector::ZeroVector;
+
+	/** 타겟 수집 채널 (플레이어/좀비) */
+	TEnumAsByte<ECollisionChannel> TargetChannel = ECC_Pawn;
+};
+
+struct FMosesRadialDamageTarget
+{
+	TWeakObjectPtr<AActor> Actor;
+
+	/** 폭발 중심 → 가장 가까운 보이는 프로브 */
+	float Distance = 0.0f;
+	float DamageScale = 0.0f;
+	float Damage = 0.0f;
+
+	FVector ClosestPoint = FVector::ZeroVector;
+};
+
+/** 피해 적용 주체 (Context Instigator/SourceObject 구성용) */
+struct FMosesRadialDamageSource
+{
+	UAbilitySystemComponent* SourceASC = nullptr;
+	TSubclassOf<UGameplayEffect> DamageGE;
+
+	AController* InstigatorController = nullptr;
+
+	/** ApplyDamage 폴백의 DamageCauser (액터 Projectile이면 자기 자신) */
+	AActor* DamageCauser = nullptr;
+
+	/** Context SourceObject (Projectile 액터 등, 없으면 생략) */
+	const UObject* SourceObject = nullptr;
+	const UMosesWeaponData* WeaponData = nullptr;
+};
+
+struct UE5_MULTI_SHOOTER_API FMosesRadialDamage
+{
+public:
+	static constexpr int32 MaxProbesPerTarget = 3;
+
+	/** 가시성 Trace 시작점을 충돌면에서 띄우는 거리 (cm) */
+	static constexpr float LineOfSightOriginOffset = 5.0f;
+
+	/** 이 개수 미만 Trace는 단일 스레드 (디스패치 비용 > Trace 비용) */
+	static constexpr int32 MinParallelTraces = 8;
+
+	/** 거리 → 데미지 배율 (OuterRadius 밖 = 0) */
+	static float CalcFalloffScale(const FMosesRadialDamageParams& Params, float Distance);
+
+	/**
+	 * 폭발 대상 수집 + 가시성 + 감쇠 계산
+	 * @param QueryParams 무시 액터 (Projectile/발사자 등)
+	 * @return 피해 대상 수
+	 */
+	static int32 CollectTargets(
+		const UWorld* World,
+		const FVector& Center,
+		const FMosesRadialDamageParams& Params,
+		const FCollisionQueryParams& QueryParams,
+		TArray<FMosesRadialDamageTarget>& OutTargets);
+
+	/**
+	 * 수집된 대상에 타겟당 이벤트 1개 (GAS → Accumulator, 없으면 ApplyDamage)
+	 * @return 적용 대상 수
+	 */
+	static int32 ApplyToTargets_Server(
+		UWorld* World,
+		const FVector& Center,
+		TConstArrayView<FMosesRadialDamageTarget> Targets,
+		const FMosesRadialDamageSource& Source);
+};
@@ -0,0 +1,227 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesSlotStateTypes.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesSlotStateTypes.h"
+
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+namespace MosesSlotState_Private
+{
+	static constexpr int32 WeaponIndexBits = 8;
+	static constexpr int32 SlotBits = 2;		// Slot 1~4 -> 0~3
+	static constexpr int32 SerialBits = 8;
+
+	/** 마지막으로 보낸(ACK 기준) 상태 스냅샷 */
+	class FBaseState : public INetDeltaBaseState
+	{
+	public:
+		FMosesPackedSlot Slots[FMosesPackedSlotState::NumSlots];
+		uint8 CurrentSlot = 0;
+		uint8 SwapSerial = 0;
+		uint8 LastSwapFromSlot = 0;
+		uint8 LastSwapToSlot = 0;
+
+		void CopyFrom(const FMosesPackedSlotState& State)
+		{
+			for (int32 Index = 0; Index < FMosesPackedSlotState::NumSlots; ++Index)
+			{
+				Slots[Index] = State.Slots[Index];
+			}
+
+			CurrentSlot = State.CurrentSlot;
+			SwapSerial = State.SwapSerial;
+			LastSwapFromSlot = State.LastSwapFromSlot;
+			LastSwapToSlot = State.LastSwapToSlot;
+		}
+
+		virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+		{
+			const FBaseState* Other = static_cast<const FBaseState*>(OtherState);
+			if (!Other)
+			{
+				return false;
+			}
+
+			for (int32 Index = 0; Index < FMosesPackedSlotState::NumSlots; ++Index)
+			{
+				if (!Slots[Index].HasSameWeapon(Other->Slots[Index]) || !Slots[Index].HasSameAmmo(Other->Slots[Index]))
+				{
+					return false;
+				}
+			}
+
+			return CurrentSlot == Other->CurrentSlot
+				&& SwapSerial == Other->SwapSerial
+				&& LastSwapFromSlot == Other->LastSwapFromSlot
+				&& LastSwapToSlot == Other->LastSwapToSlot;
+		}
+	};
+
+	static void WriteBits(FBitWriter& Writer, uint32 Value, int32 NumBits)
+	{
+		Writer.SerializeBits(&Value, NumBits);
+	}
+
+	static uint32 ReadBits(FBitReader& Reader, int32 NumBits)
+	{
+		uint32 Value = 0;
+		Reader.SerializeBits(&Value, NumBits);
+		return Value;
+	}
+
+	static uint8 SlotToBits(uint8 Slot) { return static_cast<uint8>(FMath::Clamp<int32>(Slot, 1, 4) - 1); }
+	static uint8 BitsToSlot(uint32 Bits) { return static_cast<uint8>((Bits & 0x3) + 1); }
+}
+
+bool FMosesPackedSlotState::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	using namespace MosesSlotState_Private;
+
+	// 오브젝트 참조 없음 (GUID 매핑 대상 아님)
+	if (DeltaParms.GatherGuidReferences || DeltaParms.MoveGuidToUnmapped || DeltaParms.bUpdateUnmappedObjects)
+	{
+		return false;
+	}
+
+	// -------------------------------------------------------------------------
+	// Write (Server)
+	// -------------------------------------------------------------------------
+	if (DeltaParms.Writer)
+	{
+		FBitWriter& Writer = *DeltaParms.Writer;
+		const FBaseState* OldState = static_cast<const FBaseState*>(DeltaParms.OldState);
+
+		uint8 WeaponMask = 0;
+		uint8 MagMask = 0;
+		uint8 ReserveMask = 0;
+		for (int32 Index = 0; Index < NumSlots; ++Index)
+		{
+			if (!OldState || !Slots[Index].HasSameWeapon(OldState->Slots[Index]))
+			{
+				WeaponMask |= (1 << Index);
+			}
+
+			// 발사는 Mag만 바뀜 → Reserve 20bit 생략
+			if (!OldState || !Slots[Index].HasSameMag(OldState->Slots[Index]))
+			{
+				MagMask |= (1 << Index);
+			}
+
+			if (!OldState || !Slots[Index].HasSameReserve(OldState->Slots[Index]))
+			{
+				ReserveMask |= (1 << Index);
+			}
+		}
+
+		const bool bCurrentSlotDirty = !OldState || OldState->CurrentSlot != CurrentSlot;
+		const bool bSwapDirty = !OldState
+			|| OldState->SwapSerial != SwapSerial
+			|| OldState->LastSwapFromSlot != LastSwapFromSlot
+			|| OldState->LastSwapToSlot != LastSwapToSlot;
+
+		if (OldState && WeaponMask == 0 && MagMask == 0 && ReserveMask == 0 && !bCurrentSlotDirty && !bSwapDirty)
+		{
+			return false;
+		}
+
+		TSharedPtr<FBaseState> NewState = MakeShared<FBaseState>();
+		NewState->CopyFrom(*this);
+		*DeltaParms.NewState = NewState;
+
+		// 헤더: CurrentSlot/Swap 비트 + 슬롯별 Weapon/Mag/Reserve Dirty 비트
+		Writer.WriteBit(bCurrentSlotDirty ? 1 : 0);
+		Writer.WriteBit(bSwapDirty ? 1 : 0);
+		WriteBits(Writer, WeaponMask, NumSlots);
+		WriteBits(Writer, MagMask, NumSlots);
+		WriteBits(Writer, ReserveMask, NumSlots);
+
+		if (bCurrentSlotDirty)
+		{
+			WriteBits(Writer, SlotToBits(CurrentSlot), SlotBits);
+		}
+
+		if (bSwapDirty)
+		{
+			WriteBits(Writer, SwapSerial, SerialBits);
+			WriteBits(Writer, SlotToBits(LastSwapFromSlot), SlotBits);
+			WriteBits(Writer, SlotToBits(LastSwapToSlot), SlotBits);
+		}
+
+		for (int32 Index = 0; Index < NumSlots; ++Index)
+		{
+			const FMosesPackedSlot& Slot = Slots[Index];
+
+			if (WeaponMask & (1 << Index))
+			{
+				WriteBits(Writer, Slot.WeaponIndex, WeaponIndexBits);
+			}
+
+			if (MagMask & (1 << Index))
+			{
+				WriteBits(Writer, Slot.MagAmmo, AmmoBits);
+			}
+
+			if (ReserveMask & (1 << Index))
+			{
+				WriteBits(Writer, Slot.ReserveAmmo, AmmoBits);
+				WriteBits(Writer, Slot.ReserveMax, AmmoBits);
+			}
+		}
+
+		return true;
+	}
+
+	// -------------------------------------------------------------------------
+	// Read (Client)
+	// -------------------------------------------------------------------------
+	if (DeltaParms.Reader)
+	{
+		FBitReader& Reader = *DeltaParms.Reader;
+
+		bReceivedCurrentSlot = Reader.ReadBit() != 0;
+		bReceivedSwap = Reader.ReadBit() != 0;
+		ReceivedWeaponMask = static_cast<uint8>(ReadBits(Reader, NumSlots));
+		const uint8 MagMask = static_cast<uint8>(ReadBits(Reader, NumSlots));
+		const uint8 ReserveMask = static_cast<uint8>(ReadBits(Reader, NumSlots));
+		ReceivedAmmoMask = MagMask | ReserveMask;
+
+		if (bReceivedCurrentSlot)
+		{
+			CurrentSlot = BitsToSlot(ReadBits(Reader, SlotBits));
+		}
+
+		if (bReceivedSwap)
+		{
+			SwapSerial = static_cast<uint8>(ReadBits(Reader, SerialBits));
+			LastSwapFromSlot = BitsToSlot(ReadBits(Reader, SlotBits));
+			LastSwapToSlot = BitsToSlot(ReadBits(Reader, SlotBits));
+		}
+
+		for (int32 Index = 0; Index < NumSlots; ++Index)
+		{
+			FMosesPackedSlot& Slot = Slots[Index];
+
+			if (ReceivedWeaponMask & (1 << Index))
+			{
+				Slot.WeaponIndex = static_cast<uint8>(ReadBits(Reader, WeaponIndexBits));
+			}
+
+			if (MagMask & (1 << Index))
+			{
+				Slot.MagAmmo = static_cast<uint16>(ReadBits(Reader, AmmoBits));
+			}
+
+			if (ReserveMask & (1 << Index))
+			{
+				Slot.ReserveAmmo = static_cast<uint16>(ReadBits(Reader, AmmoBits));
+				Slot.ReserveMax = static_cast<uint16>(ReadBits(Reader, AmmoBits));
+			}
+		}
+
+		return !Reader.IsError();
+	}
+
+	return false;
+}
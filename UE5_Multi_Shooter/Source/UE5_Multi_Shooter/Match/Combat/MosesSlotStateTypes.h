@@ -0,0 +1,93 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesSlotStateTypes.h
+// ----------------------------------------------------------------------------
+// Packed Slot State (Server -> Client, Property Replication)
+// - 슬롯 4개(WeaponIndex + Mag/Reserve/ReserveMax) + CurrentSlot + Swap 정보를 구조체 1개로
+// - WeaponId 태그 대신 Registry가 부여한 NetIndex(8bit), 탄약은 10bit로 비트 패킹
+// - NetDeltaSerialize: 마지막 ACK 기준 바뀐 슬롯만 전송 (슬롯별 Weapon/Mag/Reserve Dirty 비트)
+//   → 발사 1회 = 해당 슬롯 Mag 10bit + 헤더 14bit (Reserve는 리로드/획득 때만)
+// - 패킷 유실 시 엔진이 마지막 ACK 상태로 Base를 되돌리므로 Dirty 누락 없음
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "MosesSlotStateTypes.generated.h"
+
+// ============================================================================
+// FMosesPackedSlot
+// ============================================================================
+
+/** 슬롯 1개 분량 */
+struct FMosesPackedSlot
+{
+	/** UMosesWeaponRegistrySubsystem NetIndex (0 = 빈 슬롯) */
+	uint8 WeaponIndex = 0;
+
+	uint16 MagAmmo = 0;
+	uint16 ReserveAmmo = 0;
+	uint16 ReserveMax = 0;
+
+	bool HasSameWeapon(const FMosesPackedSlot& Other) const { return WeaponIndex == Other.WeaponIndex; }
+
+	bool HasSameMag(const FMosesPackedSlot& Other) const { return MagAmmo == Other.MagAmmo; }
+
+	bool HasSameReserve(const FMosesPackedSlot& Other) const
+	{
+		return ReserveAmmo == Other.ReserveAmmo && ReserveMax == Other.ReserveMax;
+	}
+
+	bool HasSameAmmo(const FMosesPackedSlot& Other) const { return HasSameMag(Other) && HasSameReserve(Other); }
+};
+
+// ============================================================================
+// FMosesPackedSlotState
+// ============================================================================
+
+USTRUCT()
+struct FMosesPackedSlotState
+{
+	GENERATED_BODY()
+
+	static constexpr int32 NumSlots = 4;
+
+	/** 탄약 필드 비트 수 (0~1023, 초과분은 서버에서 Clamp) */
+	static constexpr int32 AmmoBits = 10;
+	static constexpr int32 MaxPackedAmmo = (1 << AmmoBits) - 1;
+
+	// =========================================================================
+	// Replicated (NetDeltaSerialize)
+	// =========================================================================
+	FMosesPackedSlot Slots[NumSlots];
+
+	uint8 CurrentSlot = 1;
+
+	uint8 SwapSerial = 0;
+	uint8 LastSwapFromSlot = 1;
+	uint8 LastSwapToSlot = 1;
+
+	// =========================================================================
+	// Received (클라: 직전 수신에서 바뀐 항목, OnRep에서 소비)
+	// =========================================================================
+	uint8 ReceivedWeaponMask = 0;
+	uint8 ReceivedAmmoMask = 0;		// Mag | Reserve
+	bool bReceivedCurrentSlot = false;
+	bool bReceivedSwap = false;
+
+	FMosesPackedSlot& GetSlot(int32 SlotIndex) { return Slots[FMath::Clamp(SlotIndex, 1, NumSlots) - 1]; }
+	const FMosesPackedSlot& GetSlot(int32 SlotIndex) const { return Slots[FMath::Clamp(SlotIndex, 1, NumSlots) - 1]; }
+
+	static uint16 ClampAmmo(int32 Value) { return static_cast<uint16>(FMath::Clamp(Value, 0, MaxPackedAmmo)); }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMosesPackedSlotState> : public TStructOpsTypeTraitsBase2<FMosesPackedSlotState>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
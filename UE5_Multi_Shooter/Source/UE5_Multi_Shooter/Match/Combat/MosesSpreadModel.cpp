@@ -0,0 +1,112 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesSpreadModel.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesSpreadModel.h"
+
+#include "Math/RandomStream.h"
+
+float FMosesSpreadModel::CalcSpreadFactor01(float Speed2D, float SpeedRef)
+{
+	return FMath::Clamp(Speed2D / FMath::Max(1.0f, SpeedRef), 0.0f, 1.0f);
+}
+
+float FMosesSpreadModel::CalcHalfAngleDeg(float MinDeg, float MaxDeg, float SpreadFactor01)
+{
+	return FMath::Max(0.0f, FMath::Lerp(MinDeg, MaxDeg, FMath::Clamp(SpreadFactor01, 0.0f, 1.0f)));
+}
+
+uint32 FMosesSpreadModel::MakeShotSeed(uint32 LifeSeed, uint16 ShotSeq)
+{
+	// 인접 Seq끼리 시드가 비슷하지 않도록 섞는다 (FRandomStream 초기 샘플 상관 방지)
+	return HashCombineFast(GetTypeHash(LifeSeed), GetTypeHash(static_cast<uint32>(ShotSeq) * 0x9E3779B9u));
+}
+
+FVector2D FMosesSpreadModel::GetUnitConeOffset(uint32 ShotSeed)
+{
+	FRandomStream Stream(static_cast<int32>(ShotSeed));
+
+	// 반지름은 sqrt → 원판 면적 균등
+	const float Radius = FMath::Sqrt(Stream.GetFraction());
+	const float Azimuth = Stream.GetFraction() * UE_TWO_PI;
+
+	return FVector2D(Radius * FMath::Cos(Azimuth), Radius * FMath::Sin(Azimuth));
+}
+
+FVector FMosesSpreadModel::ApplyToDirection(const FVector& AimDir, float HalfAngleDeg, uint32 ShotSeed)
+{
+	const FVector Forward = AimDir.GetSafeNormal();
+	if (HalfAngleDeg <= 0.0f || Forward.IsNearlyZero())
+	{
+		return Forward;
+	}
+
+	// 기준축은 AimDir만으로 결정 → 서버/클라 동일
+	FVector Right;
+	FVector Up;
+	Forward.FindBestAxisVectors(Right, Up);
+
+	const FVector2D Offset = GetUnitConeOffset(ShotSeed);
+	const float TanHalf = FMath::Tan(FMath::DegreesToRadians(FMath::Min(HalfAngleDeg, 89.0f)));
+
+	return (Forward + (Right * Offset.X + Up * Offset.Y) * TanHalf).GetSafeNormal();
+}
+
+int32 FMosesSpreadModel::BuildPelletDirections(const FVector& CenterDir, float HalfAngleDeg, uint32 ShotSeed, TArrayView<FVector> OutDirs)
+{
+	const int32 NumPellets = FMath::Min(OutDirs.Num(), MaxPellets);
+	const FVector Forward = CenterDir.GetSafeNormal();
+
+	if (HalfAngleDeg <= 0.0f || Forward.IsNearlyZero())
+	{
+		for (int32 Index = 0; Index < NumPellets; ++Index)
+		{
+			OutDirs[Index] = Forward;
+		}
+		return NumPellets;
+	}
+
+	FVector Right;
+	FVector Up;
+	Forward.FindBestAxisVectors(Right, Up);
+
+	const float TanHalf = FMath::Tan(FMath::DegreesToRadians(FMath::Min(HalfAngleDeg, 89.0f)));
+
+	// (1) 원판 오프셋 (SoA). 중심 방향 스트림과 겹치지 않게 시드를 한 번 더 섞는다
+	FRandomStream Stream(static_cast<int32>(HashCombineFast(ShotSeed, 0x5E11E7u)));
+
+	float OffsetX[MaxPellets];
+	float OffsetY[MaxPellets];
+	for (int32 Index = 0; Index < NumPellets; ++Index)
+	{
+		const float Radius = FMath::Sqrt(Stream.GetFraction()) * TanHalf;
+		const float Azimuth = Stream.GetFraction() * UE_TWO_PI;
+
+		float SinAz;
+		float CosAz;
+		FMath::SinCos(&SinAz, &CosAz, Azimuth);
+
+		OffsetX[Index] = Radius * CosAz;
+		OffsetY[Index] = Radius * SinAz;
+	}
+
+	// (2) 방향 조립 + 정규화: 분기 없는 성분별 루프 → 컴파일러 자동 벡터화 대상
+	FVector::FReal DirX[MaxPellets];
+	FVector::FReal DirY[MaxPellets];
+	FVector::FReal DirZ[MaxPellets];
+	for (int32 Index = 0; Index < NumPellets; ++Index)
+	{
+		DirX[Index] = Forward.X + Right.X * OffsetX[Index] + Up.X * OffsetY[Index];
+		DirY[Index] = Forward.Y + Right.Y * OffsetX[Index] + Up.Y * OffsetY[Index];
+		DirZ[Index] = Forward.Z + Right.Z * OffsetX[Index] + Up.Z * OffsetY[Index];
+	}
+
+	for (int32 Index = 0; Index < NumPellets; ++Index)
+	{
+		// |Forward| = 1, 오프셋은 수직 → 길이 >= 1 (0 나눗셈 없음)
+		const FVector::FReal InvLen = FMath::InvSqrt(DirX[Index] * DirX[Index] + DirY[Index] * DirY[Index] + DirZ[Index] * DirZ[Index]);
+		OutDirs[Index] = FVector(DirX[Index] * InvLen, DirY[Index] * InvLen, DirZ[Index] * InvLen);
+	}
+
+	return NumPellets;
+}
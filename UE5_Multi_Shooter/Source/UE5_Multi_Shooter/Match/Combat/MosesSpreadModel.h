@@ -0,0 +1,43 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/MosesSpreadModel.h
+// ----------------------------------------------------------------------------
+// Deterministic Spread Model (Client / Server 공용)
+// - 샷 1발의 탄퍼짐 = (LifeSeed, ShotSeq) 해시로 만든 시드 → 같은 입력 = 같은 방향
+//   · 서버: 판정용 방향
+//   · 클라: 같은 방향으로 트레이서/임팩트를 로컬 재생 (Multicast 페이로드 없음)
+// - 전역 RNG(FMath::VRandCone)를 쓰지 않는다
+// - 이동 속도 → SpreadFactor(0~1) 정규화도 여기 한 곳 (크로스헤어 Bloom 공용)
+// - 펠릿(샷건): 중심 방향 기준 N개 방향을 한 패스로 생성 (SoA 배열, 기준축 1회)
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct UE5_MULTI_SHOOTER_API FMosesSpreadModel
+{
+public:
+	/** 샷 1발당 최대 펠릿 수 (스택 버퍼 크기) */
+	static constexpr int32 MaxPellets = 16;
+
+	/** 이동 속도 → SpreadFactor(0=정지, 1=SpeedRef 이상) */
+	static float CalcSpreadFactor01(float Speed2D, float SpeedRef);
+
+	/** SpreadFactor → 원뿔 반각(도) */
+	static float CalcHalfAngleDeg(float MinDeg, float MaxDeg, float SpreadFactor01);
+
+	/** 샷 시드: 생명 단위 시드 + ShotSeq */
+	static uint32 MakeShotSeed(uint32 LifeSeed, uint16 ShotSeq);
+
+	/** 단위 원판 안의 오프셋 (면적 균등, 시드만으로 결정) */
+	static FVector2D GetUnitConeOffset(uint32 ShotSeed);
+
+	/** AimDir 기준 반각 HalfAngleDeg 원뿔 안의 방향 */
+	static FVector ApplyToDirection(const FVector& AimDir, float HalfAngleDeg, uint32 ShotSeed);
+
+	/**
+	 * CenterDir 기준 반각 HalfAngleDeg 원뿔 안의 펠릿 방향 OutDirs.Num()개 (최대 MaxPellets)
+	 * @return 기록한 방향 수
+	 */
+	static int32 BuildPelletDirections(const FVector& CenterDir, float HalfAngleDeg, uint32 ShotSeed, TArrayView<FVector> OutDirs);
+};
@@ -0,0 +1,162 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/Tests/MosesFireSchedulerTests.cpp
+// ----------------------------------------------------------------------------
+// FMosesFireScheduler Automation Tests
+// - 연사 간격(Cadence): 샷 시각이 정확히 Interval 격자 위
+// - 프레임레이트 무관: 같은 입력 = 같은 발수/같은 시각
+// - 히치 따라잡기(Catch-up): MaxCatchUpShots 상한 + 초과분 버림 후 위상 유지
+// - 재트리거: 연타로 연사 속도 초과 불가
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesFireScheduler.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MosesFireSchedulerTests_Private
+{
+	static constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+	/** StartSec부터 EndSec까지 FrameDt 간격으로 Advance → 발사 시각 전부 수집 */
+	static void RunFrames(FMosesFireScheduler& Scheduler, double StartSec, double EndSec, double FrameDt, TArray<double>& OutShotTimes)
+	{
+		double ShotTimes[FMosesFireScheduler::MaxCatchUpShots];
+
+		for (double Now = StartSec; Now <= EndSec + 1e-9; Now += FrameDt)
+		{
+			const int32 NumShots = Scheduler.Advance(Now, ShotTimes);
+			for (int32 Index = 0; Index < NumShots; ++Index)
+			{
+				OutShotTimes.Add(ShotTimes[Index]);
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMosesFireSchedulerCadenceTest, "Moses.Combat.FireScheduler.Cadence", MosesFireSchedulerTests_Private::TestFlags)
+
+bool FMosesFireSchedulerCadenceTest::RunTest(const FString& Parameters)
+{
+	using namespace MosesFireSchedulerTests_Private;
+
+	FMosesFireScheduler Scheduler;
+	Scheduler.Configure(0.1f);
+	Scheduler.Start(0.0);
+
+	TArray<double> ShotTimes;
+	RunFrames(Scheduler, 0.0, 1.0, 1.0 / 60.0, ShotTimes);
+
+	// t = 0.0, 0.1, ..., 1.0 (경계 포함) → 11발
+	TestEqual(TEXT("Shot count over 1s at 600 RPM"), ShotTimes.Num(), 11);
+
+	for (int32 Index = 0; Index < ShotTimes.Num(); ++Index)
+	{
+		TestEqual(FString::Printf(TEXT("Shot %d on interval grid"), Index),
+			FMosesFireScheduler::SecondsToTicks(ShotTimes[Index]), FMosesFireScheduler::SecondsToTicks(0.1 * Index));
+	}
+
+	TestEqual(TEXT("ShotCount query matches emitted shots"), static_cast<int32>(Scheduler.GetShotCount()), ShotTimes.Num());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMosesFireSchedulerFrameRateTest, "Moses.Combat.FireScheduler.FrameRateIndependent", MosesFireSchedulerTests_Private::TestFlags)
+
+bool FMosesFireSchedulerFrameRateTest::RunTest(const FString& Parameters)
+{
+	using namespace MosesFireSchedulerTests_Private;
+
+	const double FrameDts[] = { 1.0 / 30.0, 1.0 / 60.0, 1.0 / 144.0, 0.037 };
+
+	TArray<double> Reference;
+	for (const double FrameDt : FrameDts)
+	{
+		FMosesFireScheduler Scheduler;
+		Scheduler.Configure(0.085f);
+		Scheduler.Start(0.0);
+
+		TArray<double> ShotTimes;
+		RunFrames(Scheduler, 0.0, 2.0, FrameDt, ShotTimes);
+
+		// 마지막 프레임이 2.0을 넘지 못한 경우 대비: 2.0에서 한 번 더 정산
+		double Tail[FMosesFireScheduler::MaxCatchUpShots];
+		const int32 NumTail = Scheduler.Advance(2.0, Tail);
+		for (int32 Index = 0; Index < NumTail; ++Index)
+		{
+			ShotTimes.Add(Tail[Index]);
+		}
+
+		if (Reference.IsEmpty())
+		{
+			Reference = ShotTimes;
+			continue;
+		}
+
+		TestEqual(FString::Printf(TEXT("Shot count at dt=%.4f"), FrameDt), ShotTimes.Num(), Reference.Num());
+		for (int32 Index = 0; Index < FMath::Min(ShotTimes.Num(), Reference.Num()); ++Index)
+		{
+			TestEqual(FString::Printf(TEXT("Shot %d time at dt=%.4f"), Index, FrameDt),
+				FMosesFireScheduler::SecondsToTicks(ShotTimes[Index]), FMosesFireScheduler::SecondsToTicks(Reference[Index]));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMosesFireSchedulerCatchUpTest, "Moses.Combat.FireScheduler.CatchUp", MosesFireSchedulerTests_Private::TestFlags)
+
+bool FMosesFireSchedulerCatchUpTest::RunTest(const FString& Parameters)
+{
+	FMosesFireScheduler Scheduler;
+	Scheduler.Configure(0.1f);
+	Scheduler.Start(0.0);
+
+	double ShotTimes[FMosesFireScheduler::MaxCatchUpShots];
+
+	TestEqual(TEXT("Trigger down fires immediately"), Scheduler.Advance(0.0, ShotTimes), 1);
+
+	// 짧은 밀림: 예정 샷 전부 따라잡기 (0.1, 0.2, 0.3)
+	TestEqual(TEXT("Small stall catches up every due shot"), Scheduler.Advance(0.35, ShotTimes), 3);
+	TestEqual(TEXT("Catch-up keeps scheduled time"), FMosesFireScheduler::SecondsToTicks(ShotTimes[2]), FMosesFireScheduler::SecondsToTicks(0.3));
+
+	// 큰 히치: MaxCatchUpShots만 발사 (0.4 ~ 0.7), 나머지는 버림
+	const int32 NumHitch = Scheduler.Advance(2.0, ShotTimes);
+	TestEqual(TEXT("Hitch is capped to MaxCatchUpShots"), NumHitch, FMosesFireScheduler::MaxCatchUpShots);
+	TestEqual(TEXT("Hitch first shot"), FMosesFireScheduler::SecondsToTicks(ShotTimes[0]), FMosesFireScheduler::SecondsToTicks(0.4));
+
+	// 버린 뒤에도 위상 유지: 다음 샷 = 2.1 (격자 위), 그 전엔 발사 없음
+	TestEqual(TEXT("No burst right after hitch"), Scheduler.Advance(2.05, ShotTimes), 0);
+	TestEqual(TEXT("Resumes on interval grid"), Scheduler.Advance(2.1, ShotTimes), 1);
+	TestEqual(TEXT("Resumed shot time"), FMosesFireScheduler::SecondsToTicks(ShotTimes[0]), FMosesFireScheduler::SecondsToTicks(2.1));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMosesFireSchedulerRetriggerTest, "Moses.Combat.FireScheduler.Retrigger", MosesFireSchedulerTests_Private::TestFlags)
+
+bool FMosesFireSchedulerRetriggerTest::RunTest(const FString& Parameters)
+{
+	FMosesFireScheduler Scheduler;
+	Scheduler.Configure(0.1f);
+
+	double ShotTimes[FMosesFireScheduler::MaxCatchUpShots];
+
+	Scheduler.Start(0.0);
+	TestEqual(TEXT("First pull fires"), Scheduler.Advance(0.0, ShotTimes), 1);
+	Scheduler.Stop();
+
+	// 쿨다운 중 재트리거 → 예정 시각 유지
+	Scheduler.Start(0.05);
+	TestEqual(TEXT("Re-pull inside cooldown does not fire"), Scheduler.Advance(0.05, ShotTimes), 0);
+	TestTrue(TEXT("Time until next shot reported"), FMath::IsNearlyEqual(Scheduler.GetTimeUntilNextShotSec(0.05), 0.05f, 1e-4f));
+	TestEqual(TEXT("Re-pull fires on schedule"), Scheduler.Advance(0.1, ShotTimes), 1);
+	Scheduler.Stop();
+
+	// 단발도 같은 쿨다운
+	TestFalse(TEXT("Single shot inside cooldown rejected"), Scheduler.TryConsumeSingleShot(0.15));
+	TestTrue(TEXT("Single shot after cooldown accepted"), Scheduler.TryConsumeSingleShot(0.2));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,130 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/Tests/MosesLagCompensationTests.cpp
+// ----------------------------------------------------------------------------
+// Lag Compensation (Hitbox Rewind)
+// - 움직이는 타겟을 매 틱 기록 → 과거 시각으로 되감아 Trace
+// - 되감은 동안은 과거 위치에 맞고, 스코프 종료 후 라이브 Body Transform 복구
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Combat/MosesLagCompensationSubsystem.h"
+
+#include "Misc/AutomationTest.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/HitResult.h"
+#include "Engine/World.h"
+#include "CollisionQueryParams.h"
+#include "GameFramework/Actor.h"
+#include "PhysicsEngine/BodyInstance.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MosesLagCompensationTests_Private
+{
+	static constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+	static constexpr float TickSec = 1.0f / 30.0f;
+	static constexpr int32 NumRecordTicks = 10;				// 0.33초 (HistoryWindowSec 안)
+	static constexpr float MovePerTick = 40.0f;				// 캡슐 지름보다 큼 → 과거/현재 위치가 겹치지 않음
+	static constexpr int32 RewindTick = 3;
+
+	static const FVector StartLocation(500.0f, 0.0f, 100.0f);
+
+	static FVector GetLocationAtTick(int32 Tick)
+	{
+		return StartLocation + FVector(MovePerTick * Tick, 0.0f, 0.0f);
+	}
+
+	/** Pawn 오브젝트 캡슐 하나를 가진 타겟 (플레이어 캡슐 크기) */
+	static UCapsuleComponent* SpawnCapsuleTarget(UWorld* World, const FVector& Location)
+	{
+		AActor* Target = World->SpawnActor<AActor>();
+		UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Target);
+		Capsule->SetCapsuleSize(34.0f, 88.0f);
+		Capsule->SetCollisionObjectType(ECC_Pawn);
+		Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		Capsule->SetCollisionResponseToAllChannels(ECR_Block);
+		Target->SetRootComponent(Capsule);
+		Capsule->RegisterComponent();
+		Target->SetActorLocation(Location);
+		return Capsule;
+	}
+
+	/** X = TraceX 평면을 Y축으로 가로지르는 Trace */
+	static bool TraceHitsAt(const UWorld* World, float TraceX, const AActor* Target)
+	{
+		const FVector Start(TraceX, -300.0f, StartLocation.Z);
+		const FVector End(TraceX, 300.0f, StartLocation.Z);
+
+		FHitResult Hit;
+		const FCollisionQueryParams Params(SCENE_QUERY_STAT(Moses_LagCompTest), false);
+		return World->LineTraceSingleByObjectType(Hit, Start, End, FCollisionObjectQueryParams(ECC_Pawn), Params)
+			&& Hit.GetActor() == Target;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMosesLagCompensationRewindTest, "Moses.Combat.LagCompensation.RewindHitsHistoricalPose", MosesLagCompensationTests_Private::TestFlags)
+
+bool FMosesLagCompensationRewindTest::RunTest(const FString& Parameters)
+{
+	using namespace MosesLagCompensationTests_Private;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("MosesLagCompensationTest"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	UMosesLagCompensationSubsystem* LagComp = World->GetSubsystem<UMosesLagCompensationSubsystem>();
+	if (!TestNotNull(TEXT("Lag compensation subsystem exists in a game world"), LagComp))
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	UCapsuleComponent* Capsule = SpawnCapsuleTarget(World, GetLocationAtTick(0));
+	AActor* Target = Capsule->GetOwner();
+	LagComp->RegisterTarget_Server(Target, Capsule, nullptr, nullptr);
+
+	// 이동 → 월드 틱(서브시스템 Tick이 기록), 각 틱의 서버 시각 보관
+	double TickTimes[NumRecordTicks + 1] = {};
+	for (int32 Tick = 0; Tick <= NumRecordTicks; ++Tick)
+	{
+		Target->SetActorLocation(GetLocationAtTick(Tick));
+		World->Tick(LEVELTICK_All, TickSec);
+		TickTimes[Tick] = World->GetTimeSeconds();
+	}
+
+	const FVector LiveLocation = GetLocationAtTick(NumRecordTicks);
+	const FVector PastLocation = GetLocationAtTick(RewindTick);
+
+	TestFalse(TEXT("Live pose: trace at the historical location misses"), TraceHitsAt(World, PastLocation.X, Target));
+	TestTrue(TEXT("Live pose: trace at the live location hits"), TraceHitsAt(World, LiveLocation.X, Target));
+
+	{
+		const FVector SegmentStart(PastLocation.X, -300.0f, PastLocation.Z);
+		const FVector SegmentEnd(PastLocation.X, 300.0f, PastLocation.Z);
+
+		FMosesScopedHitboxRewind Rewind(LagComp, TickTimes[RewindTick], nullptr, SegmentStart, SegmentEnd);
+
+		TestEqual(TEXT("Rewind moves the tracked target"), Rewind.GetNumRewound(), 1);
+		TestTrue(TEXT("Rewound: trace hits the historical pose"), TraceHitsAt(World, PastLocation.X, Target));
+		TestFalse(TEXT("Rewound: trace at the live location misses"), TraceHitsAt(World, LiveLocation.X, Target));
+	}
+
+	TestFalse(TEXT("Rewind released"), LagComp->IsRewindActive());
+
+	const FBodyInstance* Body = Capsule->GetBodyInstance();
+	TestTrue(TEXT("Restored body transform matches the live component"),
+		Body && Body->GetUnrealWorldTransform().GetLocation().Equals(Capsule->GetComponentLocation(), 0.1));
+	TestTrue(TEXT("Component transform was never moved"), Capsule->GetComponentLocation().Equals(LiveLocation, 0.1));
+	TestTrue(TEXT("Restored: trace at the live location hits"), TraceHitsAt(World, LiveLocation.X, Target));
+	TestFalse(TEXT("Restored: trace at the historical location misses"), TraceHitsAt(World, PastLocation.X, Target));
+
+	LagComp->UnregisterTarget_Server(Target);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,110 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/Match/Combat/Tests/MosesWeaponSlotRuntimePerfTests.cpp
+// ----------------------------------------------------------------------------
+// Slot Runtime Cache 마이크로벤치 (Perf 필터)
+// - Before: 발사 1회마다 World -> GameInstance -> Registry -> ResolveWeaponData
+// - After : FMosesWeaponSlotRuntime[Slot] 1회 읽기
+// - 두 경로 모두 발사 경로가 읽는 필드(Interval/Damage/Spread)만 읽는다
+// ============================================================================
+
+#include "UE5_Multi_Shooter/Match/Characters/Player/Components/MosesCombatComponent.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponRegistrySubsystem.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponData.h"
+
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MosesWeaponSlotRuntimePerfTests_Private
+{
+	static constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter;
+
+	static constexpr int32 NumIterations = 200000;
+
+	/** 기존 발사 경로 (캐시 도입 전): 호출마다 Registry 조회 */
+	static float ReadFireParams_Resolve(const UWorld* World, const FGameplayTag& WeaponId)
+	{
+		const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+		const UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr;
+		const UMosesWeaponData* Data = Registry ? Registry->ResolveWeaponData(WeaponId) : nullptr;
+		if (!Data)
+		{
+			return 0.0f;
+		}
+
+		return FMath::Max(0.03f, Data->FireIntervalSec) + Data->Damage + Data->SpreadDegrees_Max;
+	}
+
+	/** 캐시 경로: 슬롯 구조체 1개 */
+	static float ReadFireParams_Cached(const FMosesWeaponSlotRuntime& Runtime)
+	{
+		return Runtime.FireIntervalSec + Runtime.Damage + Runtime.SpreadDegreesMax;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMosesWeaponSlotRuntimePerfTest, "Moses.Combat.Perf.WeaponSlotRuntime", MosesWeaponSlotRuntimePerfTests_Private::TestFlags)
+
+bool FMosesWeaponSlotRuntimePerfTest::RunTest(const FString& Parameters)
+{
+	using namespace MosesWeaponSlotRuntimePerfTests_Private;
+
+	UGameInstance* GI = NewObject<UGameInstance>(GEngine);
+	GI->InitializeStandalone();
+
+	const UWorld* World = GI->GetWorld();
+	const UMosesWeaponRegistrySubsystem* Registry = GI->GetSubsystem<UMosesWeaponRegistrySubsystem>();
+
+	const FGameplayTag WeaponId = Registry ? Registry->GetWeaponIdByNetIndex(1) : FGameplayTag();
+	const UMosesWeaponData* Data = WeaponId.IsValid() ? Registry->ResolveWeaponData(WeaponId) : nullptr;
+	if (!Data)
+	{
+		AddWarning(TEXT("No weapon data indexed by the registry; benchmark skipped."));
+		GI->Shutdown();
+		return true;
+	}
+
+	// RebuildSlotRuntime과 같은 값으로 4슬롯 구성
+	FMosesWeaponSlotRuntime Slots[4];
+	for (FMosesWeaponSlotRuntime& Runtime : Slots)
+	{
+		Runtime.WeaponData = Data;
+		Runtime.WeaponId = WeaponId;
+		Runtime.FireIntervalSec = FMath::Max(0.03f, Data->FireIntervalSec);
+		Runtime.SpreadDegreesMin = Data->SpreadDegrees_Min;
+		Runtime.SpreadDegreesMax = Data->SpreadDegrees_Max;
+		Runtime.Damage = Data->Damage;
+	}
+
+	volatile float Sink = 0.0f;
+
+	const double ResolveStart = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumIterations; ++Index)
+	{
+		Sink = Sink + ReadFireParams_Resolve(World, WeaponId);
+	}
+	const double ResolveSec = FPlatformTime::Seconds() - ResolveStart;
+
+	const double CachedStart = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumIterations; ++Index)
+	{
+		Sink = Sink + ReadFireParams_Cached(Slots[Index & 3]);
+	}
+	const double CachedSec = FPlatformTime::Seconds() - CachedStart;
+
+	const double ResolveNs = ResolveSec * 1e9 / NumIterations;
+	const double CachedNs = CachedSec * 1e9 / NumIterations;
+
+	AddInfo(FString::Printf(TEXT("[PERF] FireParams Resolve=%.1f ns/shot Cached=%.1f ns/shot (x%.1f) Weapon=%s"),
+		ResolveNs, CachedNs, CachedNs > 0.0 ? ResolveNs / CachedNs : 0.0, *WeaponId.ToString()));
+
+	TestTrue(TEXT("Cached slot runtime is not slower than registry resolve"), CachedSec <= ResolveSec);
+
+	GI->Shutdown();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -26,6 +26,7 @@
 // [DAY10]
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesZombieSpawnSpot.h"
 #include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/Actor/MosesSpotRespawnManager.h"
+#include "UE5_Multi_Shooter/Match/Characters/Enemy/Zombie/AI/MosesZombieDirectorSubsystem.h"
 
 #include "UE5_Multi_Shooter/Match/UI/Match/MosesPickupPromptWidget.h"
 
@@ -106,6 +107,15 @@ void AMosesFlagSpot::BeginPlay()
 
 	ApplyDormancyPolicy_ServerOnly();
 	ValidateLinkedSpawnSpot_ServerOnly();
+
+	// [ADD] 점령 활동 → 주변 좀비 AI LOD 승격 (서버)
+	if (HasAuthority())
+	{
+		if (UMosesZombieDirectorSubsystem* Director = GetWorld() ? GetWorld()->GetSubsystem<UMosesZombieDirectorSubsystem>() : nullptr)
+		{
+			Director->RegisterFlagSpot_Server(this);
+		}
+	}
 }
 
 void AMosesFlagSpot::ApplyDormancyPolicy_ServerOnly()
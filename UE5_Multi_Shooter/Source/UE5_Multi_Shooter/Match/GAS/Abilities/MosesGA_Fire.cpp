@@ -4,7 +4,6 @@
 #include "UE5_Multi_Shooter/Match/Characters/Player/Components/MosesCombatComponent.h"
 #include "UE5_Multi_Shooter/MosesLogChannels.h"
 
-#include "Abilities/Tasks/AbilityTask_WaitDelay.h"
 #include "Abilities/Tasks/AbilityTask_WaitInputRelease.h"
 
 UMosesGA_Fire::UMosesGA_Fire()
@@ -37,101 +36,54 @@ void UMosesGA_Fire::ActivateAbility(
 		return;
 	}
 
-	bWantsToFire = true;
-
-	// ✅ Release 감지: 이제 로컬에서 확실히 잡힘 (LocalPredicted)
-	if (UAbilityTask_WaitInputRelease* WaitRelease = UAbilityTask_WaitInputRelease::WaitInputRelease(this, true))
-	{
-		WaitRelease->OnRelease.AddDynamic(this, &ThisClass::OnInputReleased);
-		WaitRelease->ReadyForActivation();
-	}
-
-	// 첫 발
-	FireOnce(Handle, ActorInfo, ActivationInfo);
-
-	// 다음 발 예약
-	if (FireIntervalSeconds > 0.0f)
-	{
-		if (UAbilityTask_WaitDelay* WaitDelay = UAbilityTask_WaitDelay::WaitDelay(this, FireIntervalSeconds))
-		{
-			WaitDelay->OnFinish.AddDynamic(this, &ThisClass::OnFireDelayFinished);
-			WaitDelay->ReadyForActivation();
-		}
-	}
-}
-
-void UMosesGA_Fire::FireOnce(
-	const FGameplayAbilitySpecHandle Handle,
-	const FGameplayAbilityActorInfo* ActorInfo,
-	const FGameplayAbilityActivationInfo ActivationInfo)
-{
-	AMosesPlayerState* PS = ActorInfo ? Cast<AMosesPlayerState>(ActorInfo->OwnerActor.Get()) : nullptr;
-	if (!PS)
+	UMosesCombatComponent* CombatComp = ResolveCombatComponent(ActorInfo);
+	if (!CombatComp)
 	{
-		UE_LOG(LogMosesGAS, Warning, TEXT("[GAS][GA_Fire] Reject (NoPS)"));
+		UE_LOG(LogMosesGAS, Warning, TEXT("[GAS][GA_Fire] Reject (NoCombatComponent)"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
 
-	UMosesCombatComponent* CombatComp = PS->FindComponentByClass<UMosesCombatComponent>();
-	if (!CombatComp)
+	// ✅ Release 감지: 이제 로컬에서 확실히 잡힘 (LocalPredicted)
+	if (UAbilityTask_WaitInputRelease* WaitRelease = UAbilityTask_WaitInputRelease::WaitInputRelease(this, true))
 	{
-		UE_LOG(LogMosesGAS, Warning, TEXT("[GAS][GA_Fire] Reject (NoCombatComponent) PS=%s"), *GetNameSafe(PS));
-		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
-		return;
+		WaitRelease->OnRelease.AddDynamic(this, &ThisClass::OnInputReleased);
+		WaitRelease->ReadyForActivation();
 	}
 
 	// ============================================================
-	// ✅ 핵심: "로컬 컨트롤"에서만 RequestFire를 호출한다.
-	// - Dedicated 서버/서버측 Ability 인스턴스에서도 실행되지만
-	//   LocallyControlled가 아니면 여기서 막아서 "중복 발사" 방지.
-	// - 원격 클라: 클라(로컬)에서 1번 호출 -> Server RPC/서버 권위 루트로 처리
-	// - 리슨서버 로컬플레이어: LocallyControlled=true 이므로 호출됨(서버 권위로 바로 처리)
+	// ✅ 핵심: "로컬 컨트롤"에서만 연사 시작.
+	// - 발사 타이밍은 CombatComp FireScheduler가 계산 (입력 경로와 공유 → 중복 발사 없음)
+	// - 서버측 Ability 인스턴스는 아무것도 하지 않는다 (서버는 Command Stream만 처리)
 	// ============================================================
 	if (ActorInfo && ActorInfo->IsLocallyControlled())
 	{
-		CombatComp->RequestFire();
+		CombatComp->RequestStartFire();
+
 		UE_LOG(LogMosesGAS, Verbose,
-			TEXT("[GAS][GA_Fire] FireOnce -> RequestFire (LocallyControlled) PS=%s"),
-			*GetNameSafe(PS));
-	}
-	else
-	{
-		UE_LOG(LogMosesGAS, VeryVerbose,
-			TEXT("[GAS][GA_Fire] FireOnce SKIP (NotLocallyControlled) PS=%s"),
-			*GetNameSafe(PS));
+			TEXT("[GAS][GA_Fire] Activate -> RequestStartFire Interval=%.3f PS=%s"),
+			CombatComp->GetFireIntervalSec(), *GetNameSafe(CombatComp->GetOwner()));
 	}
 }
 
-void UMosesGA_Fire::OnFireDelayFinished()
+UMosesCombatComponent* UMosesGA_Fire::ResolveCombatComponent(const FGameplayAbilityActorInfo* ActorInfo) const
 {
-	if (!bWantsToFire)
-	{
-		UE_LOG(LogMosesGAS, Verbose, TEXT("[GAS][GA_Fire] Stop (InputReleased)"));
-
-		// ✅ 끝낼 때 replicate true (서버/클라 정리)
-		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
-		return;
-	}
-
-	FireOnce(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo);
+	AMosesPlayerState* PS = ActorInfo ? Cast<AMosesPlayerState>(ActorInfo->OwnerActor.Get()) : nullptr;
+	return PS ? PS->FindComponentByClass<UMosesCombatComponent>() : nullptr;
+}
 
-	// 다음 발 계속 예약
-	if (FireIntervalSeconds > 0.0f)
-	{
-		if (UAbilityTask_WaitDelay* WaitDelay = UAbilityTask_WaitDelay::WaitDelay(this, FireIntervalSeconds))
-		{
-			WaitDelay->OnFinish.AddDynamic(this, &ThisClass::OnFireDelayFinished);
-			WaitDelay->ReadyForActivation();
-		}
-	}
+bool UMosesGA_Fire::IsFiring() const
+{
+	const UMosesCombatComponent* CombatComp = ResolveCombatComponent(CurrentActorInfo);
+	return CombatComp && CombatComp->IsFireTriggerHeld();
 }
 
 void UMosesGA_Fire::OnInputReleased(float /*TimeHeldSeconds*/)
 {
-	bWantsToFire = false;
+	UE_LOG(LogMosesGAS, Verbose, TEXT("[GAS][GA_Fire] OnInputReleased -> Stop"));
 
-	UE_LOG(LogMosesGAS, Verbose, TEXT("[GAS][GA_Fire] OnInputReleased -> bWantsToFire=0"));
+	// ✅ 끝낼 때 replicate true (서버/클라 정리)
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
 void UMosesGA_Fire::EndAbility(
@@ -141,7 +93,13 @@ void UMosesGA_Fire::EndAbility(
 	bool bReplicateEndAbility,
 	bool bWasCancelled)
 {
-	bWantsToFire = false;
+	if (ActorInfo && ActorInfo->IsLocallyControlled())
+	{
+		if (UMosesCombatComponent* CombatComp = ResolveCombatComponent(ActorInfo))
+		{
+			CombatComp->RequestStopFire();
+		}
+	}
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
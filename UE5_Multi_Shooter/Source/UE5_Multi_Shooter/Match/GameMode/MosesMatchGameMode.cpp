@@ -19,6 +19,7 @@
 
 #include "UE5_Multi_Shooter/System/MosesAuthorityGuards.h"
 #include "UE5_Multi_Shooter/Persist/MosesMatchRecordStorageSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectilePoolSubsystem.h"
 
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerController.h"
@@ -339,6 +340,12 @@ void AMosesMatchGameMode::SetMatchPhase(EMosesMatchPhase NewPhase)
 		bRecordSavedThisMatch = false;
 		bResultComputedThisMatch = false;
 		UE_LOG(LogMosesPhase, Warning, TEXT("[PHASE][SV] Reset Match Guards (Result/Persist)"));
+
+		// 유탄 Projectile 풀 미리 채우기 (Combat 중 SpawnActor/채널 Open 제거)
+		if (UMosesProjectilePoolSubsystem* ProjectilePool = GetWorld() ? GetWorld()->GetSubsystem<UMosesProjectilePoolSubsystem>() : nullptr)
+		{
+			ProjectilePool->PrewarmFromWeaponRegistry_Server();
+		}
 	}
 
 	// 1) Phase에 맞춰 Experience 전환
@@ -1,6 +1,8 @@
 ﻿#include "UE5_Multi_Shooter/Match/GameState/MosesMatchGameState.h"
 
 #include "UE5_Multi_Shooter/Experience/MosesExperienceManagerComponent.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponRegistrySubsystem.h"
+#include "Engine/GameInstance.h"
 #include "TimerManager.h"
 
 #include "Net/Core/PushModel/PushModel.h"
@@ -20,6 +22,17 @@ void AMosesMatchGameState::BeginPlay()
 		*GetNameSafe(GetWorld()),
 		(int32)GetNetMode(),
 		*GetNameSafe(GetExperienceManagerComponent()));
+
+	// [ADD] 무기 NetIndex 검증용 체크섬 (서버 값이 기준)
+	if (HasAuthority())
+	{
+		const UGameInstance* GI = GetGameInstance();
+		if (const UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr)
+		{
+			WeaponNetIndexChecksum = Registry->GetNetIndexChecksum();
+			MARK_PROPERTY_DIRTY_FROM_NAME(AMosesMatchGameState, WeaponNetIndexChecksum, this);
+		}
+	}
 }
 
 void AMosesMatchGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -30,6 +43,7 @@ void AMosesMatchGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 	DOREPLIFETIME(AMosesMatchGameState, MatchPhase);
 	DOREPLIFETIME(AMosesMatchGameState, AnnouncementState);
 	DOREPLIFETIME(AMosesMatchGameState, ResultState);
+	DOREPLIFETIME(AMosesMatchGameState, WeaponNetIndexChecksum);
 }
 
 // ============================================================================
@@ -329,6 +343,15 @@ void AMosesMatchGameState::OnRep_ResultState()
 	OnResultStateChanged.Broadcast(ResultState);
 }
 
+void AMosesMatchGameState::OnRep_WeaponNetIndexChecksum()
+{
+	const UGameInstance* GI = GetGameInstance();
+	if (const UMosesWeaponRegistrySubsystem* Registry = GI ? GI->GetSubsystem<UMosesWeaponRegistrySubsystem>() : nullptr)
+	{
+		Registry->VerifyNetIndexChecksum(WeaponNetIndexChecksum);
+	}
+}
+
 // ============================================================================
 // Server-local delegate broadcast
 // ============================================================================
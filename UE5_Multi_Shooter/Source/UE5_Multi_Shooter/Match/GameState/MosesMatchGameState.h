@@ -138,6 +138,9 @@ private:
 	UFUNCTION()
 	void OnRep_ResultState();
 
+	UFUNCTION()
+	void OnRep_WeaponNetIndexChecksum();
+
 private:
 	// -------------------------------------------------------------------------
 	// Server tick (1초)
@@ -165,6 +168,10 @@ private:
 	UPROPERTY(ReplicatedUsing = OnRep_ResultState)
 	FMosesMatchResultState ResultState;
 
+	// 서버 무기 NetIndex 목록 CRC (클라 Registry와 불일치 시 Error)
+	UPROPERTY(ReplicatedUsing = OnRep_WeaponNetIndexChecksum)
+	uint32 WeaponNetIndexChecksum = 0;
+
 private:
 	// -------------------------------------------------------------------------
 	// Server-only
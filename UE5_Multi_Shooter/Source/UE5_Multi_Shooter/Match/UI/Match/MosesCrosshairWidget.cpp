@@ -18,6 +18,7 @@ void UMosesCrosshairWidget::NativeOnInitialized()
 	// [MOD] 초기화 시점에 베이스 오프셋 캐시 + 수렴 상태로 시작
 	CacheBaseOffsetsIfNeeded();
 	SetSpreadFactor(0.0f);
+	HideHitMarker();
 }
 
 void UMosesCrosshairWidget::CacheBaseOffsetsIfNeeded()
@@ -88,3 +89,24 @@ void UMosesCrosshairWidget::SetSpreadFactor(float InSpreadFactor01)
 	ApplyOffset(Img_Left, BaseLeft, FVector2D(-Pixels, 0.0f));
 	ApplyOffset(Img_Right, BaseRight, FVector2D(Pixels, 0.0f));
 }
+
+void UMosesCrosshairWidget::ShowHitMarker(bool bHeadshot)
+{
+	if (!Img_HitMarker)
+	{
+		return;
+	}
+
+	Img_HitMarker->SetColorAndOpacity(bHeadshot ? HeadshotMarkerColor : HitMarkerColor);
+	Img_HitMarker->SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+void UMosesCrosshairWidget::HideHitMarker()
+{
+	if (!Img_HitMarker)
+	{
+		return;
+	}
+
+	Img_HitMarker->SetVisibility(ESlateVisibility::Collapsed);
+}
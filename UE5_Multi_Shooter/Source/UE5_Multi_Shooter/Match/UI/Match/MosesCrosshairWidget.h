@@ -17,6 +17,7 @@ class UImage;
  * - UMG Tick 금지
  * - UMG Designer Binding 금지
  * - HUD가 Timer로 SpreadFactor(0~1)을 계산해서 SetSpreadFactor로만 전달한다.
+ * - 히트마커 표시/숨김도 HUD가 Hit Confirm 이벤트 + Timer로 호출한다.
  */
 UCLASS(Abstract)
 class UE5_MULTI_SHOOTER_API UMosesCrosshairWidget : public UUserWidget
@@ -29,6 +30,10 @@ public:
 	/** SpreadFactor(0=수렴, 1=확산) */
 	void SetSpreadFactor(float InSpreadFactor01);
 
+	/** 히트마커 (예측/확정 공용, 취소 시 Hide) */
+	void ShowHitMarker(bool bHeadshot);
+	void HideHitMarker();
+
 protected:
 	//~UUserWidget interface
 	virtual void NativeOnInitialized() override;
@@ -53,6 +58,9 @@ private:
 	UPROPERTY(meta = (BindWidgetOptional))
 	TObjectPtr<UImage> Img_CenterDot = nullptr;
 
+	UPROPERTY(meta = (BindWidgetOptional))
+	TObjectPtr<UImage> Img_HitMarker = nullptr;
+
 private:
 	/** SpreadFactor=0일 때 추가 간격(픽셀) */
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Crosshair", meta = (ClampMin = "0.0"))
@@ -62,6 +70,12 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Crosshair", meta = (ClampMin = "0.0"))
 	float MaxSpreadPixels = 18.0f;
 
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Crosshair|HitMarker")
+	FLinearColor HitMarkerColor = FLinearColor::White;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Crosshair|HitMarker")
+	FLinearColor HeadshotMarkerColor = FLinearColor::Red;
+
 private:
 	bool bCachedBase = false;
 
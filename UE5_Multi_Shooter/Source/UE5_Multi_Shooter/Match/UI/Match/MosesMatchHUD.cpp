@@ -11,6 +11,7 @@
 
 #include "UE5_Multi_Shooter/Match/UI/Match/MosesMatchAnnouncementWidget.h"
 #include "UE5_Multi_Shooter/Match/UI/Match/MosesCrosshairWidget.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesSpreadModel.h"
 #include "UE5_Multi_Shooter/Match/UI/Match/MosesScopeWidget.h"
 
 #include "UE5_Multi_Shooter/Match/Flag/MosesCaptureComponent.h"
@@ -412,6 +413,7 @@ void UMosesMatchHUD::BindToCombatComponent_FromPlayerState()
 	Combat->OnEquippedChanged.AddUObject(this, &ThisClass::HandleEquippedChanged_FromCombat);
 	Combat->OnReloadingChanged.AddUObject(this, &ThisClass::HandleReloadingChanged_FromCombat);
 	Combat->OnSlotsStateChanged.AddUObject(this, &ThisClass::HandleSlotsStateChanged_FromCombat);
+	Combat->OnHitConfirm.AddUObject(this, &ThisClass::HandleHitConfirm_FromCombat);
 
 	HandleAmmoChangedEx_FromCombat(
 		Combat->GetCurrentMagAmmo(),
@@ -430,6 +432,7 @@ void UMosesMatchHUD::UnbindCombatComponent()
 		Combat->OnEquippedChanged.RemoveAll(this);
 		Combat->OnReloadingChanged.RemoveAll(this);
 		Combat->OnSlotsStateChanged.RemoveAll(this);
+		Combat->OnHitConfirm.RemoveAll(this);
 	}
 
 	CachedCombatComponent.Reset();
@@ -601,8 +604,13 @@ float UMosesMatchHUD::CalculateCrosshairSpreadFactor_Local() const
 		return 0.0f;
 	}
 
-	const float Speed2D = Pawn->GetVelocity().Size2D();
-	return FMath::Clamp(Speed2D / 600.0f, 0.0f, 1.0f);
+	// 서버 스프레드와 같은 정규화 (무기별 SpreadSpeedRef)
+	if (const UMosesCombatComponent* Combat = CachedCombatComponent.Get())
+	{
+		return Combat->CalcSpreadFactor01(Pawn);
+	}
+
+	return FMosesSpreadModel::CalcSpreadFactor01(Pawn->GetVelocity().Size2D(), 600.0f);
 }
 
 void UMosesMatchHUD::TickCrosshairUpdate()
@@ -847,6 +855,47 @@ void UMosesMatchHUD::HandleSlotsStateChanged_FromCombat(int32 /*ChangedSlotOr0Fo
 	UpdateSlotPanels_All();
 }
 
+void UMosesMatchHUD::HandleHitConfirm_FromCombat(EMosesHitConfirm Type, bool bHeadshot)
+{
+	UWorld* World = GetWorld();
+	if (!World || !CrosshairWidget)
+	{
+		return;
+	}
+
+	// 예측 헤드샷이 부정됨 → 토스트도 같이 회수
+	const bool bRevokeHeadshot = (Type == EMosesHitConfirm::Retracted) || (Type == EMosesHitConfirm::Confirmed && !bHeadshot);
+	if (bRevokeHeadshot && bLocalHeadshotToastActive)
+	{
+		World->GetTimerManager().ClearTimer(LocalHeadshotToastTimerHandle);
+		StopLocalHeadshotToast_Internal();
+	}
+
+	if (Type == EMosesHitConfirm::Retracted)
+	{
+		World->GetTimerManager().ClearTimer(HitMarkerTimerHandle);
+		CrosshairWidget->HideHitMarker();
+		return;
+	}
+
+	// Predicted / Confirmed: 같은 표시 (Confirmed는 늦은 히트 또는 헤드샷 보정)
+	CrosshairWidget->ShowHitMarker(bHeadshot);
+
+	TWeakObjectPtr<UMosesCrosshairWidget> WeakCrosshair = CrosshairWidget;
+	World->GetTimerManager().SetTimer(HitMarkerTimerHandle, FTimerDelegate::CreateWeakLambda(this, [WeakCrosshair]()
+	{
+		if (UMosesCrosshairWidget* Crosshair = WeakCrosshair.Get())
+		{
+			Crosshair->HideHitMarker();
+		}
+	}), FMath::Max(0.01f, HitMarkerDuration), false);
+
+	if (bHeadshot)
+	{
+		ShowHeadshotToast_Local(FText::FromString(TEXT("헤드샷!")), HeadshotToastDuration);
+	}
+}
+
 // ============================================================================
 // MatchGameState Handlers
 // ============================================================================
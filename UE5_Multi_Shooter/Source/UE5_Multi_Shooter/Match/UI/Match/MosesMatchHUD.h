@@ -29,6 +29,8 @@ class UMosesMatchAnnouncementWidget;
 class UMosesCrosshairWidget;
 class UMosesScopeWidget;
 
+enum class EMosesHitConfirm : uint8;
+
 class UMosesCombatComponent;
 class UMosesWeaponData;
 
@@ -110,6 +112,7 @@ private:
 	void HandleEquippedChanged_FromCombat(int32 SlotIndex, FGameplayTag WeaponId);
 	void HandleReloadingChanged_FromCombat(bool bReloading);
 	void HandleSlotsStateChanged_FromCombat(int32 ChangedSlotOr0ForAll);
+	void HandleHitConfirm_FromCombat(EMosesHitConfirm Type, bool bHeadshot);
 
 private:
 	// MatchGameState handlers
@@ -233,6 +236,15 @@ private:
 
 	float LastLoggedCrosshairSpread = -1.0f;
 
+	// Hit marker (예측 즉시 표시 → Retract 시 즉시 숨김)
+	FTimerHandle HitMarkerTimerHandle;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|HUD|Crosshair")
+	float HitMarkerDuration = 0.15f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|HUD|Crosshair")
+	float HeadshotToastDuration = 0.8f;
+
 private:
 	// ✅ Respawn notice (Victim only)
 	FTimerHandle RespawnNoticeTimerHandle;
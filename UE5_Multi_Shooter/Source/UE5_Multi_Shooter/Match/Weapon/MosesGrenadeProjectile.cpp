@@ -3,17 +3,21 @@
 #include "UE5_Multi_Shooter/MosesLogChannels.h"
 #include "UE5_Multi_Shooter/Match/GAS/MosesGameplayTags.h"
 #include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponData.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectilePoolSubsystem.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesRadialDamage.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesProjectileManagerSubsystem.h"
 
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 
 #include "Engine/World.h"
-#include "Engine/OverlapResult.h"
 #include "Engine/EngineTypes.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
 
 #include "Kismet/GameplayStatics.h"
 
-#include "AbilitySystemInterface.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayEffect.h"
 #include "GameplayEffectTypes.h"
@@ -62,22 +66,32 @@ void AMosesGrenadeProjectile::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (HasAuthority())
-	{
-		SpawnWorldTimeSeconds_Server = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f; // [MOD]
-	}
+	// [MOD] Arming 기준 시각은 Launch_Server에서 (풀 재사용 시 발사마다 갱신)
 
 	if (Collision)
 	{
 		// [MOD] Overlap 바인딩 삭제 → Hit 바인딩으로 교체
 		Collision->OnComponentHit.AddDynamic(this, &ThisClass::OnCollisionHit);
 	}
+
+	// [ADD] 클라: 예측 보정용 보간 (충돌 루트는 권위 위치로, 비주얼 자식만 부드럽게 따라감)
+	if (!HasAuthority() && Movement && Collision)
+	{
+		const TArray<USceneComponent*>& Children = Collision->GetAttachChildren();
+		if (Children.Num() > 0 && Children[0])
+		{
+			Movement->SetInterpolatedComponent(Children[0]);
+			Movement->bInterpMovement = true;
+			Movement->InterpLocationTime = FMath::Max(0.01f, PredictionCorrectionSeconds);
+		}
+	}
 }
 
 void AMosesGrenadeProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 	DOREPLIFETIME(AMosesGrenadeProjectile, bExploded);
+	DOREPLIFETIME(AMosesGrenadeProjectile, LaunchState);
 }
 
 void AMosesGrenadeProjectile::InitFromCombat_Server(
@@ -100,19 +114,221 @@ void AMosesGrenadeProjectile::InitFromCombat_Server(
 	DamageCauser = InDamageCauser;
 	WeaponData = InWeaponData;
 
+	// [ADD] 감쇠/차폐 파라미터 (데이터 없으면 기본값 = 전 반경 풀 데미지 + LOS)
+	if (InWeaponData)
+	{
+		InnerRadius = InWeaponData->ResolveExplosionInnerRadius(Radius);
+		FalloffExponent = FMath::Max(0.1f, InWeaponData->ExplosionFalloffExponent);
+		MinDamageScale = FMath::Clamp(InWeaponData->ExplosionMinDamageScale, 0.0f, 1.0f);
+		bRequireLineOfSight = InWeaponData->bExplosionRequiresLineOfSight;
+	}
+
 	ConfigureIgnoreActors_Server(); // [MOD] self-hit 방지
 }
 
-void AMosesGrenadeProjectile::Launch_Server(const FVector& Dir, float Speed)
+void AMosesGrenadeProjectile::Launch_Server(const FVector& Dir, float Speed, uint16 PredictionShotSeq)
 {
 	check(HasAuthority());
 
+	SpawnWorldTimeSeconds_Server = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f; // [MOD]
+
+	const FVector Vel = Dir.GetSafeNormal() * FMath::Max(1.0f, Speed);
+	RestartMovement(GetActorLocation(), Vel);
+
+	// 클라: Serial 변경 → 같은 원점/속도로 시뮬레이션 재시작 (풀 재사용 포함)
+	LaunchState.Origin = GetActorLocation();
+	LaunchState.Velocity = Vel;
+	LaunchState.PredictionShotSeq = PredictionShotSeq;
+	++LaunchState.Serial;
+
+	const AGameStateBase* GS = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+	LaunchState.ServerLaunchTime = GS ? GS->GetServerWorldTimeSeconds() : SpawnWorldTimeSeconds_Server;
+
+	ForceNetUpdate();
+}
+
+float AMosesGrenadeProjectile::GetSimGravityScale() const
+{
+	return Movement ? Movement->ProjectileGravityScale : 1.0f;
+}
+
+float AMosesGrenadeProjectile::GetSimCollisionRadius() const
+{
+	return Collision ? Collision->GetUnscaledSphereRadius() : 12.0f;
+}
+
+void AMosesGrenadeProjectile::RestartMovement(const FVector& Origin, const FVector& Velocity)
+{
+	if (!Movement || !Collision)
+	{
+		return;
+	}
+
+	SetActorLocationAndRotation(Origin, Velocity.Rotation(), false, nullptr, ETeleportType::TeleportPhysics);
+
+	// Hit로 정지하면 UpdatedComponent가 해제되므로 발사마다 다시 지정
+	Movement->SetUpdatedComponent(Collision);
+
+	if (Movement->bInterpMovement)
+	{
+		Movement->ResetInterpolation();
+	}
+
+	Movement->Velocity = Velocity;
+	Movement->Activate(true); // [MOD] 명시적으로 활성화
+}
+
+void AMosesGrenadeProjectile::OnRep_LaunchState()
+{
+	if (LaunchState.Serial == 0)
+	{
+		return;
+	}
+
+	if (TryReconcilePrediction_Local())
+	{
+		return;
+	}
+
+	RestartMovement(LaunchState.Origin, LaunchState.Velocity);
+}
+
+bool AMosesGrenadeProjectile::TryReconcilePrediction_Local()
+{
+	const APawn* OwnerPawn = GetInstigator();
+	UWorld* World = GetWorld();
+	if (LaunchState.PredictionShotSeq == 0 || !World || !OwnerPawn || !OwnerPawn->IsLocallyControlled())
+	{
+		return false;
+	}
+
+	UMosesProjectileManagerSubsystem* Manager = World->GetSubsystem<UMosesProjectileManagerSubsystem>();
+
+	FVector PredictedLocation;
+	if (!Manager || !Manager->ConsumePrediction_Local(OwnerPawn, LaunchState.PredictionShotSeq, PredictedLocation))
+	{
+		return false;
+	}
+
+	// 권위 탄도를 경과 시간만큼 앞당김 (충돌 없는 탄도식 근사, 예측과 같은 식)
+	const AGameStateBase* GS = World->GetGameState();
+	const float ServerNow = GS ? GS->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+	const float Elapsed = FMath::Clamp(ServerNow - LaunchState.ServerLaunchTime, 0.0f, UMosesProjectileManagerSubsystem::PredictionTimeoutSec);
+
+	const float GravityZ = World->GetGravityZ() * GetSimGravityScale();
+	const FVector Velocity = FVector(LaunchState.Velocity) + FVector(0.0f, 0.0f, GravityZ * Elapsed);
+	const FVector AuthLocation = FVector(LaunchState.Origin)
+		+ FVector(LaunchState.Velocity) * Elapsed
+		+ FVector(0.0f, 0.0f, 0.5f * GravityZ * Elapsed * Elapsed);
+
+	// 예측 위치에서 시작 → 충돌 루트만 권위 위치로, 비주얼은 InterpLocationTime 동안 따라감
+	RestartMovement(PredictedLocation, Velocity);
+
+	if (Movement && Movement->bInterpMovement)
+	{
+		Movement->MoveInterpolationTarget(AuthLocation, Velocity.Rotation());
+	}
+	else
+	{
+		SetActorLocation(AuthLocation, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+
+	UE_LOG(LogMosesCombat, Verbose, TEXT("[GRENADE][CL] Predict Reconcile Seq=%u Error=%.1f Elapsed=%.3f"),
+		LaunchState.PredictionShotSeq, FVector::Dist(PredictedLocation, AuthLocation), Elapsed);
+
+	return true;
+}
+
+void AMosesGrenadeProjectile::InitCosmetic_Local(float SafetyLifeSpan)
+{
+	bCosmeticOnly = true;
+
+	SetReplicates(false);
+	SetActorEnableCollision(false);
+
 	if (Movement)
 	{
-		const FVector Vel = Dir.GetSafeNormal() * FMath::Max(1.0f, Speed);
-		Movement->Velocity = Vel;
-		Movement->Activate(true); // [MOD] 명시적으로 활성화
+		Movement->StopMovementImmediately();
+		Movement->Deactivate();
 	}
+
+	// ProjectileManager가 정리 못 한 경우 대비
+	SetLifeSpan(SafetyLifeSpan);
+}
+
+void AMosesGrenadeProjectile::MarkPooled_Server(UMosesProjectilePoolSubsystem* InPool)
+{
+	check(HasAuthority());
+
+	OwningPool = InPool;
+
+	// 대기 중(숨김+충돌 OFF)에도 Relevant 유지 → 채널이 닫히지 않음
+	bAlwaysRelevant = true;
+}
+
+void AMosesGrenadeProjectile::ActivateFromPool_Server(const FVector& Location, const FRotator& Rotation, APawn* OwnerPawn)
+{
+	check(HasAuthority());
+
+	bPoolActive = true;
+	bExploded = false;
+
+	SetOwner(OwnerPawn);
+	SetInstigator(OwnerPawn);
+
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+}
+
+void AMosesGrenadeProjectile::DeactivateToPool_Server()
+{
+	check(HasAuthority());
+
+	GetWorldTimerManager().ClearTimer(PostExplodeTimerHandle);
+
+	if (Movement)
+	{
+		Movement->StopMovementImmediately();
+		Movement->Deactivate();
+	}
+
+	if (Collision)
+	{
+		Collision->ClearMoveIgnoreActors();
+	}
+
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+
+	SourceASC.Reset();
+	DamageGE = nullptr;
+	DamageAmount = 0.0f;
+	InnerRadius = 450.0f;
+	FalloffExponent = 1.0f;
+	MinDamageScale = 1.0f;
+	bRequireLineOfSight = true;
+	InstigatorController.Reset();
+	DamageCauser.Reset();
+	WeaponData.Reset();
+
+	SetOwner(nullptr);
+	SetInstigator(nullptr);
+
+	bPoolActive = false;
+
+	ForceNetUpdate();
+}
+
+void AMosesGrenadeProjectile::HandlePostExplodeExpired_Server()
+{
+	if (UMosesProjectilePoolSubsystem* Pool = OwningPool.Get())
+	{
+		Pool->Release_Server(this);
+		return;
+	}
+
+	Destroy();
 }
 
 void AMosesGrenadeProjectile::ConfigureIgnoreActors_Server()
@@ -171,8 +387,8 @@ void AMosesGrenadeProjectile::OnCollisionHit(
 	FVector /*NormalImpulse*/,
 	const FHitResult& Hit)
 {
-	// OnHit는 모든 머신에서 호출될 수 있음 → 서버만 결정
-	if (!HasAuthority())
+	// OnHit는 모든 머신에서 호출될 수 있음 → 서버만 결정 (로컬 코스메틱도 로컬 권한이므로 제외)
+	if (!HasAuthority() || bCosmeticOnly)
 	{
 		return;
 	}
@@ -228,16 +444,21 @@ void AMosesGrenadeProjectile::Explode_Server(const FVector& ExplodeLocation, con
 		DamageAmount,
 		WeaponData.IsValid() ? *WeaponData->WeaponId.ToString() : TEXT("None"));
 
-	ApplyRadialDamage_Server(ExplodeLocation);
+	ApplyRadialDamage_Server(ExplodeLocation, HitNormal);
 
 	// 코스메틱은 멀티캐스트로 통일
 	Multicast_PlayExplodeFX(ExplodeLocation, HitNormal);
 
-	// 연출 여유 후 제거
-	SetLifeSpan(LifeSecondsAfterExplode);
+	// 연출 여유 후 반납 (풀 밖에서 스폰된 경우 제거)
+	GetWorldTimerManager().SetTimer(
+		PostExplodeTimerHandle,
+		this,
+		&ThisClass::HandlePostExplodeExpired_Server,
+		FMath::Max(0.01f, LifeSecondsAfterExplode),
+		false);
 }
 
-void AMosesGrenadeProjectile::ApplyRadialDamage_Server(const FVector& Center)
+void AMosesGrenadeProjectile::ApplyRadialDamage_Server(const FVector& Center, const FVector& HitNormal)
 {
 	UWorld* World = GetWorld();
 	if (!World)
@@ -245,8 +466,6 @@ void AMosesGrenadeProjectile::ApplyRadialDamage_Server(const FVector& Center)
 		return;
 	}
 
-	TArray<FOverlapResult> Results;
-
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(Moses_GrenadeOverlap), false);
 	Params.AddIgnoredActor(this);
 
@@ -260,95 +479,39 @@ void AMosesGrenadeProjectile::ApplyRadialDamage_Server(const FVector& Center)
 	{
 		Params.AddIgnoredActor(OwnerActor);
 	}
-	if (APawn* InstPawn = (InstigatorController.IsValid() ? InstigatorController->GetPawn() : nullptr))
-	{
-		Params.AddIgnoredActor(InstPawn);
-	}
-
-	const FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
 
-	// 대상 수집은 Pawn 채널로(플레이어/좀비)
-	const bool bAny = World->OverlapMultiByChannel(
-		Results,
-		Center,
-		FQuat::Identity,
-		ECC_Pawn,
-		Sphere,
-		Params);
-
-	int32 HitCount = 0;
-
-	for (const FOverlapResult& R : Results)
+	APawn* InstPawn = (InstigatorController.IsValid() ? InstigatorController->GetPawn() : nullptr);
+	if (InstPawn)
 	{
-		AActor* Target = R.GetActor();
-		if (!Target)
-		{
-			continue;
-		}
-
-		bool bAppliedByGAS = false;
-
-		// GAS 통일 적용
-		if (UAbilitySystemComponent* SrcASC = SourceASC.Get())
-		{
-			if (Target->GetClass()->ImplementsInterface(UAbilitySystemInterface::StaticClass()))
-			{
-				IAbilitySystemInterface* TargetASI = Cast<IAbilitySystemInterface>(Target);
-				UAbilitySystemComponent* TargetASC = TargetASI ? TargetASI->GetAbilitySystemComponent() : nullptr;
-
-				if (TargetASC && DamageGE)
-				{
-					FGameplayEffectContextHandle Ctx = SrcASC->MakeEffectContext();
-
-					// [MOD] Instigator/Causer 정리:
-					// - Instigator: 발사자 Pawn/Controller
-					// - EffectCauser: Projectile(this) 권장
-					APawn* InstPawn = (InstigatorController.IsValid() ? InstigatorController->GetPawn() : nullptr);
-					Ctx.AddInstigator(InstPawn, InstigatorController.Get());
-					Ctx.AddSourceObject(this);
-
-					if (WeaponData.IsValid())
-					{
-						Ctx.AddSourceObject(WeaponData.Get());
-					}
-
-					const FGameplayEffectSpecHandle SpecHandle = SrcASC->MakeOutgoingSpec(DamageGE, 1.f, Ctx);
-					if (SpecHandle.IsValid())
-					{
-						// 데미지는 음수로(기존 파이프라인 유지)
-						const float SignedDamage = -FMath::Abs(DamageAmount);
-						SpecHandle.Data->SetSetByCallerMagnitude(FMosesGameplayTags::Get().Data_Damage, SignedDamage);
-
-						SrcASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), TargetASC);
-
-						bAppliedByGAS = true;
-
-						UE_LOG(LogMosesGAS, Warning,
-							TEXT("[DAMAGE][SV] Grenade GAS To=%s Amount=%.1f"),
-							*GetNameSafe(Target),
-							DamageAmount);
-					}
-				}
-			}
-		}
-
-		// 폴백(ASC 없는 대상 대응)
-		if (!bAppliedByGAS)
-		{
-			UGameplayStatics::ApplyDamage(Target, DamageAmount, InstigatorController.Get(), this, nullptr);
-
-			UE_LOG(LogMosesCombat, Warning,
-				TEXT("[DAMAGE][SV] Grenade Fallback To=%s Amount=%.1f"),
-				*GetNameSafe(Target),
-				DamageAmount);
-		}
-
-		++HitCount;
+		Params.AddIgnoredActor(InstPawn);
 	}
 
-	UE_LOG(LogMosesCombat, Warning,
-		TEXT("[GRENADE][SV] ApplyRadialDamage Radius=%.1f Hits=%d Any=%d"),
-		Radius, HitCount, bAny ? 1 : 0);
+	// [MOD] 대상 수집 = 액터 단위 중복 제거 + 벽 차폐 + 거리 감쇠 (Pawn 채널: 플레이어/좀비)
+	FMosesRadialDamageParams RadialParams;
+	RadialParams.BaseDamage = DamageAmount;
+	RadialParams.InnerRadius = FMath::Min(InnerRadius, Radius);
+	RadialParams.OuterRadius = Radius;
+	RadialParams.FalloffExponent = FalloffExponent;
+	RadialParams.MinDamageScale = MinDamageScale;
+	RadialParams.bRequireLineOfSight = bRequireLineOfSight;
+	RadialParams.ImpactNormal = HitNormal;
+
+	TArray<FMosesRadialDamageTarget> Targets;
+	FMosesRadialDamage::CollectTargets(World, Center, RadialParams, Params, Targets);
+
+	FMosesRadialDamageSource Source;
+	Source.SourceASC = SourceASC.Get();
+	Source.DamageGE = DamageGE;
+	Source.InstigatorController = InstigatorController.Get();
+	Source.DamageCauser = this;
+	Source.SourceObject = this;
+	Source.WeaponData = WeaponData.Get();
+
+	const int32 HitCount = FMosesRadialDamage::ApplyToTargets_Server(World, Center, Targets, Source);
+
+	UE_LOG(LogMosesCombat, Log,
+		TEXT("[GRENADE][SV] ApplyRadialDamage Radius=%.1f Inner=%.1f LOS=%d Hits=%d"),
+		Radius, RadialParams.InnerRadius, bRequireLineOfSight ? 1 : 0, HitCount);
 }
 
 void AMosesGrenadeProjectile::Multicast_PlayExplodeFX_Implementation(
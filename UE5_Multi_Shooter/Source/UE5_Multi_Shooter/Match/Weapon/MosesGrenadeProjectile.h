@@ -11,6 +11,35 @@ class UProjectileMovementComponent;
 class UGameplayEffect;
 class UAbilitySystemComponent;
 class UMosesWeaponData;
+class UMosesProjectilePoolSubsystem;
+class UStaticMesh;
+
+/**
+ * 발사 상태 (풀 재사용 시 클라가 이동 시뮬레이션을 다시 시작하는 기준)
+ * - Serial이 바뀔 때마다 = 새 발사
+ */
+USTRUCT()
+struct FMosesGrenadeLaunchState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize Origin;
+
+	UPROPERTY()
+	FVector_NetQuantize Velocity;
+
+	UPROPERTY()
+	uint8 Serial = 0;
+
+	/** 발사자 클라 예측 매칭 키 (= ShotSeq, 0 = 예측 없음) */
+	UPROPERTY()
+	uint16 PredictionShotSeq = 0;
+
+	/** AGameStateBase::GetServerWorldTimeSeconds 기준 (예측 보정 시 경과 시간 계산) */
+	UPROPERTY()
+	float ServerLaunchTime = 0.0f;
+};
 
 /**
  * AMosesGrenadeProjectile
@@ -24,6 +53,19 @@ class UMosesWeaponData;
  *   - GAS SetByCaller(Data.Damage)로 데미지 적용
  *   - ASC 없는 대상은 ApplyDamage 폴백
  * - FX/SFX는 Multicast로 통일(코스메틱)
+ *
+ * [풀링]
+ * - UMosesProjectilePoolSubsystem이 Warmup에 미리 스폰 → 발사 시 재사용, 폭발 후 반납
+ * - 대기(Dormant) = 숨김 + 충돌/이동 OFF, 채널은 유지(AlwaysRelevant) → 재사용 시 채널 Open 비용 없음
+ * - 재사용 시 bExploded / Arming 시각 / 이동 상태를 Launch 단위로 초기화
+ *
+ * [발사 예측]
+ * - 발사자 클라는 UMosesProjectileManagerSubsystem에 예측 Projectile을 먼저 띄움
+ * - LaunchState.PredictionShotSeq로 인수 → 예측 위치에서 시작, ProjectileMovement 보간으로 권위 위치에 수렴
+ *
+ * [시뮬레이션 타입]
+ * - WeaponData.bSimulateProjectileWithoutActor면 액터를 띄우지 않고
+ *   UMosesProjectileManagerSubsystem이 이 클래스 CDO(중력/충돌 반경/FX/SimulatedMesh)를 타입 정의로 사용
  */
 UCLASS()
 class UE5_MULTI_SHOOTER_API AMosesGrenadeProjectile : public AActor
@@ -45,7 +87,35 @@ public:
 		const UMosesWeaponData* InWeaponData);
 
 	/** 서버: 발사 속도/방향 적용 */
-	void Launch_Server(const FVector& Dir, float Speed);
+	void Launch_Server(const FVector& Dir, float Speed, uint16 PredictionShotSeq = 0);
+
+	/** 발사자 클라 예측용 로컬 코스메틱 (충돌/이동 OFF, 위치는 ProjectileManager가 구동) */
+	void InitCosmetic_Local(float SafetyLifeSpan);
+
+	// =========================================================================
+	// Pool (Server)
+	// =========================================================================
+
+	/** 풀 소속 표시 (폭발 후 Destroy 대신 반납) */
+	void MarkPooled_Server(UMosesProjectilePoolSubsystem* InPool);
+
+	/** 대기 → 발사 위치로 이동 + 표시/충돌 ON (Init/Launch 전에 호출) */
+	void ActivateFromPool_Server(const FVector& Location, const FRotator& Rotation, APawn* OwnerPawn);
+
+	/** 폭발/정리 → 대기 상태 (숨김 + 충돌/이동 OFF + 런타임 캐시 초기화) */
+	void DeactivateToPool_Server();
+
+	bool IsPooledActive() const { return bPoolActive; }
+
+	// =========================================================================
+	// Simulation type (UMosesProjectileManagerSubsystem가 CDO에서 읽음)
+	// =========================================================================
+	float GetSimGravityScale() const;
+	float GetSimCollisionRadius() const;
+
+	UParticleSystem* GetExplosionVFX() const { return ExplosionVFX; }
+	USoundBase* GetExplosionSFX() const { return ExplosionSFX; }
+	UStaticMesh* GetSimulatedMesh() const { return SimulatedMesh; }
 
 protected:
 	virtual void BeginPlay() override;
@@ -64,8 +134,8 @@ private:
 	/** 서버만 */
 	void Explode_Server(const FVector& ExplodeLocation, const FHitResult* HitOpt);
 
-	/** 서버만 */
-	void ApplyRadialDamage_Server(const FVector& Center);
+	/** 서버만: 액터당 1회, 벽 뒤 제외, 거리 감쇠 (FMosesRadialDamage) */
+	void ApplyRadialDamage_Server(const FVector& Center, const FVector& HitNormal);
 
 	/** [MOD] 서버 스폰 직후 Self-hit 방지용 Ignore 설정 */
 	void ConfigureIgnoreActors_Server();
@@ -76,6 +146,19 @@ private:
 	UFUNCTION(NetMulticast, Unreliable)
 	void Multicast_PlayExplodeFX(const FVector& Center, const FVector& HitNormal);
 
+	/** 클라: 새 발사 → 이동 시뮬레이션 재시작 (발사자면 예측 인수 + 보간 보정) */
+	UFUNCTION()
+	void OnRep_LaunchState();
+
+	/** 발사자 클라: 예측 Projectile 위치에서 권위 위치로 보간 시작. 예측 없으면 false */
+	bool TryReconcilePrediction_Local();
+
+	/** 이동 컴포넌트 재시작 (서버/클라 공용) */
+	void RestartMovement(const FVector& Origin, const FVector& Velocity);
+
+	/** 폭발 연출 여유 후 반납/제거 */
+	void HandlePostExplodeExpired_Server();
+
 private:
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<USphereComponent> Collision = nullptr;
@@ -88,6 +171,18 @@ private:
 	UPROPERTY(Replicated)
 	bool bExploded = false;
 
+	UPROPERTY(ReplicatedUsing = OnRep_LaunchState)
+	FMosesGrenadeLaunchState LaunchState;
+
+	/** 로컬 코스메틱 (예측 비주얼) → 판정/폭발 없음 */
+	bool bCosmeticOnly = false;
+
+	/** 풀 (없으면 기존처럼 LifeSpan 후 Destroy) */
+	TWeakObjectPtr<UMosesProjectilePoolSubsystem> OwningPool;
+	bool bPoolActive = false;
+
+	FTimerHandle PostExplodeTimerHandle;
+
 private:
 	/** 서버 런타임 캐시(복제 필요 없음) */
 	TWeakObjectPtr<UAbilitySystemComponent> SourceASC;
@@ -96,6 +191,12 @@ private:
 	float DamageAmount = 0.0f;
 	float Radius = 450.0f;
 
+	/** [ADD] 감쇠/차폐 (WeaponData에서 캐시) */
+	float InnerRadius = 450.0f;
+	float FalloffExponent = 1.0f;
+	float MinDamageScale = 1.0f;
+	bool bRequireLineOfSight = true;
+
 	TWeakObjectPtr<AController> InstigatorController;
 	TWeakObjectPtr<AActor> DamageCauser;
 
@@ -107,6 +208,10 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Grenade")
 	float LifeSecondsAfterExplode = 1.0f;
 
+	/** 예측 → 권위 위치 보간 시간 (클라, ProjectileMovement Interp) */
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Grenade")
+	float PredictionCorrectionSeconds = 0.15f;
+
 	/** [MOD] 스폰 직후 self-hit 방지 arming 시간 */
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Grenade")
 	float ArmingSeconds = 0.06f;
@@ -120,4 +225,8 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, Category = "Moses|Grenade|FX")
 	TObjectPtr<USoundBase> ExplosionSFX = nullptr;
+
+	/** 액터 없는 시뮬레이션 경로의 비행 비주얼 (ISM 인스턴스) */
+	UPROPERTY(EditDefaultsOnly, Category = "Moses|Grenade|FX")
+	TObjectPtr<UStaticMesh> SimulatedMesh = nullptr;
 };
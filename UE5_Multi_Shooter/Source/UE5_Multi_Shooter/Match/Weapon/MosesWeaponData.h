@@ -31,6 +31,7 @@ class AMosesGrenadeProjectile;
  * - Day7: 이동 스프레드(SpreadDegrees_Min/Max) = "정확도"
  * - Day8: 스나 스코프(로컬) 연출 파라미터
  * - Day9: 유탄 Projectile/폭발 파라미터
+ * - 펠릿(샷건): PelletCount > 1이면 샷 1발 = 히트스캔 N발, 타겟별 데미지 합산 후 GE 1회
  */
 UCLASS(BlueprintType)
 class UE5_MULTI_SHOOTER_API UMosesWeaponData : public UPrimaryDataAsset
@@ -85,6 +86,16 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Aim")
 	float SpreadDegrees_Max = 3.0f;
 
+	/** 펠릿 수(샷건). 1이면 단일 히트스캔. Damage는 펠릿 1발 기준 */
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Pellet", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 PelletCount = 1;
+
+	/** 펠릿 패턴 반각(도). 이동 스프레드로 정해진 중심 방향 기준 */
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Pellet", meta = (ClampMin = "0.0"))
+	float PelletSpreadDegrees = 5.0f;
+
+	bool IsPelletWeapon() const { return !bIsProjectileWeapon && PelletCount > 1; }
+
 	/** Day9: Projectile 기반 무기 여부(유탄) */
 	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Projectile")
 	bool bIsProjectileWeapon = false;
@@ -105,6 +116,39 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Projectile", meta = (ClampMin = "0.0"))
 	float ExplosionDamageOverride = 0.0f;
 
+	/** 폭발 풀 데미지 반경(유탄). 이 밖에서 ExplosionRadius까지 감쇠. 음수 = ExplosionRadius (감쇠 없음, 기존 동작) */
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Projectile", meta = (ClampMin = "-1.0"))
+	float ExplosionInnerRadius = -1.0f;
+
+	/** 감쇠 곡선 지수 (1 = 선형, 클수록 가장자리에서 급감) */
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Projectile", meta = (ClampMin = "0.1"))
+	float ExplosionFalloffExponent = 1.0f;
+
+	/** ExplosionRadius 경계에서의 데미지 배율 (1 = 감쇠 없음) */
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Projectile", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float ExplosionMinDamageScale = 1.0f;
+
+	/** 실제 풀 데미지 반경 (음수 = OuterRadius, OuterRadius 초과 불가) */
+	float ResolveExplosionInnerRadius(float OuterRadius) const
+	{
+		return ExplosionInnerRadius < 0.0f ? OuterRadius : FMath::Min(ExplosionInnerRadius, OuterRadius);
+	}
+
+	/** 벽(WorldStatic) 뒤 대상은 피해 없음 */
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Projectile")
+	bool bExplosionRequiresLineOfSight = true;
+
+	/**
+	 * 액터 없이 UMosesProjectileManagerSubsystem에서 시뮬레이션 (발사 파라미터만 복제)
+	 * - 탄도/FX/메쉬는 ProjectileClass CDO에서 읽는다 (SimulatedMesh 지정 필요)
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Projectile")
+	bool bSimulateProjectileWithoutActor = false;
+
+	/** 시뮬레이션 Projectile 최대 비행 시간(초). 지나면 공중 폭발 */
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Projectile", meta = (ClampMin = "0.1", EditCondition = "bSimulateProjectileWithoutActor"))
+	float ProjectileMaxLifetime = 5.0f;
+
 	/** Day8: 스나 스코프 목표 FOV(2배율) - 로컬 연출용 */
 	UPROPERTY(EditDefaultsOnly, Category = "Weapon|Scope", meta = (ClampMin = "5.0", ClampMax = "170.0"))
 	float ScopeFOV = 45.0f;
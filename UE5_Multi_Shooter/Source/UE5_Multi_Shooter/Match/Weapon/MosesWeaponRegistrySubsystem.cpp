@@ -1,6 +1,7 @@
 ﻿#include "MosesWeaponRegistrySubsystem.h"
 
 #include "UE5_Multi_Shooter/Match/Weapon/MosesWeaponData.h"
+#include "UE5_Multi_Shooter/Match/Weapon/MosesGrenadeProjectile.h"
 #include "UE5_Multi_Shooter/MosesLogChannels.h"
 
 #include "Engine/AssetManager.h"
@@ -85,6 +86,7 @@ void UMosesWeaponRegistrySubsystem::BuildIndexIfNeeded() const
 		}
 
 		UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON] Registry IndexBuild Done via AssetManager Count=%d"), CachedById.Num());
+		BuildNetIndex();
 		return;
 	}
 
@@ -98,6 +100,112 @@ void UMosesWeaponRegistrySubsystem::BuildIndexIfNeeded() const
 	BuildIndexFromAssetRegistry_PathScan(CombatDataWeaponsPath);
 
 	UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON] Registry IndexBuild Done via AssetRegistry Count=%d"), CachedById.Num());
+	BuildNetIndex();
+}
+
+// ============================================================================
+// Net Index
+// ============================================================================
+
+void UMosesWeaponRegistrySubsystem::BuildNetIndex() const
+{
+	TArray<FGameplayTag> SortedIds;
+	CachedById.GetKeys(SortedIds);
+	SortedIds.Sort([](const FGameplayTag& A, const FGameplayTag& B)
+	{
+		return A.GetTagName().LexicalLess(B.GetTagName());
+	});
+
+	if (SortedIds.Num() > MAX_uint8)
+	{
+		UE_LOG(LogMosesWeapon, Error, TEXT("[WEAPON] Registry NetIndex Overflow Count=%d (Max=%d)"), SortedIds.Num(), MAX_uint8);
+		SortedIds.SetNum(MAX_uint8);
+	}
+
+	WeaponIdByNetIndex.Reset(SortedIds.Num() + 1);
+	WeaponIdByNetIndex.Add(FGameplayTag());
+	NetIndexByWeaponId.Reset();
+
+	const int32 NumIds = SortedIds.Num();
+	NetIndexChecksum = FCrc::MemCrc32(&NumIds, sizeof(NumIds));
+
+	for (const FGameplayTag& WeaponId : SortedIds)
+	{
+		NetIndexByWeaponId.Add(WeaponId, static_cast<uint8>(WeaponIdByNetIndex.Num()));
+		WeaponIdByNetIndex.Add(WeaponId);
+
+		NetIndexChecksum = FCrc::StrCrc32(*WeaponId.ToString(), NetIndexChecksum);
+	}
+
+	UE_LOG(LogMosesWeapon, Log, TEXT("[WEAPON] Registry NetIndex Built Count=%d Checksum=%08X"), NumIds, NetIndexChecksum);
+}
+
+uint32 UMosesWeaponRegistrySubsystem::GetNetIndexChecksum() const
+{
+	BuildIndexIfNeeded();
+
+	return NetIndexChecksum;
+}
+
+bool UMosesWeaponRegistrySubsystem::VerifyNetIndexChecksum(uint32 ServerChecksum) const
+{
+	const uint32 LocalChecksum = GetNetIndexChecksum();
+	if (LocalChecksum == ServerChecksum)
+	{
+		UE_LOG(LogMosesWeapon, Log, TEXT("[WEAPON][CL] NetIndex Checksum OK %08X"), LocalChecksum);
+		return true;
+	}
+
+	UE_LOG(LogMosesWeapon, Error, TEXT("[WEAPON][CL] NetIndex Checksum MISMATCH Local=%08X Server=%08X Count=%d (weapon data set differs from server)"),
+		LocalChecksum, ServerChecksum, WeaponIdByNetIndex.Num() - 1);
+
+	for (int32 NetIndex = 1; NetIndex < WeaponIdByNetIndex.Num(); ++NetIndex)
+	{
+		UE_LOG(LogMosesWeapon, Error, TEXT("[WEAPON][CL]   NetIndex %d = %s"), NetIndex, *WeaponIdByNetIndex[NetIndex].ToString());
+	}
+
+	ensureAlwaysMsgf(false, TEXT("Weapon NetIndex checksum mismatch (Local=%08X Server=%08X)"), LocalChecksum, ServerChecksum);
+	return false;
+}
+
+uint8 UMosesWeaponRegistrySubsystem::GetWeaponNetIndex(const FGameplayTag& WeaponId) const
+{
+	if (!WeaponId.IsValid())
+	{
+		return 0;
+	}
+
+	BuildIndexIfNeeded();
+
+	const uint8* Found = NetIndexByWeaponId.Find(WeaponId);
+	if (!Found)
+	{
+		UE_LOG(LogMosesWeapon, Warning, TEXT("[WEAPON] NetIndex FAIL Weapon=%s (NotIndexed)"), *WeaponId.ToString());
+		return 0;
+	}
+
+	return *Found;
+}
+
+FGameplayTag UMosesWeaponRegistrySubsystem::GetWeaponIdByNetIndex(uint8 NetIndex) const
+{
+	BuildIndexIfNeeded();
+
+	return WeaponIdByNetIndex.IsValidIndex(NetIndex) ? WeaponIdByNetIndex[NetIndex] : FGameplayTag();
+}
+
+void UMosesWeaponRegistrySubsystem::GetProjectileClasses(TArray<TSubclassOf<AMosesGrenadeProjectile>>& OutClasses) const
+{
+	BuildIndexIfNeeded();
+
+	for (const TPair<FGameplayTag, TObjectPtr<const UMosesWeaponData>>& Pair : CachedById)
+	{
+		const UMosesWeaponData* Data = Pair.Value.Get();
+		if (Data && Data->bIsProjectileWeapon && Data->ProjectileClass)
+		{
+			OutClasses.AddUnique(Data->ProjectileClass);
+		}
+	}
 }
 
 void UMosesWeaponRegistrySubsystem::BuildIndexFromAssetRegistry_PathScan(const FName& RootPath) const
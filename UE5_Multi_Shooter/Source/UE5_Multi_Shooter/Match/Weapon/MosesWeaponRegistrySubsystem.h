@@ -6,6 +6,7 @@
 #include "MosesWeaponRegistrySubsystem.generated.h"
 
 class UMosesWeaponData;
+class AMosesGrenadeProjectile;
 
 UCLASS()
 class UE5_MULTI_SHOOTER_API UMosesWeaponRegistrySubsystem : public UGameInstanceSubsystem
@@ -18,12 +19,34 @@ public:
 	/** WeaponId로 Data를 resolve (서버/클라 모두 호출 가능) */
 	const UMosesWeaponData* ResolveWeaponData(const FGameplayTag& WeaponId) const;
 
+	/**
+	 * 네트워크 전송용 WeaponId <-> NetIndex (0 = 없음/미등록)
+	 * - 서버/클라가 같은 규칙(태그 이름 사전순)으로 부여
+	 * - 인덱싱된 목록이 다르면 번호가 어긋나므로 서버 체크섬(GameState 복제)으로 검증
+	 */
+	uint8 GetWeaponNetIndex(const FGameplayTag& WeaponId) const;
+	FGameplayTag GetWeaponIdByNetIndex(uint8 NetIndex) const;
+
+	/** 정렬된 WeaponId 목록의 CRC (개수 포함) */
+	uint32 GetNetIndexChecksum() const;
+
+	/** 클라: 서버 체크섬과 비교, 불일치 시 Error + ensure (무기 NetIndex 해석 불가) */
+	bool VerifyNetIndexChecksum(uint32 ServerChecksum) const;
+
+	/** 등록된 Projectile 무기의 ProjectileClass 목록 (중복 제거, 풀 Prewarm용) */
+	void GetProjectileClasses(TArray<TSubclassOf<AMosesGrenadeProjectile>>& OutClasses) const;
+
 private:
 	void BuildIndexIfNeeded() const;
+	void BuildNetIndex() const;
 	void BuildIndexFromAssetRegistry_PathScan(const FName& RootPath) const;
 	void TryRegisterWeaponDataFromObjectPath(const FSoftObjectPath& ObjectPath) const;
 
 private:
 	mutable TMap<FGameplayTag, TObjectPtr<const UMosesWeaponData>> CachedById;
 	mutable bool bIndexBuilt = false;
+
+	mutable TArray<FGameplayTag> WeaponIdByNetIndex;		// [0] = None
+	mutable TMap<FGameplayTag, uint8> NetIndexByWeaponId;
+	mutable uint32 NetIndexChecksum = 0;
 };
@@ -13,6 +13,7 @@
 #include "UE5_Multi_Shooter/Match/Characters/Player/Components/MosesCombatComponent.h"
 #include "UE5_Multi_Shooter/Match/Characters/Player/Components/MosesSlotOwnershipComponent.h"
 #include "UE5_Multi_Shooter/Match/Flag/MosesCaptureComponent.h"
+#include "UE5_Multi_Shooter/Match/Combat/MosesCombatAssetSubsystem.h"
 
 #include "UE5_Multi_Shooter/Match/GAS/Components/MosesAbilitySystemComponent.h"
 #include "UE5_Multi_Shooter/Match/GAS/AttributeSet/MosesAttributeSet.h"
@@ -1013,12 +1014,46 @@ float AMosesPlayerState::GetShield_Max() const
 // =========================================================
 TSubclassOf<UGameplayEffect> AMosesPlayerState::GetDamageGE_Player_SetByCaller() const
 {
-	return DamageGE_Player_SetByCaller.LoadSynchronous();
+	if (!CachedDamageGE_Player)
+	{
+		CachedDamageGE_Player = UMosesCombatAssetSubsystem::ResolveClass(this, DamageGE_Player_SetByCaller);
+	}
+
+	return CachedDamageGE_Player;
 }
 
 TSubclassOf<UGameplayEffect> AMosesPlayerState::GetDamageGE_Zombie_SetByCaller() const
 {
-	return DamageGE_Zombie_SetByCaller.LoadSynchronous();
+	if (!CachedDamageGE_Zombie)
+	{
+		CachedDamageGE_Zombie = UMosesCombatAssetSubsystem::ResolveClass(this, DamageGE_Zombie_SetByCaller);
+	}
+
+	return CachedDamageGE_Zombie;
+}
+
+void AMosesPlayerState::AppendCombatResidencyAssets(TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (!DamageGE_Player_SetByCaller.IsNull())
+	{
+		OutPaths.AddUnique(DamageGE_Player_SetByCaller.ToSoftObjectPath());
+	}
+
+	if (!DamageGE_Zombie_SetByCaller.IsNull())
+	{
+		OutPaths.AddUnique(DamageGE_Zombie_SetByCaller.ToSoftObjectPath());
+	}
+
+	// 하드 레퍼런스지만 Residency Set에 포함해 Pin (BP 교체 시에도 보장)
+	if (GE_ShieldRegen_One)
+	{
+		OutPaths.AddUnique(FSoftObjectPath(GE_ShieldRegen_One.Get()));
+	}
+
+	if (CombatComponent)
+	{
+		CombatComponent->AppendCombatResidencyAssets(OutPaths);
+	}
 }
 
 void AMosesPlayerState::SetPendingCombatAbilitySet(UMosesAbilitySet* InSet)
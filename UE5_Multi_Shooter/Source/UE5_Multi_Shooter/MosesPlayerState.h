@@ -273,6 +273,9 @@ public:
 	/** Zombie Damage SetByCaller GE 로드(SoftClassPtr). */
 	TSubclassOf<UGameplayEffect> GetDamageGE_Zombie_SetByCaller() const;
 
+	/** 전투 GE Residency Set 수집(CDO 기준, Experience 로딩 단계에서 선로드). */
+	void AppendCombatResidencyAssets(TArray<FSoftObjectPath>& OutPaths) const;
+
 private:
 	/* Lobby bridge */
 
@@ -416,4 +419,8 @@ private:
 	/* Non-UPROPERTY */
 
 	FTimerHandle TimerHandle_ShieldRegen;
+
+	/** Damage GE 클래스 캐시 (CombatAssetSubsystem이 Pin → 첫 Resolve 이후 포인터 읽기만) */
+	mutable TSubclassOf<UGameplayEffect> CachedDamageGE_Player;
+	mutable TSubclassOf<UGameplayEffect> CachedDamageGE_Zombie;
 };
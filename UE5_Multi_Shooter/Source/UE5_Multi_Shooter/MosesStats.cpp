@@ -0,0 +1,79 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/MosesStats.cpp
+// ============================================================================
+
+#include "UE5_Multi_Shooter/MosesStats.h"
+
+// ============================================================================
+// Combat / Hitscan Batch
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesHitscanFlush);
+DEFINE_STAT(STAT_MosesHitscanRequests);
+DEFINE_STAT(STAT_MosesHitscanTraces);
+DEFINE_STAT(STAT_MosesHitscanRewindBuckets);
+DEFINE_STAT(STAT_MosesHitscanLatencyMaxMs);
+
+// ============================================================================
+// Combat / Damage Accumulator
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesDamageFlush);
+DEFINE_STAT(STAT_MosesDamageHits);
+DEFINE_STAT(STAT_MosesDamageSpecsApplied);
+
+// ============================================================================
+// Combat / Radial Damage
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesRadialDamageCollect);
+DEFINE_STAT(STAT_MosesRadialDamageTraces);
+
+// ============================================================================
+// Combat / Simulated Projectiles
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesSimProjectileTick);
+DEFINE_STAT(STAT_MosesSimProjectilesActive);
+
+// ============================================================================
+// Combat / Hit Confirm
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesHitConfirmPredicted);
+DEFINE_STAT(STAT_MosesHitConfirmConfirmed);
+DEFINE_STAT(STAT_MosesHitConfirmFalsePositive);
+DEFINE_STAT(STAT_MosesHitConfirmFalseNegative);
+DEFINE_STAT(STAT_MosesHitConfirmHeadshotMismatch);
+DEFINE_STAT(STAT_MosesHitConfirmRejected);
+DEFINE_STAT(STAT_MosesHitConfirmAckLost);
+
+// ============================================================================
+// AI / Player Spatial Hash
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesPlayerHashRebuild);
+DEFINE_STAT(STAT_MosesPlayerHashTracked);
+
+// ============================================================================
+// AI / Zombie Director
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesZombieTargetSelect);
+DEFINE_STAT(STAT_MosesZombieDirectorManaged);
+DEFINE_STAT(STAT_MosesZombieDormant);
+
+// ============================================================================
+// AI / Zombie Spawn Scheduler
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesZombieSpawnProcess);
+DEFINE_STAT(STAT_MosesZombieSpawnQueueDepth);
+DEFINE_STAT(STAT_MosesZombieSpawnLatencyMs);
+
+// ============================================================================
+// AI / Zombie Melee
+// ============================================================================
+
+DEFINE_STAT(STAT_MosesZombieMeleeSweep);
+DEFINE_STAT(STAT_MosesZombieMeleeSweepCount);
@@ -0,0 +1,97 @@
+﻿// ============================================================================
+// UE5_Multi_Shooter/MosesStats.h
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * MosesStats
+ *
+ * 프로젝트 전역 Stat 그룹/카운터를 한 곳에서 관리한다. (콘솔: stat Moses)
+ *
+ * - .h : DECLARE_*_STAT_EXTERN(...)
+ * - .cpp: DEFINE_STAT(...)
+ */
+
+// ============================================================================
+// Stat Group
+// ============================================================================
+
+DECLARE_STATS_GROUP(TEXT("Moses"), STATGROUP_Moses, STATCAT_Advanced);
+
+// ============================================================================
+// Combat / Hitscan Batch
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hitscan Batch Flush"), STAT_MosesHitscanFlush, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hitscan Requests/Frame"), STAT_MosesHitscanRequests, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hitscan Traces/Frame"), STAT_MosesHitscanTraces, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hitscan Rewind Buckets/Frame"), STAT_MosesHitscanRewindBuckets, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Hitscan Batch Latency Max (ms)"), STAT_MosesHitscanLatencyMaxMs, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+
+// ============================================================================
+// Combat / Damage Accumulator
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Accumulator Flush"), STAT_MosesDamageFlush, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Hits/Flush"), STAT_MosesDamageHits, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Specs Applied/Flush"), STAT_MosesDamageSpecsApplied, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+
+// ============================================================================
+// Combat / Radial Damage
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Radial Damage Collect"), STAT_MosesRadialDamageCollect, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Radial Damage LOS Traces"), STAT_MosesRadialDamageTraces, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+
+// ============================================================================
+// Combat / Simulated Projectiles
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sim Projectile Step"), STAT_MosesSimProjectileTick, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sim Projectiles Active"), STAT_MosesSimProjectilesActive, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+
+// ============================================================================
+// Combat / Hit Confirm (Client, 누적)
+// ============================================================================
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HitConfirm Predicted Hits"), STAT_MosesHitConfirmPredicted, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HitConfirm Confirmed"), STAT_MosesHitConfirmConfirmed, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HitConfirm False Positive (Retracted)"), STAT_MosesHitConfirmFalsePositive, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HitConfirm False Negative (Late)"), STAT_MosesHitConfirmFalseNegative, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HitConfirm Headshot Mismatch"), STAT_MosesHitConfirmHeadshotMismatch, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HitConfirm Rejected"), STAT_MosesHitConfirmRejected, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("HitConfirm Ack Lost"), STAT_MosesHitConfirmAckLost, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+
+// ============================================================================
+// AI / Player Spatial Hash
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Player Hash Rebuild"), STAT_MosesPlayerHashRebuild, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Player Hash Tracked"), STAT_MosesPlayerHashTracked, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+
+// ============================================================================
+// AI / Zombie Director
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Zombie Target Select Pass"), STAT_MosesZombieTargetSelect, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Zombie Director Managed"), STAT_MosesZombieDirectorManaged, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Zombies Dormant (LOD)"), STAT_MosesZombieDormant, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+
+// ============================================================================
+// AI / Zombie Spawn Scheduler
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Zombie Spawn Process"), STAT_MosesZombieSpawnProcess, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Zombie Spawn Queue Depth"), STAT_MosesZombieSpawnQueueDepth, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Zombie Spawn Latency (ms, max this frame)"), STAT_MosesZombieSpawnLatencyMs, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+
+// ============================================================================
+// AI / Zombie Melee
+// ============================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Zombie Melee Sweep"), STAT_MosesZombieMeleeSweep, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Zombie Melee Sweeps"), STAT_MosesZombieMeleeSweepCount, STATGROUP_Moses, UE5_MULTI_SHOOTER_API);